@@ -42,6 +42,7 @@
 #include "app_scheduler.h"
 #include "grx_hal.h"
 #include "app_memory.h"
+#include <string.h>
 
 /*
  * DEFINES
@@ -50,17 +51,36 @@
 #define APP_SCHEDULER_LOCK()                  LOCAL_INT_DISABLE(BLE_IRQn)
 #define APP_SCHEDULER_UNLOCK()                LOCAL_INT_RESTORE()
 
+#define APP_SCHEDULER_ALIGN(x)                (((x) + 3) & ~3UL)
+#define APP_SCHEDULER_EVT_INFO_SIZE           ((uint16_t)APP_SCHEDULER_ALIGN(sizeof(app_scheduler_evt_info_t)))
+#define APP_SCHEDULER_LANE_SIZE_MAX           (0xFFFC)
+
 /*
  * STRUCTURES
  *****************************************************************************************
  */
+/**@brief App scheduler lane. The events are stored one after the other in a byte ring, an
+ *        event never wraps: if it doesn't fit before the end of the ring, the end is left
+ *        unused and the event is put at the start. Events are put under the lock from tasks
+ *        and interrupts, and executed by a single consumer. */
+struct app_scheduler_lane_t
+{
+    uint8_t                   *p_ring;
+    uint16_t                   size;
+    volatile uint16_t          used;         /**< Ring bytes of the queued events and of the unused ends. */
+    uint16_t                   rd_idx;       /**< Next event to execute, changed by the consumer only while used != 0. */
+    uint16_t                   wr_idx;       /**< Where the next event is put. */
+    volatile uint16_t          evt_cnt;
+    uint16_t                   used_max;
+    uint16_t                   evt_cnt_max;
+    uint32_t                   dropped;
+};
+
 /**@brief App scheduler environment variable. */
 struct app_scheduler_env_t
 {
-    app_scheduler_evt_info_t  *p_evt_info_buffer;
-    uint16_t                   evt_queue_size;
-    volatile uint8_t           queue_start_index;
-    volatile uint8_t           queue_end_index;
+    uint8_t                      *p_buffer;
+    struct app_scheduler_lane_t   lane[APP_SCHEDULER_PRIO_CNT];
 };
 
 /*
@@ -73,19 +93,44 @@ static struct app_scheduler_env_t  s_app_scheduler_env;
  * LOCAL FUNCTION DEFINITIONS
  *****************************************************************************************
  */
-static __INLINE uint8_t next_index_get(uint8_t index)
+static bool lane_evt_execute(struct app_scheduler_lane_t *p_lane)
 {
-    return (index < s_app_scheduler_env.evt_queue_size) ? (index + 1) : 0;
-}
+    app_scheduler_evt_info_t *p_evt_info;
+    uint16_t                  unused_end = 0;
 
-static __INLINE bool is_evt_queue_full()
-{
-  return next_index_get(s_app_scheduler_env.queue_end_index) == s_app_scheduler_env.queue_start_index;
-}
+    if (0 == p_lane->used)
+    {
+        return false;
+    }
 
-static __INLINE bool is_evt_queue_empty()
-{
-  return s_app_scheduler_env.queue_end_index == s_app_scheduler_env.queue_start_index;
+    if (((p_lane->size - p_lane->rd_idx) < APP_SCHEDULER_EVT_INFO_SIZE) ||
+        (0 == ((app_scheduler_evt_info_t *)&p_lane->p_ring[p_lane->rd_idx])->evt_size))
+    {
+        // the event was put at the start of the ring
+        unused_end     = p_lane->size - p_lane->rd_idx;
+        p_lane->rd_idx = 0;
+    }
+    p_evt_info = (app_scheduler_evt_info_t *)&p_lane->p_ring[p_lane->rd_idx];
+
+    if (p_evt_info->evt_handler)
+    {
+        // the event data is used in place, its ring bytes are given back after the handler
+        void *p_evt_data = (p_evt_info->evt_size > APP_SCHEDULER_EVT_INFO_SIZE) ?
+                           ((uint8_t *)p_evt_info + APP_SCHEDULER_EVT_INFO_SIZE) : NULL;
+        p_evt_info->evt_handler(p_evt_data, p_evt_info->evt_data_size);
+    }
+
+    APP_SCHEDULER_LOCK();
+    p_lane->used   -= unused_end + p_evt_info->evt_size;
+    p_lane->rd_idx += p_evt_info->evt_size;
+    if (p_lane->rd_idx == p_lane->size)
+    {
+        p_lane->rd_idx = 0;
+    }
+    p_lane->evt_cnt--;
+    APP_SCHEDULER_UNLOCK();
+
+    return true;
 }
 
 
@@ -95,55 +140,112 @@ static __INLINE bool is_evt_queue_empty()
  */
 sdk_err_t app_scheduler_init(uint16_t queue_size)
 {
-    if (!queue_size)
+    uint32_t lane_size = APP_SCHEDULER_ALIGN((uint32_t)queue_size * APP_SCHEDULER_EVT_AVG_SIZE);
+
+    if ((!queue_size) || (lane_size > APP_SCHEDULER_LANE_SIZE_MAX))
     {
         return SDK_ERR_INVALID_PARAM;
     }
 
-    s_app_scheduler_env.p_evt_info_buffer = app_malloc((queue_size + 1) * sizeof(app_scheduler_evt_info_t));
+    if (s_app_scheduler_env.p_buffer)
+    {
+        app_free(s_app_scheduler_env.p_buffer);
+    }
+    memset(&s_app_scheduler_env, 0, sizeof(s_app_scheduler_env));
+
+    s_app_scheduler_env.p_buffer = app_malloc(lane_size * APP_SCHEDULER_PRIO_CNT);
 
-    if (NULL == s_app_scheduler_env.p_evt_info_buffer)
+    if (NULL == s_app_scheduler_env.p_buffer)
     {
         return SDK_ERR_NO_RESOURCES;
     }
 
-    memset(s_app_scheduler_env.p_evt_info_buffer, 0, (queue_size + 1) * sizeof(app_scheduler_evt_info_t));
-
-    s_app_scheduler_env.evt_queue_size    = queue_size;
-    s_app_scheduler_env.queue_start_index = 0;
-    s_app_scheduler_env.queue_end_index   = 0;
+    for (uint8_t prio = 0; prio < APP_SCHEDULER_PRIO_CNT; prio++)
+    {
+        s_app_scheduler_env.lane[prio].p_ring = s_app_scheduler_env.p_buffer + prio * lane_size;
+        s_app_scheduler_env.lane[prio].size   = (uint16_t)lane_size;
+    }
 
     return SDK_SUCCESS;
 }
 
 sdk_err_t app_scheduler_evt_put(void const *p_evt_data, uint16_t evt_data_size, app_scheduler_evt_handler_t evt_handler)
 {
-    sdk_err_t  error_code;
-    void      *evt_data_ptr;
+    return app_scheduler_evt_put_prio(APP_SCHEDULER_PRIO_NORMAL, p_evt_data, evt_data_size, evt_handler);
+}
+
+sdk_err_t app_scheduler_evt_put_prio(app_scheduler_prio_t prio, void const *p_evt_data, uint16_t evt_data_size, app_scheduler_evt_handler_t evt_handler)
+{
+    struct app_scheduler_lane_t *p_lane;
+    sdk_err_t                    error_code = SDK_ERR_NO_RESOURCES;
+    uint16_t                     data_size  = p_evt_data ? evt_data_size : 0;
+    uint32_t                     evt_size   = APP_SCHEDULER_EVT_INFO_SIZE + APP_SCHEDULER_ALIGN(data_size);
+
+    if (prio >= APP_SCHEDULER_PRIO_CNT)
+    {
+        return SDK_ERR_INVALID_PARAM;
+    }
+
+    p_lane = &s_app_scheduler_env.lane[prio];
+    if ((NULL == p_lane->p_ring) || (evt_size > p_lane->size))
+    {
+        return SDK_ERR_INVALID_PARAM;
+    }
 
     APP_SCHEDULER_LOCK();
 
-    if (!is_evt_queue_full())
+    if (0 == p_lane->used)
+    {
+        p_lane->rd_idx = 0;
+        p_lane->wr_idx = 0;
+    }
+
+    uint32_t end_size = p_lane->size - p_lane->wr_idx;
+    uint32_t need     = (evt_size <= end_size) ? evt_size : (end_size + evt_size);
+
+    if (need <= (uint32_t)(p_lane->size - p_lane->used))
     {
-        s_app_scheduler_env.p_evt_info_buffer[s_app_scheduler_env.queue_end_index].evt_handler   = evt_handler;
-        s_app_scheduler_env.p_evt_info_buffer[s_app_scheduler_env.queue_end_index].evt_data_size = evt_data_size;
-        if (p_evt_data && evt_data_size)
+        app_scheduler_evt_info_t *p_evt_info;
+
+        if (evt_size > end_size)
         {
-            evt_data_ptr = app_malloc(evt_data_size);
-            if (NULL == evt_data_ptr)
+            if (end_size >= APP_SCHEDULER_EVT_INFO_SIZE)
             {
-                return SDK_ERR_NO_RESOURCES;
+                ((app_scheduler_evt_info_t *)&p_lane->p_ring[p_lane->wr_idx])->evt_size = 0;
             }
+            p_lane->wr_idx = 0;
+        }
 
-            memcpy(evt_data_ptr, p_evt_data, evt_data_size);
-            s_app_scheduler_env.p_evt_info_buffer[s_app_scheduler_env.queue_end_index].p_evt_data = evt_data_ptr;
+        p_evt_info = (app_scheduler_evt_info_t *)&p_lane->p_ring[p_lane->wr_idx];
+        p_evt_info->evt_handler   = evt_handler;
+        p_evt_info->evt_data_size = evt_data_size;
+        p_evt_info->evt_size      = evt_size;
+        if (data_size)
+        {
+            memcpy((uint8_t *)p_evt_info + APP_SCHEDULER_EVT_INFO_SIZE, p_evt_data, data_size);
+        }
+
+        p_lane->wr_idx += evt_size;
+        if (p_lane->wr_idx == p_lane->size)
+        {
+            p_lane->wr_idx = 0;
+        }
+        p_lane->used += need;
+        p_lane->evt_cnt++;
+
+        if (p_lane->used > p_lane->used_max)
+        {
+            p_lane->used_max = p_lane->used;
+        }
+        if (p_lane->evt_cnt > p_lane->evt_cnt_max)
+        {
+            p_lane->evt_cnt_max = p_lane->evt_cnt;
         }
-        s_app_scheduler_env.queue_end_index = next_index_get(s_app_scheduler_env.queue_end_index);
         error_code = SDK_SUCCESS;
     }
     else
     {
-        error_code = SDK_ERR_NO_RESOURCES;
+        p_lane->dropped++;
     }
 
     APP_SCHEDULER_UNLOCK();
@@ -153,26 +255,57 @@ sdk_err_t app_scheduler_evt_put(void const *p_evt_data, uint16_t evt_data_size,
 
 void app_scheduler_execute(void)
 {
-    while(!is_evt_queue_empty())
+    while (app_scheduler_execute_batch(0xFFFF) == 0xFFFF)
     {
-        void                       *p_evt_data;
-        uint16_t                    evt_data_size;
-        app_scheduler_evt_handler_t evt_handler;
-        uint8_t                     evt_index;
+    }
+}
 
-        evt_index = s_app_scheduler_env.queue_start_index;
+uint16_t app_scheduler_execute_batch(uint16_t max_evt_cnt)
+{
+    uint16_t evt_cnt = 0;
 
-        p_evt_data    = s_app_scheduler_env.p_evt_info_buffer[evt_index].p_evt_data;
-        evt_data_size = s_app_scheduler_env.p_evt_info_buffer[evt_index].evt_data_size;
-        evt_handler   = s_app_scheduler_env.p_evt_info_buffer[evt_index].evt_handler;
+    while (evt_cnt < max_evt_cnt)
+    {
+        uint8_t prio;
 
-        if (evt_handler)
+        // look at the higher lanes again after each event
+        for (prio = 0; prio < APP_SCHEDULER_PRIO_CNT; prio++)
         {
-            evt_handler(p_evt_data, evt_data_size);
+            if (lane_evt_execute(&s_app_scheduler_env.lane[prio]))
+            {
+                break;
+            }
         }
 
-        app_free(p_evt_data);
+        if (prio == APP_SCHEDULER_PRIO_CNT)
+        {
+            break;
+        }
+        evt_cnt++;
+    }
+
+    return evt_cnt;
+}
+
+sdk_err_t app_scheduler_stat_get(app_scheduler_prio_t prio, app_scheduler_stat_t *p_stat)
+{
+    struct app_scheduler_lane_t *p_lane;
 
-        s_app_scheduler_env.queue_start_index = next_index_get(s_app_scheduler_env.queue_start_index);
+    if ((prio >= APP_SCHEDULER_PRIO_CNT) || (NULL == p_stat))
+    {
+        return SDK_ERR_INVALID_PARAM;
     }
+
+    p_lane = &s_app_scheduler_env.lane[prio];
+
+    APP_SCHEDULER_LOCK();
+    p_stat->size        = p_lane->size;
+    p_stat->used        = p_lane->used;
+    p_stat->used_max    = p_lane->used_max;
+    p_stat->evt_cnt     = p_lane->evt_cnt;
+    p_stat->evt_cnt_max = p_lane->evt_cnt_max;
+    p_stat->dropped     = p_lane->dropped;
+    APP_SCHEDULER_UNLOCK();
+
+    return SDK_SUCCESS;
 }
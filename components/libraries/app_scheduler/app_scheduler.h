@@ -42,6 +42,30 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/**
+ * @defgroup APP_SCHEDULER_MAROC Defines
+ * @{
+ */
+/**@brief Ring bytes reserved per queued event in each lane, event header (8 bytes) included. */
+#ifndef APP_SCHEDULER_EVT_AVG_SIZE
+#define APP_SCHEDULER_EVT_AVG_SIZE      (24)
+#endif
+/** @} */
+
+/**
+ * @defgroup APP_SCHEDULER_ENUM Enumerations
+ * @{
+ */
+/**@brief App scheduler lanes, a lane is executed only when the lanes above are empty. */
+typedef enum
+{
+    APP_SCHEDULER_PRIO_HIGH,            /**< BLE stack events. */
+    APP_SCHEDULER_PRIO_NORMAL,          /**< Default lane of app_scheduler_evt_put(). */
+    APP_SCHEDULER_PRIO_LOW,             /**< UI and other work that can wait. */
+    APP_SCHEDULER_PRIO_CNT,
+} app_scheduler_prio_t;
+/** @} */
+
 /**
  * @defgroup APP_SCHEDULER_TYPEDEF Typedefs
  * @{
@@ -54,13 +78,24 @@ typedef void (*app_scheduler_evt_handler_t)(void *p_evt_data, uint16_t evt_data_
  * @defgroup APP_SCHEDULER_STRUCT Structures
  * @{
  */
-/**@brief App scheduler event information. */
+/**@brief App scheduler event header, followed by the event data in the lane ring. */
 typedef struct
 {
     app_scheduler_evt_handler_t  evt_handler;        /**< Event handler. */
-    void                        *p_evt_data;         /**< Pointer to event data. */
     uint16_t                     evt_data_size;      /**< Size of event data. */
+    uint16_t                     evt_size;           /**< Ring bytes of the event, 0 marks the unused end of the ring. */
 } app_scheduler_evt_info_t;
+
+/**@brief App scheduler lane statistics. */
+typedef struct
+{
+    uint16_t    size;                   /**< Ring size (bytes). */
+    uint16_t    used;                   /**< Ring bytes in use now. */
+    uint16_t    used_max;               /**< Most ring bytes ever in use. */
+    uint16_t    evt_cnt;                /**< Events queued now. */
+    uint16_t    evt_cnt_max;            /**< Most events ever queued. */
+    uint32_t    dropped;                /**< Events not put because the ring was full. */
+} app_scheduler_stat_t;
 /** @} */
 
 /**
@@ -69,34 +104,85 @@ typedef struct
  */
 /**
  *****************************************************************************************
- * @brief Initialize app scheduler module.
+ * @brief Initialize app scheduler module. Each of the APP_SCHEDULER_PRIO_CNT lanes gets a
+ *        ring of queue_size * APP_SCHEDULER_EVT_AVG_SIZE bytes, allocated once here with
+ *        app_malloc(): 3 * queue_size * 24 bytes by default, out of the APP_MEM_HEAP_SIZE
+ *        (8 KB) app heap. The former single queue took (queue_size + 1) * 12 bytes and an
+ *        app_malloc() per event data, review queue_size and APP_MEM_HEAP_SIZE when updating.
  *
- * @param[in] queue_size: Event queue size.
+ * @param[in] queue_size: Events of APP_SCHEDULER_EVT_AVG_SIZE bytes each lane can hold, fewer
+ *                        when they are bigger. It also bounds the event data size, see
+ *                        app_scheduler_evt_put_prio().
  *
- * @return Result of initialization.
+ * @return Result of initialization, SDK_ERR_INVALID_PARAM if queue_size is 0 or a lane would
+ *         exceed 0xFFFC bytes, SDK_ERR_NO_RESOURCES if the app heap is too small.
  *****************************************************************************************
  */
 sdk_err_t app_scheduler_init(uint16_t queue_size);
 
 /**
  *****************************************************************************************
- * @brief Put an event into event queue.
+ * @brief Put an event into the normal lane.
  *
  * @param[in] p_evt_data:     Pointer to event data.
  * @param[in] evt_data_size:  Size of event data.
  * @param[in] evt_handler:    Event handler.
  *
- * @return  Result of put.
+ * @return  Result of put, see app_scheduler_evt_put_prio().
  *****************************************************************************************
  */
 sdk_err_t app_scheduler_evt_put(void const *p_evt_data, uint16_t evt_data_size, app_scheduler_evt_handler_t evt_handler);
 
+/**
+ *****************************************************************************************
+ * @brief Put an event into a lane. The event data is copied into the lane ring, the
+ *        handler gets a pointer to it that is valid until the handler returns.
+ *        Can be called from interrupts with a priority lower than BLE_IRQn.
+ *        An event takes an app_scheduler_evt_info_t header (8 bytes) plus its data rounded
+ *        up to 4 bytes, and must fit a lane: evt_data_size is at most
+ *        queue_size * APP_SCHEDULER_EVT_AVG_SIZE - 8.
+ *
+ * @param[in] prio:           Lane of the event.
+ * @param[in] p_evt_data:     Pointer to event data.
+ * @param[in] evt_data_size:  Size of event data.
+ * @param[in] evt_handler:    Event handler.
+ *
+ * @return  Result of put, SDK_ERR_NO_RESOURCES if the lane ring is full for now,
+ *          SDK_ERR_INVALID_PARAM if the event is larger than a lane and can never be put.
+ *****************************************************************************************
+ */
+sdk_err_t app_scheduler_evt_put_prio(app_scheduler_prio_t prio, void const *p_evt_data, uint16_t evt_data_size, app_scheduler_evt_handler_t evt_handler);
+
 /**
  *****************************************************************************************
  * @brief Executing all events.
  *****************************************************************************************
  */
 void app_scheduler_execute(void);
+
+/**
+ *****************************************************************************************
+ * @brief Execute up to max_evt_cnt events, the highest lane first. An event put into a
+ *        higher lane meanwhile runs before the next event of a lower lane.
+ *
+ * @param[in] max_evt_cnt: Most events to execute.
+ *
+ * @return Number of events executed.
+ *****************************************************************************************
+ */
+uint16_t app_scheduler_execute_batch(uint16_t max_evt_cnt);
+
+/**
+ *****************************************************************************************
+ * @brief Get the statistics of a lane.
+ *
+ * @param[in]  prio:   Lane.
+ * @param[out] p_stat: Statistics of the lane.
+ *
+ * @return Result of get.
+ *****************************************************************************************
+ */
+sdk_err_t app_scheduler_stat_get(app_scheduler_prio_t prio, app_scheduler_stat_t *p_stat);
 /** @} */
 
 #endif
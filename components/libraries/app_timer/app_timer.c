@@ -106,6 +106,30 @@
 #define IS_TRIGGER_WINDOW_MARKED(x)     (x->timer_mark == true)
 #endif
 
+#if APP_TIMER_WHEEL_ENABLE
+#if APP_TIMER_TRIGGER_WINDOW_ENABLE
+#error "APP_TIMER_WHEEL_ENABLE fires the timers due at the same time together, disable APP_TIMER_TRIGGER_WINDOW_ENABLE"
+#endif
+/** @brief app timer timing wheel definitions, 5 levels of 64 slots from 1.024 ms to 4.8 hours (12.7 days in all) */
+#define APP_TIMER_WHEEL_LEVEL_CNT       (5)
+#define APP_TIMER_WHEEL_SLOT_BITS       (6)
+#define APP_TIMER_WHEEL_SLOT_CNT        (1 << APP_TIMER_WHEEL_SLOT_BITS)
+#define APP_TIMER_WHEEL_SLOT_MASK       (APP_TIMER_WHEEL_SLOT_CNT - 1)
+#define APP_TIMER_WHEEL_TICK_BITS       (10)
+#define APP_TIMER_WHEEL_SHIFT(level)    (APP_TIMER_WHEEL_TICK_BITS + (level) * APP_TIMER_WHEEL_SLOT_BITS)
+#define APP_TIMER_WHEEL_SLOT_OF(level, time_us) \
+        ((uint32_t)((time_us) >> APP_TIMER_WHEEL_SHIFT(level)) & APP_TIMER_WHEEL_SLOT_MASK)
+
+/** @brief App timer wheel. A node is at the lowest level where its expiry and apptimer_total_us
+ *         share the upper time bits, so every node of a level expires after all nodes of the
+ *         levels below. A slot is a ring of nodes linked with p_next/p_prev. */
+typedef struct
+{
+    uint64_t        slot_bitmap[APP_TIMER_WHEEL_LEVEL_CNT];
+    app_timer_t    *p_slot_hd[APP_TIMER_WHEEL_LEVEL_CNT][APP_TIMER_WHEEL_SLOT_CNT];
+}app_timer_wheel_t;
+#endif
+
 /** @brief App timer global state variable. */
 typedef struct app_timer_struct
 {
@@ -139,6 +163,10 @@ static app_timer_info_t s_app_timer_info =
 #endif
 };
 
+#if APP_TIMER_WHEEL_ENABLE
+static app_timer_wheel_t s_app_timer_wheel;
+#endif
+
 /*
  * LOCAL FUNCTION DECLARATION
  *****************************************************************************************
@@ -156,6 +184,13 @@ static uint8_t         app_timer_running_queue_trigger_window_execute(void);
 static void            app_timer_node_init(app_timer_id_t *p_timer_id, uint64_t delay, void *p_ctx, uint64_t insert_time);
 static uint8_t         is_need_insert_front(uint64_t delay_value, uint64_t rest_time);
 static uint8_t         is_timer_node_created(app_timer_id_t *p_timer_id);
+static void            app_timer_total_us_set(uint64_t total_us);
+#if APP_TIMER_WHEEL_ENABLE
+static void            app_timer_wheel_add(app_timer_t *p_node);
+static void            app_timer_wheel_del(app_timer_t *p_node);
+static app_timer_t*    app_timer_wheel_first(void);
+static void            app_timer_wheel_advance(uint64_t total_us);
+#endif
 
 
 /**
@@ -173,6 +208,65 @@ void SLPTIMER_IRQHandler(void)
  * GLOBAL FUNCTION DEFINITIONS
  *****************************************************************************************
  */
+#if APP_TIMER_WHEEL_ENABLE
+void hal_pwr_sleep_timer_elapsed_callback(void)
+{
+    app_timer_t  *p_fired_hd    = NULL;
+    app_timer_t **pp_fired_tail = &p_fired_hd;
+
+    APP_TIMER_LOCK();
+
+    APP_ASSERT_CHECK(s_app_timer_info.p_curr_timer_node);
+    if (NULL == s_app_timer_info.p_curr_timer_node)
+    {
+        APP_TIMER_UNLOCK();
+        return;
+    }
+
+    app_timer_total_us_set(s_app_timer_info.p_curr_timer_node->next_shot_time);
+
+    // every node due now fires in this interrupt, the repeat ones are armed again first
+    while (s_app_timer_info.p_curr_timer_node &&
+           (s_app_timer_info.p_curr_timer_node->next_shot_time <= s_app_timer_info.apptimer_total_us))
+    {
+        app_timer_t *p_node = app_timer_running_queue_remove(NULL);
+
+        p_node->timer_mark   = true;
+        p_node->p_fired_next = NULL;
+        *pp_fired_tail       = p_node;
+        pp_fired_tail        = &p_node->p_fired_next;
+
+        if (p_node->timer_node_mode == ATIMER_REPEAT)
+        {
+            p_node->next_shot_time = s_app_timer_info.apptimer_total_us + p_node->original_delay;
+            app_timer_running_queue_insert(p_node);
+        }
+    }
+
+    if (s_app_timer_info.p_curr_timer_node)
+    {
+        low_level_timer_startup(s_app_timer_info.p_curr_timer_node->next_shot_time - s_app_timer_info.apptimer_total_us);
+    }
+
+    APP_TIMER_UNLOCK();
+
+    while (p_fired_hd)
+    {
+        app_timer_t *p_node = p_fired_hd;
+        p_fired_hd = p_node->p_fired_next;
+
+        // stopped by an earlier callback of this expiry
+        if (!p_node->timer_mark)
+            continue;
+        p_node->timer_mark = false;
+
+        if (p_node->timer_node_cb)
+            p_node->timer_node_cb(p_node->arg);
+        else
+            APP_ASSERT_CHECK(false);
+    }
+}
+#else
 void hal_pwr_sleep_timer_elapsed_callback(void)
 {
     app_timer_t *p_curr_node = app_timer_running_queue_remove(NULL);
@@ -229,6 +323,7 @@ void hal_pwr_sleep_timer_elapsed_callback(void)
     app_timer_running_queue_trigger_window_execute();
 #endif
 }
+#endif
 
 sdk_err_t app_timer_start_api(app_timer_id_t *p_timer_id, uint32_t delay, void *p_ctx)
 {
@@ -244,7 +339,12 @@ sdk_err_t app_timer_start_api(app_timer_id_t *p_timer_id, uint32_t delay, void *
     APP_TIMER_LOCK();
 
     if ((!is_timer_node_created(p_timer_id)) ||
-        (p_timer_id->timer_node_status != STOP))
+        (p_timer_id->timer_node_status != STOP)
+#if APP_TIMER_WHEEL_ENABLE
+        // still to fire in hal_pwr_sleep_timer_elapsed_callback(), running as in the sorted list
+        || p_timer_id->timer_mark
+#endif
+        )
     {
         APP_TIMER_UNLOCK();
         return SDK_ERR_DISALLOWED;
@@ -257,13 +357,13 @@ sdk_err_t app_timer_start_api(app_timer_id_t *p_timer_id, uint32_t delay, void *
         if (s_app_timer_info.p_curr_timer_node)
         {
             APP_ASSERT_CHECK(last_rest_time <= (s_app_timer_info.p_curr_timer_node->next_shot_time - s_app_timer_info.apptimer_total_us));
-            s_app_timer_info.apptimer_total_us = s_app_timer_info.p_curr_timer_node->next_shot_time - last_rest_time;
+            app_timer_total_us_set(s_app_timer_info.p_curr_timer_node->next_shot_time - last_rest_time);
             low_level_timer_stop();
         }
         else
         {
             // the node that will be started is the first timer node
-            s_app_timer_info.apptimer_total_us = 0;
+            app_timer_total_us_set(0);
             last_rest_time = 0;
         }
         trigger_flag = true;
@@ -305,13 +405,17 @@ void app_timer_stop_api(app_timer_id_t *p_timer_id)
         return;
 
     APP_TIMER_LOCK();
+#if APP_TIMER_WHEEL_ENABLE
+    // don't fire for an expiry still pending in hal_pwr_sleep_timer_elapsed_callback()
+    p_timer_id->timer_mark = false;
+#endif
     if (p_timer_id->timer_node_status == RUN)
     {
         if (s_app_timer_info.p_curr_timer_node == p_timer_id)
         {
             last_rest_time = low_level_timer_rest_get();
             APP_ASSERT_CHECK(last_rest_time <= (s_app_timer_info.p_curr_timer_node->next_shot_time - s_app_timer_info.apptimer_total_us));
-            s_app_timer_info.apptimer_total_us = (p_timer_id->next_shot_time - last_rest_time);
+            app_timer_total_us_set(p_timer_id->next_shot_time - last_rest_time);
 
             low_level_timer_stop();
             timer_has_stop = true;
@@ -413,6 +517,9 @@ sdk_err_t app_timer_create(app_timer_id_t *p_timer_id, app_timer_type_t mode, ap
     p_timer_id->timer_node_status = STOP;
     p_timer_id->timer_node_mode   = mode;
     p_timer_id->timer_node_cb     = callback;
+#if APP_TIMER_WHEEL_ENABLE
+    p_timer_id->timer_mark        = false;
+#endif
 
     APP_TIMER_UNLOCK();
 
@@ -494,6 +601,56 @@ static uint64_t low_level_timer_rest_get(void)
     return curr_rest_us;
 }
 
+#if APP_TIMER_WHEEL_ENABLE
+static uint8_t app_timer_running_queue_insert(app_timer_t *p_timer_id)
+{
+    if (p_timer_id == NULL)
+    {
+        return false;
+    }
+
+    APP_TIMER_LOCK();
+
+    app_timer_wheel_add(p_timer_id);
+    p_timer_id->timer_node_status = RUN;
+
+    s_app_timer_info.cnt_node++;
+    if ((NULL == s_app_timer_info.p_curr_timer_node) ||
+        (p_timer_id->next_shot_time < s_app_timer_info.p_curr_timer_node->next_shot_time))
+    {
+        s_app_timer_info.p_curr_timer_node = p_timer_id;
+    }
+
+    APP_TIMER_UNLOCK();
+    return true;
+}
+
+static app_timer_t *app_timer_running_queue_remove(app_timer_id_t *p_timer_id)
+{
+    app_timer_t *remove_node = p_timer_id ? p_timer_id : s_app_timer_info.p_curr_timer_node;
+
+    APP_TIMER_LOCK();
+
+    if (remove_node && (remove_node->timer_node_status == RUN))
+    {
+        app_timer_wheel_del(remove_node);
+        remove_node->timer_node_status = STOP;
+        s_app_timer_info.cnt_node--;
+
+        if (remove_node == s_app_timer_info.p_curr_timer_node)
+        {
+            s_app_timer_info.p_curr_timer_node = app_timer_wheel_first();
+        }
+    }
+    else
+    {
+        remove_node = NULL;
+    }
+
+    APP_TIMER_UNLOCK();
+    return remove_node;
+}
+#else
 static uint8_t app_timer_running_queue_insert(app_timer_t *p_timer_id)
 {
     if (p_timer_id == NULL)
@@ -526,6 +683,7 @@ static uint8_t app_timer_running_queue_insert(app_timer_t *p_timer_id)
     APP_TIMER_UNLOCK();
     return true;
 }
+#endif
 
 #if APP_TIMER_TRIGGER_WINDOW_ENABLE
 static uint8_t app_timer_running_queue_trigger_window_mark(void)
@@ -623,6 +781,7 @@ static uint8_t app_timer_running_queue_trigger_window_execute(void)
 }
 #endif
 
+#if !APP_TIMER_WHEEL_ENABLE
 static app_timer_t *app_timer_running_queue_remove(app_timer_id_t *p_timer_id)
 {
     app_timer_t *remove_node = NULL;
@@ -668,6 +827,7 @@ static app_timer_t *app_timer_running_queue_remove(app_timer_id_t *p_timer_id)
     APP_TIMER_UNLOCK();
     return remove_node;
 }
+#endif
 
 static void app_timer_node_init(app_timer_id_t *p_timer_id, uint64_t delay, void *p_ctx, uint64_t insert_time)
 {
@@ -709,3 +869,149 @@ static uint8_t is_timer_node_created(app_timer_id_t *p_timer_id)
 
     return false;
 }
+
+static void app_timer_total_us_set(uint64_t total_us)
+{
+#if APP_TIMER_WHEEL_ENABLE
+    app_timer_wheel_advance(total_us);
+#else
+    s_app_timer_info.apptimer_total_us = total_us;
+#endif
+}
+
+#if APP_TIMER_WHEEL_ENABLE
+static uint32_t app_timer_wheel_first_bit(uint64_t bits)
+{
+    uint32_t low = (uint32_t)bits;
+
+    if (low)
+        return __CLZ(__RBIT(low));
+
+    return 32 + __CLZ(__RBIT((uint32_t)(bits >> 32)));
+}
+
+static void app_timer_wheel_add(app_timer_t *p_node)
+{
+    uint64_t      diff  = p_node->next_shot_time ^ s_app_timer_info.apptimer_total_us;
+    uint32_t      level = 0;
+    uint32_t      slot;
+    app_timer_t **pp_hd;
+
+    while ((level < APP_TIMER_WHEEL_LEVEL_CNT - 1) && (diff >> APP_TIMER_WHEEL_SHIFT(level + 1)))
+    {
+        level++;
+    }
+
+    slot  = APP_TIMER_WHEEL_SLOT_OF(level, p_node->next_shot_time);
+    pp_hd = &s_app_timer_wheel.p_slot_hd[level][slot];
+
+    if (NULL == *pp_hd)
+    {
+        p_node->p_next = p_node;
+        p_node->p_prev = p_node;
+        *pp_hd = p_node;
+        s_app_timer_wheel.slot_bitmap[level] |= (uint64_t)1 << slot;
+    }
+    else
+    {
+        // append, the nodes due at the same time fire in start order
+        p_node->p_next = *pp_hd;
+        p_node->p_prev = (*pp_hd)->p_prev;
+        (*pp_hd)->p_prev->p_next = p_node;
+        (*pp_hd)->p_prev = p_node;
+    }
+    p_node->wheel_slot = (uint16_t)((level << APP_TIMER_WHEEL_SLOT_BITS) | slot);
+}
+
+static void app_timer_wheel_del(app_timer_t *p_node)
+{
+    uint32_t      level = p_node->wheel_slot >> APP_TIMER_WHEEL_SLOT_BITS;
+    uint32_t      slot  = p_node->wheel_slot & APP_TIMER_WHEEL_SLOT_MASK;
+    app_timer_t **pp_hd = &s_app_timer_wheel.p_slot_hd[level][slot];
+
+    if (p_node->p_next == p_node)
+    {
+        *pp_hd = NULL;
+        s_app_timer_wheel.slot_bitmap[level] &= ~((uint64_t)1 << slot);
+    }
+    else
+    {
+        p_node->p_prev->p_next = p_node->p_next;
+        p_node->p_next->p_prev = p_node->p_prev;
+        if (*pp_hd == p_node)
+        {
+            *pp_hd = p_node->p_next;
+        }
+    }
+    p_node->p_next = NULL;
+    p_node->p_prev = NULL;
+}
+
+static app_timer_t *app_timer_wheel_first(void)
+{
+    for (uint32_t level = 0; level < APP_TIMER_WHEEL_LEVEL_CNT; level++)
+    {
+        uint64_t bits = s_app_timer_wheel.slot_bitmap[level];
+        uint32_t from = APP_TIMER_WHEEL_SLOT_OF(level, s_app_timer_info.apptimer_total_us);
+
+        if (0 == bits)
+            continue;
+
+        // the first used slot from the current time on, the top level may wrap around
+        if (from)
+        {
+            bits = (bits >> from) | (bits << (APP_TIMER_WHEEL_SLOT_CNT - from));
+        }
+
+        app_timer_t *p_hd    = s_app_timer_wheel.p_slot_hd[level][(from + app_timer_wheel_first_bit(bits)) & APP_TIMER_WHEEL_SLOT_MASK];
+        app_timer_t *p_first = p_hd;
+        for (app_timer_t *p_node = p_hd->p_next; p_node != p_hd; p_node = p_node->p_next)
+        {
+            if (p_node->next_shot_time < p_first->next_shot_time)
+            {
+                p_first = p_node;
+            }
+        }
+        return p_first;
+    }
+
+    return NULL;
+}
+
+static void app_timer_wheel_advance(uint64_t total_us)
+{
+    uint64_t last_total_us = s_app_timer_info.apptimer_total_us;
+
+    // the nodes are placed relative to the new time
+    s_app_timer_info.apptimer_total_us = total_us;
+    if (0 == s_app_timer_info.cnt_node)
+        return;
+
+    APP_ASSERT_CHECK(total_us >= last_total_us);
+    APP_ASSERT_CHECK((NULL == s_app_timer_info.p_curr_timer_node) ||
+                     (total_us <= s_app_timer_info.p_curr_timer_node->next_shot_time));
+
+    // time never passes the first expiry, so only the slot of the new time is due on each level
+    for (uint32_t level = APP_TIMER_WHEEL_LEVEL_CNT - 1; level > 0; level--)
+    {
+        if ((last_total_us >> APP_TIMER_WHEEL_SHIFT(level)) == (total_us >> APP_TIMER_WHEEL_SHIFT(level)))
+            continue;
+
+        uint32_t     slot   = APP_TIMER_WHEEL_SLOT_OF(level, total_us);
+        app_timer_t *p_node = s_app_timer_wheel.p_slot_hd[level][slot];
+        if (NULL == p_node)
+            continue;
+
+        // cascade the slot to the lower levels
+        s_app_timer_wheel.p_slot_hd[level][slot] = NULL;
+        s_app_timer_wheel.slot_bitmap[level] &= ~((uint64_t)1 << slot);
+        p_node->p_prev->p_next = NULL;
+        while (p_node)
+        {
+            app_timer_t *p_next = p_node->p_next;
+            app_timer_wheel_add(p_node);
+            p_node = p_next;
+        }
+    }
+}
+#endif
@@ -58,6 +58,12 @@
 
 /** @brief App timer trigger window enable define. */
 #define APP_TIMER_TRIGGER_WINDOW_ENABLE   0
+
+/** @brief App timer timing wheel enable define. The running timers are kept in a hierarchical
+ *         timing wheel instead of a sorted list, start/stop/expiry no longer walk all of them. */
+#ifndef APP_TIMER_WHEEL_ENABLE
+#define APP_TIMER_WHEEL_ENABLE            0
+#endif
 /** @} */
 
 /**
@@ -95,6 +101,11 @@ typedef struct app_timer_s
     void*                    arg;                         /**< Timer trigger callback argument. */
     app_timer_fun_t          timer_node_cb;               /**< Timer trigger callback . */
     struct app_timer_s       *p_next;
+#if APP_TIMER_WHEEL_ENABLE
+    struct app_timer_s       *p_prev;                     /**< Previous node in the same wheel slot. */
+    struct app_timer_s       *p_fired_next;               /**< Next node fired by the same expiry. */
+    uint16_t                 wheel_slot;                  /**< Wheel level and slot of the node. */
+#endif
 } app_timer_t;
 
 /** @} */
@@ -49,23 +49,45 @@
 #include "bt_ctl_uart.h"
 #include "bt_ctl_debug_interface.h"
 
+/*
+ * LOCAL TYPE DEFINITIONS
+ *****************************************************************************************
+ */
+typedef struct
+{
+    uint16_t              head;
+    uint8_t               opcode_max;
+    app_bt_handler_func_t handler;
+} bt_rx_frame_type_t;
+
 /*
  * LOCAL VARIABLE DEFINITIONS
  *****************************************************************************************
  */
-static uint8_t bt_rx_buf[BT_MAX_RX_LEN] = {0};
-static uint8_t rx_data_offset = 0;
-static RX_STATUS_T rx_state = RX_HEADER;
-static bt_rx_info g_bt_rx_info;
-static uint8_t rx_data_ref_len = 0;
-static uint8_t rx_data_ref_offset = 0;
-static uint8_t* ref_data_buffer = NULL;
+static const bt_rx_frame_type_t s_rx_frame_types[] =
+{
+    {BT_CTL_CMD_ACK_HEAD, OPCODE_BT_MAX,   app_bt_ack_handle},
+    {BT_CTL_IND_HEAD,     IND_MESSAGE_MAX, app_bt_ind_handle},
+};
+
+// Frame being received, the header is checked as it arrives
+static uint8_t s_rx_frame[BT_CTL_DATA_LEN_MIN + BT_MAX_RX_LEN] = {0};
+static uint16_t s_rx_frame_fill = 0;        // bytes in s_rx_frame
+static uint16_t s_rx_frame_offset = 0;      // bytes of s_rx_frame parsed
+static uint16_t s_rx_frame_length = 0;      // data length from the header
+static RX_STATUS_T s_rx_state = RX_HEADER;
+static const bt_rx_frame_type_t *s_p_rx_frame_type = NULL;
 
 static uint8_t s_uart_tx_buffer[WATCH_DEMO_UART_BUFF_TX_LEN];
-uint8_t s_uart_rx_buffer[WATCH_DEMO_UART_BUFF_RX_LEN];
 
-static uint8_t s_uart_ring_buffer_data[WATCH_DEMO_UART_BUFF_RX_LEN] = {0};
+// The UART receives straight into the ring, the guard keeps the fixed length OTA response checks in bounds
+static uint8_t s_uart_ring_buffer_data[WATCH_DEMO_UART_RING_LEN + WATCH_DEMO_UART_RING_GUARD_LEN] = {0};
 static ring_buffer_t s_rx_ring_buffer;
+static uint8_t *s_p_rx_region = NULL;
+static uint16_t s_rx_region_size = 0;
+static uint16_t s_rx_burst_len = 0;
+static volatile bool s_rx_starved = false;
+static ble_bt_uart_rx_stat_t s_rx_stat = {0};
 
 uint32_t WATCH_DEMO_UART_BAUDRATE = WATCH_DEMO_UART_BAUDRATE_ORI;
 app_uart_params_t ble_bt_uart_param;
@@ -95,76 +117,81 @@ extern void app_bt_register_ble_adv_ptr(void (*ptr)(void ));
  * LOCAL  FUNCTION DEFINITIONS
  *****************************************************************************************
  */
+// Receive into the free space of the ring from the write index, the data is committed as it is without copy.
+static void ble_bt_uart_rx_start(void)
+{
+    uint8_t *p_region = NULL;
+    uint32_t size = ring_buffer_write_reserve(&s_rx_ring_buffer, &p_region, WATCH_DEMO_UART_BUFF_RX_LEN);
+
+    if (0 == size)
+    {
+        // restarted by handle_uart_ring_buffer_data() when the data is consumed
+        s_rx_starved = true;
+        s_rx_stat.overrun_cnt++;
+        return;
+    }
+
+    if (APP_DRV_SUCCESS != app_uart_receive_async(WATCH_DEMO_UART_ID, p_region, (uint16_t)size))
+    {
+        // retried by handle_uart_ring_buffer_data()
+        s_rx_starved = true;
+        s_rx_stat.error_cnt++;
+        return;
+    }
+
+    s_p_rx_region = p_region;
+    s_rx_region_size = (uint16_t)size;
+}
+
+static void ble_bt_uart_rx_done(uint16_t size)
+{
+    s_rx_stat.rx_bytes += size;
+    s_rx_burst_len += size;
+    // A region received up to its end is continued in the next one, the burst ends with the RX timeout
+    if (size < s_rx_region_size)
+    {
+        if (s_rx_burst_len > s_rx_stat.max_burst)
+        {
+            s_rx_stat.max_burst = s_rx_burst_len;
+        }
+        s_rx_burst_len = 0;
+    }
+}
+
 static void app_uart_bt_evt_handler(app_uart_evt_t *p_evt)
 {
     switch(p_evt->type) {
         case APP_UART_EVT_RX_DATA:
             ble_bt_set_sync_io();
-            //if OTA mode, do not need ring buffer.
+            ble_bt_uart_rx_done(p_evt->data.size);
+            //if OTA mode, do not need ring buffer, the region is received again.
 #ifdef BLE_BT_OTA_SUPPORT
             if (bt_ota_state != BT_OTA_IDLE)
             {
-                app_bt_ota_reponse_handle(s_uart_rx_buffer, p_evt->data.size);
+                app_bt_ota_reponse_handle(s_p_rx_region, p_evt->data.size);
+                memset(s_p_rx_region, 0, p_evt->data.size);
             }
             else
 #endif
             {
-                if (ring_buffer_write(&s_rx_ring_buffer, s_uart_rx_buffer, p_evt->data.size) != p_evt->data.size)
-                {
-                    APP_LOG_ERROR("Ring buffer set too small!");
-                }
                 if (bt_debug_mode_is_active())
                 {
-                    app_bt_debug_reponse_handle(s_uart_rx_buffer, p_evt->data.size);
+                    app_bt_debug_reponse_handle(s_p_rx_region, p_evt->data.size);
                 }
+                ring_buffer_write_commit(&s_rx_ring_buffer, p_evt->data.size);
             }
-            memset(s_uart_rx_buffer, 0, WATCH_DEMO_UART_BUFF_RX_LEN);
-            app_uart_receive_async(WATCH_DEMO_UART_ID, s_uart_rx_buffer, WATCH_DEMO_UART_BUFF_RX_LEN);
+            ble_bt_uart_rx_start();
             break;
         case APP_UART_EVT_ERROR:
             APP_LOG_DEBUG("watch demo uart err_code = %d\n", p_evt->data.error_code);
-            memset(s_uart_rx_buffer, 0, WATCH_DEMO_UART_BUFF_RX_LEN);
-            app_uart_receive_async(WATCH_DEMO_UART_ID, s_uart_rx_buffer, WATCH_DEMO_UART_BUFF_RX_LEN);
+            s_rx_stat.error_cnt++;
+            ble_bt_uart_rx_start();
             break;
         default:
             break;
     }
 }
 
-static void app_bt_deal_data(uint8_t *buf, uint16_t len)
-{
-    g_bt_rx_info.cmd        = buf[0] | buf[1]<<8;
-    g_bt_rx_info.opcode   = buf[2];
-    g_bt_rx_info.length    =  buf[3] | buf[4]<<8;
-    if (g_bt_rx_info.length > 0)
-    {
-        g_bt_rx_info.data       =&buf[5];
-    }
-    else
-    {
-        g_bt_rx_info.data = NULL;
-    }
-
-    if (g_bt_rx_info.cmd == BT_CTL_CMD_ACK_HEAD)
-    {
-        app_bt_ack_handle(&g_bt_rx_info);
-    }
-    else if (g_bt_rx_info.cmd == BT_CTL_IND_HEAD)
-    {
-        app_bt_ind_handle(&g_bt_rx_info);
-    }
-    
-//    APP_LOG_RAW_INFO("\r\n");
-//    while(len --)
-//    {
-//        APP_LOG_RAW_INFO("%02x", *buf);
-//        buf++;
-//    }
-//    APP_LOG_RAW_INFO("\r\n");
-
-    memset(&g_bt_rx_info, 0, sizeof(bt_rx_info));
-}
-
 #if SUM_CALCULATE
 uint8_t app_bt_calc_checksum(uint8_t *p_buf, uint16_t len)
 {
@@ -180,218 +207,148 @@ uint8_t app_bt_calc_checksum(uint8_t *p_buf, uint16_t len)
 }
 #endif
 
-static uint8_t  app_bt_buff_rx_format(uint8_t *buf, uint16_t len)
+static const bt_rx_frame_type_t *bt_rx_frame_type_get(uint16_t head)
 {
-    uint16_t buff_idx = 0;
-    uint16_t buff_orig_idx = 0;
+    for (uint32_t i = 0; i < sizeof(s_rx_frame_types) / sizeof(s_rx_frame_types[0]); i++)
+    {
+        if (s_rx_frame_types[i].head == head)
+        {
+            return &s_rx_frame_types[i];
+        }
+    }
 
-    uint16_t opcode_max = 0;
-    uint16_t cmd_head = 0;
-    uint16_t length = 0;
-#if SUM_CALCULATE
-    uint8_t checksum = 0;
-#endif
-    bool  has_log = true;
-    uint8_t ret = 0;
+    return NULL;
+}
 
-    //reset last un-complete rx data  
-    rx_data_ref_len = 0;
-    rx_data_offset = 0;
+static void bt_rx_frame_dispatch(void)
+{
+    bt_rx_info rx_info;
 
-    if (len < BT_CTL_DATA_LEN_MIN)
-    {
-        rx_data_ref_len = BT_CTL_DATA_LEN_MIN;
-        ret = 1;
-        APP_LOG_RAW_INFO("short message length = %d \r\n", len);
-        return ret;
-    }
+    rx_info.cmd    = s_p_rx_frame_type->head;
+    rx_info.opcode = s_rx_frame[BT_CTL_HEAD_LEN];
+    rx_info.length = s_rx_frame_length;
+    rx_info.data   = (s_rx_frame_length > 0) ? &s_rx_frame[BT_CTL_DATA_INDEX] : NULL;
 
+    s_rx_stat.frame_cnt++;
     bt_test_mode_al_cnt++;
+    s_p_rx_frame_type->handler(&rx_info);
+}
+
+// Drop the first bytes of the frame buffer, the rest is parsed again from the header.
+static void bt_rx_frame_drop(uint16_t len)
+{
+    s_rx_frame_fill -= len;
+    memmove(s_rx_frame, s_rx_frame + len, s_rx_frame_fill);
+    s_rx_frame_offset = 0;
+    s_rx_state = RX_HEADER;
+}
 
-    while(1)
+static void bt_rx_frame_parse(void)
+{
+    while (s_rx_frame_offset < s_rx_frame_fill)
     {
-        bt_rx_buf[rx_data_offset] = buf[buff_idx + buff_orig_idx];
-        rx_data_offset++;
-        buff_idx ++;
+        uint8_t byte = s_rx_frame[s_rx_frame_offset++];
+        bool broken = false;
 
-        switch(rx_state)
+        switch (s_rx_state)
         {
             case RX_HEADER:
-                if (rx_data_offset == BT_CTL_HEAD_LEN)
+                if (s_rx_frame_offset == BT_CTL_HEAD_LEN)
                 {
-                    cmd_head = (((uint16_t)bt_rx_buf[rx_data_offset-BT_CTL_HEAD_LEN]) | ((uint16_t)bt_rx_buf[rx_data_offset-BT_CTL_HEAD_LEN+1]<<8));
-                    if (BT_CTL_CMD_ACK_HEAD == cmd_head)
-                    {
-                        rx_state= RX_OPCODE;
-                        opcode_max = OPCODE_BT_MAX;
-                    }
-                    else if (BT_CTL_IND_HEAD == cmd_head)
-                    {
-                        rx_state= RX_OPCODE;
-                        opcode_max = IND_MESSAGE_MAX;
-                    }
-                    else
-                    {
-                        // err format, go to head
-                        rx_state = RX_HEADER;
-                        buff_orig_idx ++;
-                        rx_data_offset = 0;
-                        buff_idx = 0;
-                        //APP_LOG_RAW_INFO("line %d, return head ptr %02x -->", __LINE__, buf[buff_idx + buff_orig_idx]);
-                    }
+                    s_p_rx_frame_type = bt_rx_frame_type_get((uint16_t)s_rx_frame[0] | ((uint16_t)byte << 8));
+                    broken = (NULL == s_p_rx_frame_type);
+                    s_rx_state = RX_OPCODE;
                 }
                 break;
             case RX_OPCODE:
-                if (rx_data_offset == BT_CTL_HEAD_LEN + BT_CTL_OPCODE_LEN)
-                {
-                    if ((opcode_max > bt_rx_buf[rx_data_offset-1]) || (OPCODE_BT_TEST_CMD == bt_rx_buf[rx_data_offset-1]))
-                    {
-                        rx_state= RX_DATA_LENTH;
-                    }
-                    else
-                    {
-                        // err format, go to head
-                        APP_LOG_DEBUG("invalid %s :0x%02x\r\n", (BT_CTL_IND_HEAD == cmd_head)?"message":"opcode", bt_rx_buf[rx_data_offset-1]);
-
-                        rx_state = RX_HEADER;
-                        buff_orig_idx ++;
-                        rx_data_offset = 0;
-                        buff_idx = 0;
-                        //APP_LOG_RAW_INFO("line %d, return head ptr %02x -->", __LINE__, buf[buff_idx + buff_orig_idx]);
-                    }
-                }
+                broken = (byte >= s_p_rx_frame_type->opcode_max) && (OPCODE_BT_TEST_CMD != byte);
+                s_rx_state = RX_DATA_LENTH;
                 break;
             case RX_DATA_LENTH:
-                if (rx_data_offset == BT_CTL_HEAD_LEN + BT_CTL_OPCODE_LEN + BT_CTL_DATA_LEN)
+                if (s_rx_frame_offset == BT_CTL_DATA_INDEX)
                 {
-                    length = (((uint16_t)bt_rx_buf[rx_data_offset-BT_CTL_DATA_LEN]) | ((uint16_t)bt_rx_buf[rx_data_offset-BT_CTL_DATA_LEN+1]<<8));
-                    if ((BT_MAX_RX_LEN >= length) && (length <= len - BT_CTL_DATA_LEN_MIN))
-                    {
-                        if (length > 0)
-                        {
-                            rx_state = RX_DATA;
-                        }
-                        else
-                        {
+                    s_rx_frame_length = (uint16_t)s_rx_frame[BT_CTL_DATA_INDEX - BT_CTL_DATA_LEN] | ((uint16_t)byte << 8);
+                    broken = (s_rx_frame_length > BT_MAX_RX_LEN);
 #if SUM_CALCULATE
-                            rx_state = RX_SUM;
+                    s_rx_state = (s_rx_frame_length > 0) ? RX_DATA : RX_SUM;
 #else
-                            rx_state = RX_CMP;
+                    s_rx_state = (s_rx_frame_length > 0) ? RX_DATA : RX_CMP;
 #endif
-                        }
-                    }
-                    else
-                    {
-                        APP_LOG_DEBUG("invalid length :%d, len : %d\r\n", length, len);
-                        if (length > len - BT_CTL_DATA_LEN_MIN)
-                        {
-                            rx_data_ref_len = length + BT_CTL_DATA_LEN_MIN;
-                        }
-
-                        // err format, go to head
-                        rx_state = RX_HEADER;
-                        buff_orig_idx ++;
-                        rx_data_offset = 0;
-                        buff_idx = 0;
-                        ret = 1;
-                        //APP_LOG_RAW_INFO("line %d, return head ptr %02x -->", __LINE__, buf[buff_idx + buff_orig_idx]);
-                        return ret;
-                    }
                 }
                 break;
             case RX_DATA:
-                if (rx_data_offset == length + BT_CTL_HEAD_LEN + BT_CTL_OPCODE_LEN + BT_CTL_DATA_LEN)
+                // the data is not checked, go to its end at once
+                s_rx_frame_offset = s_rx_frame_fill;
+                if (s_rx_frame_offset >= BT_CTL_DATA_INDEX + s_rx_frame_length)
                 {
+                    s_rx_frame_offset = BT_CTL_DATA_INDEX + s_rx_frame_length;
 #if SUM_CALCULATE
-                    rx_state = RX_SUM;
+                    s_rx_state = RX_SUM;
 #else
-                    rx_state = RX_CMP;
+                    s_rx_state = RX_CMP;
 #endif
                 }
                 break;
 #if SUM_CALCULATE
             case RX_SUM:
-                checksum = app_bt_calc_checksum(&bt_rx_buf[0], rx_data_offset-1);
-                if (checksum == bt_rx_buf[rx_data_offset-1])
-                {
-                    rx_state = RX_CMP;
-                }
-                else
+                broken = (app_bt_calc_checksum(s_rx_frame, s_rx_frame_offset - 1) != byte);
+                if (broken)
                 {
-                    // err format, go to head
-                    rx_state = RX_HEADER;
-                    buff_orig_idx ++;
-                    rx_data_offset = 0;
-                    buff_idx = 0;
-                    //APP_LOG_RAW_INFO("line %d, return head ptr %02x -->", __LINE__, buf[buff_idx + buff_orig_idx]);
                     APP_LOG_DEBUG("Recevice Command checksum fail");
                 }
+                s_rx_state = RX_CMP;
                 break;
 #endif
             default:
                 break;
         }
 
-        if (rx_state == RX_CMP)
-        {
-            //APP_LOG_DEBUG("deal_message+++++++++++++");
-            app_bt_deal_data(bt_rx_buf, rx_data_offset);
-            // deal done, continue
-            rx_state = RX_HEADER;
-            buff_orig_idx += buff_idx;
-            rx_data_offset = 0;
-            buff_idx = 0;
-
-            has_log = false;
-        }
-        else
-        {
-            has_log = true;
-        }
-
-        // all buffer has been resolved.
-        if ((buff_idx + buff_orig_idx) >= len)
+        if (broken)
         {
-            if ((rx_state != RX_CMP) && (rx_state != RX_HEADER)) //not complete data
-            {
-                ret = 1;
-            }
-            else
+            // not a frame, look for a header again from the next byte
+            if (s_rx_frame_offset > BT_CTL_HEAD_LEN)
             {
-                rx_data_offset = 0;
+                s_rx_stat.frame_err_cnt++;
+                bt_test_mode_w_cnt++;
             }
-            break;
+            s_rx_stat.skipped_bytes++;
+            bt_rx_frame_drop(1);
+        }
+        else if (RX_CMP == s_rx_state)
+        {
+            bt_rx_frame_dispatch();
+            bt_rx_frame_drop(s_rx_frame_offset);
         }
     }
+}
 
-    if (has_log)
+// Take the received bytes in the frame buffer: the header byte per byte, the data of a frame at once.
+static void bt_rx_frame_feed(const uint8_t *p_data, uint32_t len)
+{
+    while (len > 0)
     {
-        bt_test_mode_w_cnt++;
-        APP_LOG_RAW_INFO("other log info: ");
-        while(len--)
+        uint32_t size = 1;
+
+        if (RX_DATA == s_rx_state)
         {
-            APP_LOG_RAW_INFO("%c", *buf);
-            buf++;
+            size = BT_CTL_DATA_INDEX + s_rx_frame_length - s_rx_frame_fill;
         }
-        APP_LOG_RAW_INFO("\r\n");
-    }
+        size = (size > len) ? len : size;
+        size = (size > sizeof(s_rx_frame) - s_rx_frame_fill) ? (sizeof(s_rx_frame) - s_rx_frame_fill) : size;
 
-    if (bt_test_mode_al_cnt == 200)
-    {
-        APP_LOG_INFO("bt_test_mode_l_cnt = %d, bt_test_mode_s_cnt = %d, bt_test_mode_w_cnt = %d, bt_test_mode_al_cnt = %d \r\n",
-                                                                                                                                                                            bt_test_mode_l_cnt,
-                                                                                                                                                                            bt_test_mode_s_cnt,
-                                                                                                                                                                            bt_test_mode_w_cnt,
-                                                                                                                                                                            bt_test_mode_al_cnt);
-    }
+        memcpy(s_rx_frame + s_rx_frame_fill, p_data, size);
+        s_rx_frame_fill += size;
+        p_data += size;
+        len -= size;
 
-    return ret;
+        bt_rx_frame_parse();
+    }
 }
 
-static uint8_t ble_bt_uart_irq_handler(uint8_t *buf, uint16_t len)
+static void ble_bt_uart_irq_handler(void)
 {
-    uint8_t ret = 0;
-    if ((0==(ret = app_bt_buff_rx_format(buf, len))) && (*(int32_t *)BT_DEBUG_MODE_CTL_ADDR != BT_DEBUG_POLLING))
+    // all the data has been resolved, no frame in the middle
+    if ((0 == s_rx_frame_fill) && (*(int32_t *)BT_DEBUG_MODE_CTL_ADDR != BT_DEBUG_POLLING))
     {
 #ifdef BLE_BT_OTA_SUPPORT
         if (bt_ota_state == BT_OTA_IDLE)
@@ -404,7 +361,11 @@ static uint8_t ble_bt_uart_irq_handler(uint8_t *buf, uint16_t len)
         }
     }
 
-    return ret;
+    if (bt_test_mode_al_cnt == 200)
+    {
+        APP_LOG_INFO("bt_test_mode_l_cnt = %d, bt_test_mode_s_cnt = %d, bt_test_mode_w_cnt = %d, bt_test_mode_al_cnt = %d \r\n",
+                     bt_test_mode_l_cnt, bt_test_mode_s_cnt, bt_test_mode_w_cnt, bt_test_mode_al_cnt);
+    }
 }
 
 __WEAK void fast_advertising_start(void)
@@ -449,12 +410,20 @@ void ble_bt_uart_init(void)
        APP_LOG_DEBUG("watch demo uart init failed: 0x%02x", ret);
     }
 
-    app_uart_receive_async(WATCH_DEMO_UART_ID, s_uart_rx_buffer, WATCH_DEMO_UART_BUFF_RX_LEN);
+    ble_bt_uart_rx_start();
 }
 
 void ble_bt_uart_recv_async(void)
 {
-    app_uart_receive_async(WATCH_DEMO_UART_ID, s_uart_rx_buffer, WATCH_DEMO_UART_BUFF_RX_LEN);
+    ble_bt_uart_rx_start();
+}
+
+void ble_bt_uart_rx_stat_get(ble_bt_uart_rx_stat_t *p_stat)
+{
+    if (p_stat != NULL)
+    {
+        *p_stat = s_rx_stat;
+    }
 }
 
 void ble_bt_uart_deinit(void)
@@ -501,60 +470,28 @@ void watch_uart_data_tx_sync_send(uint8_t *p_data, uint16_t length)
 
 void handle_uart_ring_buffer_data(void)
 {
-    uint32_t idx = 0;
+    ring_buffer_span_t spans[2];
     bt_debug_task();
 
-    // check if received data
-    if (s_rx_ring_buffer.read_index != s_rx_ring_buffer.write_index)
+    // check if received data, parse it in place and resume from the same state next time
+    uint32_t data_len = ring_buffer_read_peek(&s_rx_ring_buffer, spans);
+    if (data_len > 0)
     {
-        uint32_t data_len = ring_buffer_items_count_get(&s_rx_ring_buffer);
-        uint8_t* data_buffer = sys_malloc((data_len+rx_data_ref_offset) * sizeof(uint8_t));
-
-        //combine last un-complete data
-        if (ref_data_buffer != NULL)
-        {
-            memcpy(data_buffer, ref_data_buffer, rx_data_ref_offset);
-
-            sys_free(ref_data_buffer);
-            ref_data_buffer = NULL;
-            APP_LOG_DEBUG("continue data process : %d %d", rx_data_ref_len, data_len);
-        }
-        ring_buffer_read(&s_rx_ring_buffer, data_buffer+rx_data_ref_offset, data_len);
-
-        data_len += rx_data_ref_offset;
-        rx_data_ref_offset = 0;
-
-        //check the combined complete data
-        if (rx_data_ref_len)
-        {
-            while(data_len - idx)
-            {
-                APP_LOG_RAW_INFO("%02x", data_buffer[idx]);
-                idx ++;
-            }
-            APP_LOG_RAW_INFO("\r\n");
-        }
-
-        // Process the received data
-        if(ble_bt_uart_irq_handler(data_buffer, data_len) && (rx_data_ref_len > data_len) && (data_len < (2*BT_MAX_RX_LEN)))
-        {
-            if (ref_data_buffer != NULL)
-            {
-                sys_free(ref_data_buffer);
-                ref_data_buffer = NULL;
-            }
+        bt_rx_frame_feed(spans[0].p_data, spans[0].length);
+        bt_rx_frame_feed(spans[1].p_data, spans[1].length);
+        ring_buffer_read_consume(&s_rx_ring_buffer, data_len);
+    }
 
-            //reserve to combine with next data
-            ref_data_buffer = data_buffer;
-            rx_data_ref_offset = data_len;
+    // the ring was full or the driver refused the receive
+    if (s_rx_starved)
+    {
+        s_rx_starved = false;
+        ble_bt_uart_rx_start();
+    }
 
-            APP_LOG_DEBUG("begin data process : %d %d", rx_data_ref_len, data_len);
-        }
-        else
-        {
-            sys_free(data_buffer);
-            data_buffer = NULL;
-        }
+    if (data_len > 0)
+    {
+        ble_bt_uart_irq_handler();
     }
 
 #ifdef BLE_BT_OTA_SUPPORT
@@ -569,7 +506,10 @@ void ble_bt_interface_init(void)
 #ifdef BLE_BT_OTA_SUPPORT
     app_ota_tim_init();
 #endif
-    ring_buffer_init(&s_rx_ring_buffer, s_uart_ring_buffer_data, WATCH_DEMO_UART_BUFF_RX_LEN);
+    ring_buffer_init(&s_rx_ring_buffer, s_uart_ring_buffer_data, WATCH_DEMO_UART_RING_LEN);
+    s_rx_frame_fill   = 0;
+    s_rx_frame_offset = 0;
+    s_rx_state        = RX_HEADER;
     ble_bt_uart_init();
     bt_sniff_state = true;
     app_bt_reset_hw();
@@ -587,6 +527,5 @@ void bt_debug_on_enter_debug_mode(void)
 void bt_debug_open_to_receive(void)
 {
     app_uart_abort(WATCH_DEMO_UART_ID);
-    memset(s_uart_rx_buffer, 0, WATCH_DEMO_UART_BUFF_RX_LEN);
-    app_uart_receive_async(WATCH_DEMO_UART_ID, s_uart_rx_buffer, WATCH_DEMO_UART_BUFF_RX_LEN);
+    ble_bt_uart_rx_start();
 }
@@ -63,6 +63,21 @@
 
 #define WATCH_DEMO_UART_BUFF_RX_LEN     1024
 #define WATCH_DEMO_UART_BUFF_TX_LEN     200
+/******* RX RING, THE UART RECEIVES IN IT UP TO WATCH_DEMO_UART_BUFF_RX_LEN AT ONCE *******/
+#define WATCH_DEMO_UART_RING_LEN        (WATCH_DEMO_UART_BUFF_RX_LEN * 2)
+#define WATCH_DEMO_UART_RING_GUARD_LEN  16
+
+/**@brief BT uart receive statistics. */
+typedef struct
+{
+    uint32_t rx_bytes;          /**< Bytes received. */
+    uint32_t overrun_cnt;       /**< Times the RX ring was full, the UART stopped receiving until it is read. */
+    uint32_t error_cnt;         /**< UART receive errors (e.g. RX FIFO overrun) and receives the driver refused to start. */
+    uint16_t max_burst;         /**< Largest burst received before a RX timeout. */
+    uint32_t frame_cnt;         /**< Frames received and dispatched. */
+    uint32_t frame_err_cnt;     /**< Frames with a valid head but a wrong opcode, length or checksum. */
+    uint32_t skipped_bytes;     /**< Bytes skipped while looking for a frame head (e.g. BT log). */
+} ble_bt_uart_rx_stat_t;
 
 
 /*
@@ -105,6 +120,15 @@ extern void handle_uart_ring_buffer_data(void);
  */
 extern void ble_bt_uart_recv_async(void);
 
+/**
+ *****************************************************************************************
+ * @brief Get the ble <-->BT receive statistics
+ *
+ * @param[out] p_stat: Pointer to the statistics.
+ *****************************************************************************************
+ */
+extern void ble_bt_uart_rx_stat_get(ble_bt_uart_rx_stat_t *p_stat);
+
 /**
  *****************************************************************************************
  * @brief uart init
@@ -601,6 +601,7 @@ void bt_api_msg_handler(void)
 
         reader_fsm.state = state_next;
     }
+    bt_ifce_rx_resume();
 
     // Handle Outgoing Message
     // printf("r: %d, b: %d\n", s_responsed, s_tx_queue[s_tx_idx].buffer);
@@ -45,6 +45,7 @@
 
 #include "app_io.h"
 #include "app_log.h"
+#include "grx_hal.h"
 #include "app_uart.h"
 #include "app_uart_dma.h"
 
@@ -68,16 +69,29 @@
 #define APP_UART_TX(...) app_uart_transmit_async(__VA_ARGS__)
 #endif // BT_IFCE_UART_USE_TX_DMA
 
-#define BT_UART_START_RX()                                                             \
+// Tells the BT controller that the receive is armed
+#define BT_UART_SYNC_PULSE()                                                           \
     do                                                                                 \
     {                                                                                  \
-        APP_UART_RX(BT_IFCE_UART_ID, s_uart_rx_buffer, sizeof(s_uart_rx_buffer));      \
-        s_uart_rx_ongoing = true;                                                      \
         app_io_write_pin(BT_IFCE_SYNC_IO_TYPE, BT_IFCE_SYNC_IO_PIN, APP_IO_PIN_RESET); \
         SYNC_SIGNAL_DELAY();                                                           \
         app_io_write_pin(BT_IFCE_SYNC_IO_TYPE, BT_IFCE_SYNC_IO_PIN, APP_IO_PIN_SET);   \
     } while (0)
 
+#define BT_UART_START_RX()                                                             \
+    do                                                                                 \
+    {                                                                                  \
+        if (!bt_ifce_uart_rx_start())                                                  \
+        {                                                                              \
+            /* Started again by bt_ifce_rx_resume() */                                 \
+            s_rx_starved = true;                                                       \
+            break;                                                                     \
+        }                                                                              \
+        s_rx_starved = false;                                                          \
+        s_uart_rx_ongoing = true;                                                      \
+        BT_UART_SYNC_PULSE();                                                          \
+    } while (0)
+
 #define RETURN_IF_DRV_ERROR(result)    \
     do                                 \
     {                                  \
@@ -92,9 +106,17 @@
  *****************************************************************************************
  */
 static uint8_t s_uart_tx_buffer[BT_IFCE_UART_TX_MAX_LEN];
-static uint8_t s_uart_rx_buffer[BT_IFCE_UART_RX_MAX_LEN];
+// The UART receives straight into the free space of the ring
 static uint8_t s_rx_ring_buffer_data[BT_IFCE_UART_RX_MAX_LEN * 2];
 static ring_buffer_t s_rx_ring_buffer;
+static uint8_t *s_p_rx_region = NULL;
+static uint16_t s_rx_region_size = 0;
+static uint16_t s_rx_burst_len = 0;
+static bt_ifce_rx_stat_t s_rx_stat = {0};
+static volatile bool s_rx_starved = false;
+// The receive went on after a burst filled its region, or is restarted by bt_ifce_rx_resume() after the full
+// ring cut a burst short: no indication is waiting for it, the next one only needs the sync pulse
+static volatile bool s_rx_carried_on = false;
 
 static uint16_t s_pending_data_req = 0;
 static bool s_uart_rx_ongoing = false;
@@ -157,6 +179,13 @@ static void bt_ifce_uart_evt_handler(app_uart_evt_t *p_evt);
  */
 static void app_bt_ifce_io_evt_handler(app_io_evt_t *p_evt);
 
+/**
+ * @brief Start receiving into the free space of the RX ring buffer from its write index
+ *
+ * @return true if started, false if the RX ring buffer is full or the UART driver refused
+ */
+static bool bt_ifce_uart_rx_start(void);
+
 /*
  * GLOBAL FUNCTION DEFINITIONS
  *****************************************************************************************
@@ -222,12 +251,23 @@ ring_buffer_t *bt_ifce_get_rx_ring_buffer()
     return &s_rx_ring_buffer;
 }
 
+void bt_ifce_get_rx_stat(bt_ifce_rx_stat_t *p_stat)
+{
+    if (p_stat != NULL)
+    {
+        *p_stat = s_rx_stat;
+    }
+}
+
 void bt_ifce_hw_reset()
 {
     app_io_write_pin(BT_IFCE_RESET_IO_TYPE, BT_IFCE_RESET_IO_PIN, APP_IO_PIN_RESET);
     delay_ms(100);
     app_io_write_pin(BT_IFCE_RESET_IO_TYPE, BT_IFCE_RESET_IO_PIN, APP_IO_PIN_SET);
-    APP_UART_RX(BT_IFCE_UART_ID, s_uart_rx_buffer, sizeof(s_uart_rx_buffer));
+    if (!bt_ifce_uart_rx_start())
+    {
+        s_rx_starved = true;
+    }
 }
 
 void bt_ifce_send_async(uint8_t *data, uint16_t size)
@@ -278,6 +318,31 @@ void bt_ifce_force_rx(void)
     BT_UART_START_RX();
 }
 
+void bt_ifce_rx_resume(void)
+{
+    bool pulse = false;
+
+    // The UART and IO handlers read and start on the same flags
+    GLOBAL_EXCEPTION_DISABLE();
+    if (s_rx_starved && !s_uart_rx_ongoing)
+    {
+        if (bt_ifce_uart_rx_start())
+        {
+            s_rx_starved = false;
+            s_uart_rx_ongoing = true;
+            // The rest of a burst cut short by the full ring goes on without the sync IO
+            pulse = !s_rx_carried_on;
+        }
+    }
+    GLOBAL_EXCEPTION_ENABLE();
+
+    if (pulse)
+    {
+        // Out of the lock: an indication meanwhile is pended since the receive is marked ongoing
+        BT_UART_SYNC_PULSE();
+    }
+}
+
 __WEAK void bt_ifce_data_available()
 {
 }
@@ -287,30 +352,87 @@ __WEAK void bt_ifce_data_available()
  *****************************************************************************************
  */
 
+static bool bt_ifce_uart_rx_start(void)
+{
+    uint8_t *p_region = NULL;
+    uint32_t size = ring_buffer_write_reserve(&s_rx_ring_buffer, &p_region, BT_IFCE_UART_RX_MAX_LEN);
+
+    if (size == 0)
+    {
+        APP_LOG_ERROR("[BT_IFCE] RingBuffer Full");
+        s_rx_stat.overrun_cnt++;
+        return false;
+    }
+
+    if (APP_UART_RX(BT_IFCE_UART_ID, p_region, (uint16_t)size) != APP_DRV_SUCCESS)
+    {
+        APP_LOG_ERROR("[BT_IFCE] RX Start Failed");
+        s_rx_stat.error_cnt++;
+        return false;
+    }
+
+    s_p_rx_region = p_region;
+    s_rx_region_size = (uint16_t)size;
+
+    return true;
+}
+
 static void bt_ifce_uart_evt_handler(app_uart_evt_t *p_evt)
 {
     if (p_evt->type == APP_UART_EVT_RX_DATA)
     {
+        uint16_t size = p_evt->data.size;
+
+        s_rx_carried_on = false;
+        s_rx_stat.rx_bytes += size;
+        s_rx_burst_len += size;
+
         // TODO: OTA Support
         if (bt_debug_mode_is_active())
         {
-            app_bt_debug_reponse_handle(s_uart_rx_buffer, p_evt->data.size);
+            // Not kept, the region is received again
+            app_bt_debug_reponse_handle(s_p_rx_region, size);
         }
         else
         {
-            if (ring_buffer_write(&s_rx_ring_buffer, s_uart_rx_buffer, p_evt->data.size) != p_evt->data.size)
+            ring_buffer_write_commit(&s_rx_ring_buffer, size);
+            bt_ifce_data_available();
+        }
+
+        if (size == s_rx_region_size)
+        {
+            // Stopped at the end of the region (the end of the ring or the read index), the burst goes on
+            if (bt_ifce_uart_rx_start())
             {
-                APP_LOG_ERROR("[BT_IFCE] RingBuffer Full");
+                // If the burst ended with the region, no RX timeout comes to start the next one
+                if (s_pending_data_req > 0)
+                {
+                    s_pending_data_req--;
+                    BT_UART_SYNC_PULSE();
+                }
+                else
+                {
+                    s_rx_carried_on = true;
+                }
                 return;
             }
+            // Started again by bt_ifce_rx_resume()
+            s_rx_starved = true;
+            s_rx_carried_on = true;
+        }
 
-            bt_ifce_data_available();
+        if (s_rx_burst_len > s_rx_stat.max_burst)
+        {
+            s_rx_stat.max_burst = s_rx_burst_len;
         }
-        memset(s_uart_rx_buffer, 0, p_evt->data.size);
+        s_rx_burst_len = 0;
     }
     else if (p_evt->type == APP_UART_EVT_ERROR)
     {
         APP_LOG_WARNING("[BT_IFCE] RX Error: %d", p_evt->data.error_code);
+        s_rx_stat.error_cnt++;
+        s_rx_burst_len = 0;
+        s_rx_carried_on = false;
         // Add a pending count to start RX proc again
         s_pending_data_req++;
     }
@@ -323,6 +445,7 @@ static void bt_ifce_uart_evt_handler(app_uart_evt_t *p_evt)
     if (s_pending_data_req > 0)
     {
         s_pending_data_req--;
+        s_rx_carried_on = false;
         BT_UART_START_RX();
     }
 }
@@ -330,8 +453,22 @@ static void bt_ifce_uart_evt_handler(app_uart_evt_t *p_evt)
 static void app_bt_ifce_io_evt_handler(app_io_evt_t *p_evt)
 {
     // Data Indication
-    if (s_uart_rx_ongoing)
+    if (s_rx_carried_on)
+    {
+        // No burst is owed to the receive carried on: let the new one in
+        s_rx_carried_on = false;
+        if (s_uart_rx_ongoing)
+        {
+            BT_UART_SYNC_PULSE();
+        }
+        else
+        {
+            BT_UART_START_RX();
+        }
+    }
+    else if (s_uart_rx_ongoing || s_rx_starved)
     {
+        // Started after the current receive, or after the one bt_ifce_rx_resume() starts
         s_pending_data_req++;
     }
     else
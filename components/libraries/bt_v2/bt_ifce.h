@@ -41,6 +41,17 @@
 #include "bt_common.h"
 #include "ring_buffer.h"
 
+/**
+ * @brief Bluetooth Interface receive statistics
+ */
+typedef struct
+{
+    uint32_t rx_bytes;    /**< Bytes received. */
+    uint32_t overrun_cnt; /**< Times the RX ring buffer was full when the receive had to go on. */
+    uint32_t error_cnt;   /**< UART receive errors (e.g. RX FIFO overrun) and receive starts refused by the driver. */
+    uint16_t max_burst;   /**< Largest burst received before a RX timeout. */
+} bt_ifce_rx_stat_t;
+
 /**
  * @brief Init BT module hardware
  *
@@ -55,6 +66,13 @@ uint16_t bt_ifce_init(void);
  */
 ring_buffer_t *bt_ifce_get_rx_ring_buffer(void);
 
+/**
+ * @brief Get the RX statistics
+ *
+ * @param[out] p_stat Pointer to the statistics.
+ */
+void bt_ifce_get_rx_stat(bt_ifce_rx_stat_t *p_stat);
+
 /**
  * @brief Reset BT module via hardware
  *
@@ -96,6 +114,12 @@ void bt_ifce_io_wake(uint32_t pulse_width);
  */
 void bt_ifce_force_rx(void);
 
+/**
+ * @brief Start RX procedure again if it was stopped by a full RX ring buffer
+ * @note Call it after reading the RX ring buffer.
+ */
+void bt_ifce_rx_resume(void);
+
 /**
  * @brief BT data available callback
  * @note This function should not be modified. When the callback is needed,
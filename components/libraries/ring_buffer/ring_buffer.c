@@ -51,6 +51,24 @@
 #define RING_BUFFER_LOCK()      GLOBAL_EXCEPTION_DISABLE()
 #define RING_BUFFER_UNLOCK()    GLOBAL_EXCEPTION_ENABLE()
 #define RING_BUFFER_SIZE_MIN    (1)
+#define RING_BUFFER_BARRIER()   __DMB()
+
+/*
+ * LOCAL FUNCTION DEFINITIONS
+ *****************************************************************************************
+ */
+// One byte is always kept free to tell a full buffer from an empty one.
+static uint32_t ring_buffer_space_calc(uint32_t buffer_size, uint32_t wr_idx, uint32_t rd_idx)
+{
+    if (rd_idx > wr_idx)
+    {
+        return rd_idx - wr_idx - 1;
+    }
+    else
+    {
+        return buffer_size - wr_idx + rd_idx - 1;
+    }
+}
 
 /*
  * GLOBAL FUNCTION DEFINITIONS
@@ -300,3 +318,149 @@ void ring_buffer_clean(ring_buffer_t *p_ring_buff)
     RING_BUFFER_UNLOCK();
 }
 
+uint32_t ring_buffer_write_reserve(ring_buffer_t *p_ring_buff, uint8_t **pp_wr_data, uint32_t length)
+{
+    uint32_t contiguous;
+
+    if ((NULL == p_ring_buff) || (NULL == p_ring_buff->p_buffer) || (NULL == pp_wr_data))
+    {
+        return 0;
+    }
+
+    uint32_t wr_idx = p_ring_buff->write_index;
+    uint32_t rd_idx = p_ring_buff->read_index;
+
+    if (rd_idx > wr_idx)
+    {
+        contiguous = rd_idx - wr_idx - 1;
+    }
+    else
+    {
+        // Up to the end of the buffer, but not onto the read index when it is at 0
+        contiguous = p_ring_buff->buffer_size - wr_idx - ((0 == rd_idx) ? 1 : 0);
+    }
+
+    // The consumer is done with the region before it is written again
+    RING_BUFFER_BARRIER();
+
+    *pp_wr_data = p_ring_buff->p_buffer + wr_idx;
+
+    return (length > contiguous ? contiguous : length);
+}
+
+void ring_buffer_write_commit(ring_buffer_t *p_ring_buff, uint32_t length)
+{
+    if ((NULL == p_ring_buff) || (0 == length))
+    {
+        return;
+    }
+
+    uint32_t wr_idx = p_ring_buff->write_index + length;
+
+    if (wr_idx >= p_ring_buff->buffer_size)
+    {
+        wr_idx -= p_ring_buff->buffer_size;
+    }
+
+    // The data is written before the consumer can see it
+    RING_BUFFER_BARRIER();
+
+    p_ring_buff->write_index = wr_idx;
+}
+
+uint32_t ring_buffer_read_peek(ring_buffer_t *p_ring_buff, ring_buffer_span_t spans[2])
+{
+    if ((NULL == p_ring_buff) || (NULL == p_ring_buff->p_buffer) || (NULL == spans))
+    {
+        return 0;
+    }
+
+    uint32_t wr_idx = p_ring_buff->write_index;
+    uint32_t rd_idx = p_ring_buff->read_index;
+
+    // The data is not read before the producer published it
+    RING_BUFFER_BARRIER();
+
+    spans[0].p_data = p_ring_buff->p_buffer + rd_idx;
+    spans[1].p_data = p_ring_buff->p_buffer;
+
+    if (wr_idx >= rd_idx)
+    {
+        spans[0].length = wr_idx - rd_idx;
+        spans[1].length = 0;
+    }
+    else
+    {
+        spans[0].length = p_ring_buff->buffer_size - rd_idx;
+        spans[1].length = wr_idx;
+    }
+
+    return spans[0].length + spans[1].length;
+}
+
+void ring_buffer_read_consume(ring_buffer_t *p_ring_buff, uint32_t length)
+{
+    if ((NULL == p_ring_buff) || (0 == length))
+    {
+        return;
+    }
+
+    uint32_t rd_idx = p_ring_buff->read_index + length;
+
+    if (rd_idx >= p_ring_buff->buffer_size)
+    {
+        rd_idx -= p_ring_buff->buffer_size;
+    }
+
+    // The data is read before the producer can overwrite it
+    RING_BUFFER_BARRIER();
+
+    p_ring_buff->read_index = rd_idx;
+}
+
+uint32_t ring_buffer_spsc_write(ring_buffer_t *p_ring_buff, uint8_t const *p_wr_data, uint32_t length)
+{
+    if ((NULL == p_ring_buff) || (NULL == p_ring_buff->p_buffer) || (NULL == p_wr_data))
+    {
+        return 0;
+    }
+
+    uint32_t wr_idx        = p_ring_buff->write_index;
+    uint32_t surplus_space = ring_buffer_space_calc(p_ring_buff->buffer_size, wr_idx, p_ring_buff->read_index);
+
+    length = (length > surplus_space ? surplus_space : length);
+
+    uint32_t first = p_ring_buff->buffer_size - wr_idx;
+
+    first = (length > first ? first : length);
+
+    RING_BUFFER_BARRIER();
+
+    memcpy(p_ring_buff->p_buffer + wr_idx, p_wr_data, first);
+    memcpy(p_ring_buff->p_buffer, p_wr_data + first, length - first);
+    ring_buffer_write_commit(p_ring_buff, length);
+
+    return length;
+}
+
+uint32_t ring_buffer_spsc_read(ring_buffer_t *p_ring_buff, uint8_t *p_rd_data, uint32_t length)
+{
+    ring_buffer_span_t spans[2];
+
+    if ((NULL == p_ring_buff) || (NULL == p_ring_buff->p_buffer) || (NULL == p_rd_data))
+    {
+        return 0;
+    }
+
+    uint32_t items_avail = ring_buffer_read_peek(p_ring_buff, spans);
+
+    length = (length > items_avail ? items_avail : length);
+
+    uint32_t first = (length > spans[0].length ? spans[0].length : length);
+
+    memcpy(p_rd_data, spans[0].p_data, first);
+    memcpy(p_rd_data + first, spans[1].p_data, length - first);
+    ring_buffer_read_consume(p_ring_buff, length);
+
+    return length;
+}
@@ -52,9 +52,16 @@ typedef struct
 {
     uint32_t             buffer_size;           /**< Size of ring buffer. */
     uint8_t             *p_buffer;              /**< Pointer to buffer saved data. */
-    uint32_t             write_index;           /**< Index of write. */
-    uint32_t             read_index;            /**< Index of read. */
+    volatile uint32_t    write_index;           /**< Index of write, only moved by the producer. */
+    volatile uint32_t    read_index;            /**< Index of read, only moved by the consumer. */
 } ring_buffer_t;
+
+/**@brief Contiguous span of data in one ring buffer. */
+typedef struct
+{
+    uint8_t             *p_data;                /**< Pointer to the first byte of the span. */
+    uint32_t             length;                /**< Length of the span. */
+} ring_buffer_span_t;
 /** @} */
 
 /**
@@ -158,6 +165,83 @@ void ring_buffer_clean(ring_buffer_t *p_ring_buff);
  *****************************************************************************************
  */
 bool ring_buffer_is_reach_left_threshold(ring_buffer_t *p_ring_buff, uint32_t letf_threshold);
+
+/**
+ *****************************************************************************************
+ * @brief Write data to one ring buffer without lock.
+ *
+ * @note The lock-free APIs (ring_buffer_spsc_*, reserve/commit and peek/consume) are only
+ *       safe with one producer and one consumer, e.g. one interrupt writes and one task reads.
+ *       Only the producer moves write_index and only the consumer moves read_index.
+ *
+ * @param[in] p_ring_buff: Pointer to ring buffer.
+ * @param[in] p_wr_data:   Pointer to data need be wrote.
+ * @param[in] length:      Length of data need be wrote.
+ *
+ * @return Length of writen.
+ *****************************************************************************************
+ */
+uint32_t ring_buffer_spsc_write(ring_buffer_t *p_ring_buff, uint8_t const *p_wr_data, uint32_t length);
+
+/**
+ *****************************************************************************************
+ * @brief Read data from one ring buffer without lock, see @ref ring_buffer_spsc_write.
+ *
+ * @param[in] p_ring_buff: Pointer to ring buffer.
+ * @param[in] p_rd_data:   Pointer to where save read data.
+ * @param[in] length:      Length of data want to read.
+ *
+ * @return Length of availdble read data.
+ *****************************************************************************************
+ */
+uint32_t ring_buffer_spsc_read(ring_buffer_t *p_ring_buff, uint8_t *p_rd_data, uint32_t length);
+
+/**
+ *****************************************************************************************
+ * @brief Reserve a contiguous region to write in place (e.g. by DMA), lock-free.
+ *
+ * @param[in]  p_ring_buff: Pointer to ring buffer.
+ * @param[out] pp_wr_data:  Pointer to the first byte of the region.
+ * @param[in]  length:      Length wanted.
+ *
+ * @return Length of the region, may be less than wanted at the end of the buffer.
+ *         The data is only visible to the consumer after @ref ring_buffer_write_commit.
+ *****************************************************************************************
+ */
+uint32_t ring_buffer_write_reserve(ring_buffer_t *p_ring_buff, uint8_t **pp_wr_data, uint32_t length);
+
+/**
+ *****************************************************************************************
+ * @brief Publish the data written in the reserved region.
+ *
+ * @param[in] p_ring_buff: Pointer to ring buffer.
+ * @param[in] length:      Length written, not more than the reserved length.
+ *****************************************************************************************
+ */
+void ring_buffer_write_commit(ring_buffer_t *p_ring_buff, uint32_t length);
+
+/**
+ *****************************************************************************************
+ * @brief Get the availdble data in place without copy, lock-free.
+ *
+ * @param[in]  p_ring_buff: Pointer to ring buffer.
+ * @param[out] spans:       The data in order, spans[1] is the wrapped part at the start of
+ *                          the buffer (length 0 if the data is contiguous).
+ *
+ * @return Length of availdble data.
+ *****************************************************************************************
+ */
+uint32_t ring_buffer_read_peek(ring_buffer_t *p_ring_buff, ring_buffer_span_t spans[2]);
+
+/**
+ *****************************************************************************************
+ * @brief Release the data handled in place, the producer can write there again.
+ *
+ * @param[in] p_ring_buff: Pointer to ring buffer.
+ * @param[in] length:      Length handled, not more than the peeked length.
+ *****************************************************************************************
+ */
+void ring_buffer_read_consume(ring_buffer_t *p_ring_buff, uint32_t length);
 /** @} */
 
 #endif
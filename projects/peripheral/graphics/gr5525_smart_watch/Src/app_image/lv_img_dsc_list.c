@@ -14,325 +14,325 @@ extern const uint8_t BINARY_RESOURCES[];
 
 const lv_img_dsc_t wd_img_10_power_off = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1570,
     .data = BINARY_RESOURCES + OFFSET_10_POWER_OFF,
 };
 
 const lv_img_dsc_t wd_img_1_scan_device = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1560,
     .data = BINARY_RESOURCES + OFFSET_1_SCAN_DEVICE,
 };
 
 const lv_img_dsc_t wd_img_2_bond_device = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1392,
     .data = BINARY_RESOURCES + OFFSET_2_BOND_DEVICE,
 };
 
 const lv_img_dsc_t wd_img_3_reconnecton_control = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1444,
     .data = BINARY_RESOURCES + OFFSET_3_RECONNECTON_CONTROL,
 };
 
 const lv_img_dsc_t wd_img_4_reconnecton_times = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1716,
     .data = BINARY_RESOURCES + OFFSET_4_RECONNECTON_TIMES,
 };
 
 const lv_img_dsc_t wd_img_5_enter_aniff = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1608,
     .data = BINARY_RESOURCES + OFFSET_5_ENTER_ANIFF,
 };
 
 const lv_img_dsc_t wd_img_6_aniff_period = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1514,
     .data = BINARY_RESOURCES + OFFSET_6_ANIFF_PERIOD,
 };
 
 const lv_img_dsc_t wd_img_7_version = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1654,
     .data = BINARY_RESOURCES + OFFSET_7_VERSION,
 };
 
 const lv_img_dsc_t wd_img_8_restore_setting = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1484,
     .data = BINARY_RESOURCES + OFFSET_8_RESTORE_SETTING,
 };
 
 const lv_img_dsc_t wd_img_9_ota = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1660,
     .data = BINARY_RESOURCES + OFFSET_9_OTA,
 };
 
 const lv_img_dsc_t wd_img_app_01_workout = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 3822,
     .data = BINARY_RESOURCES + OFFSET_APP_01_WORKOUT,
 };
 
 const lv_img_dsc_t wd_img_app_02_activity = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 6324,
     .data = BINARY_RESOURCES + OFFSET_APP_02_ACTIVITY,
 };
 
 const lv_img_dsc_t wd_img_app_03_hr = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 7210,
     .data = BINARY_RESOURCES + OFFSET_APP_03_HR,
 };
 
 const lv_img_dsc_t wd_img_app_04_stopwatch = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 4846,
     .data = BINARY_RESOURCES + OFFSET_APP_04_STOPWATCH,
 };
 
 const lv_img_dsc_t wd_img_app_05_spo2 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 7746,
     .data = BINARY_RESOURCES + OFFSET_APP_05_SPO2,
 };
 
 const lv_img_dsc_t wd_img_app_06_events = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 2832,
     .data = BINARY_RESOURCES + OFFSET_APP_06_EVENTS,
 };
 
 const lv_img_dsc_t wd_img_app_07_settings = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 6216,
     .data = BINARY_RESOURCES + OFFSET_APP_07_SETTINGS,
 };
 
 const lv_img_dsc_t wd_img_black_clock_face = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 360,
     .header.h = 360,
-    .data_size = 259200,
+    .data_size = 41650,
     .data = BINARY_RESOURCES + OFFSET_BLACK_CLOCK_FACE,
 };
 
 const lv_img_dsc_t wd_img_black_clock_step = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 30,
-    .data_size = 1560,
+    .data_size = 1298,
     .data = BINARY_RESOURCES + OFFSET_BLACK_CLOCK_STEP,
 };
 
 const lv_img_dsc_t wd_img_black_clock_sun = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 23,
     .header.h = 23,
-    .data_size = 1058,
+    .data_size = 660,
     .data = BINARY_RESOURCES + OFFSET_BLACK_CLOCK_SUN,
 };
 
 const lv_img_dsc_t wd_img_black_clock_thumbnail = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 214,
     .header.h = 214,
-    .data_size = 91592,
+    .data_size = 35040,
     .data = BINARY_RESOURCES + OFFSET_BLACK_CLOCK_THUMBNAIL,
 };
 
 const lv_img_dsc_t wd_img_bt_device_management = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1794,
     .data = BINARY_RESOURCES + OFFSET_BT_DEVICE_MANAGEMENT,
 };
 
 const lv_img_dsc_t wd_img_bt_device_music = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 3838,
     .data = BINARY_RESOURCES + OFFSET_BT_DEVICE_MUSIC,
 };
 
 const lv_img_dsc_t wd_img_bt_device_phonecall = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 3768,
     .data = BINARY_RESOURCES + OFFSET_BT_DEVICE_PHONECALL,
 };
 
 const lv_img_dsc_t wd_img_bt_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 72,
     .header.h = 72,
-    .data_size = 10368,
+    .data_size = 4564,
     .data = BINARY_RESOURCES + OFFSET_BT_ICON,
 };
 
 const lv_img_dsc_t wd_img_calls = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1654,
     .data = BINARY_RESOURCES + OFFSET_CALLS,
 };
 
 const lv_img_dsc_t wd_img_call_accept_large = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 7436,
     .data = BINARY_RESOURCES + OFFSET_CALL_ACCEPT_LARGE,
 };
 
 const lv_img_dsc_t wd_img_call_dial = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 60,
     .header.h = 60,
-    .data_size = 7200,
+    .data_size = 2324,
     .data = BINARY_RESOURCES + OFFSET_CALL_DIAL,
 };
 
 const lv_img_dsc_t wd_img_call_hang_up = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 220,
     .header.h = 60,
-    .data_size = 26400,
+    .data_size = 6588,
     .data = BINARY_RESOURCES + OFFSET_CALL_HANG_UP,
 };
 
 const lv_img_dsc_t wd_img_call_mute = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 60,
     .header.h = 60,
-    .data_size = 7200,
+    .data_size = 2274,
     .data = BINARY_RESOURCES + OFFSET_CALL_MUTE,
 };
 
 const lv_img_dsc_t wd_img_call_mute_disabled = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 60,
     .header.h = 60,
-    .data_size = 7200,
+    .data_size = 2230,
     .data = BINARY_RESOURCES + OFFSET_CALL_MUTE_DISABLED,
 };
 
 const lv_img_dsc_t wd_img_call_mute_large = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 3284,
     .data = BINARY_RESOURCES + OFFSET_CALL_MUTE_LARGE,
 };
 
 const lv_img_dsc_t wd_img_call_mute_large_disabled = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 3206,
     .data = BINARY_RESOURCES + OFFSET_CALL_MUTE_LARGE_DISABLED,
 };
 
 const lv_img_dsc_t wd_img_call_reject_large = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 6968,
     .data = BINARY_RESOURCES + OFFSET_CALL_REJECT_LARGE,
 };
 
 const lv_img_dsc_t wd_img_call_volume = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 60,
     .header.h = 60,
-    .data_size = 7200,
+    .data_size = 2424,
     .data = BINARY_RESOURCES + OFFSET_CALL_VOLUME,
 };
 
 const lv_img_dsc_t wd_img_calories_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 28,
     .header.h = 28,
-    .data_size = 1568,
+    .data_size = 1108,
     .data = BINARY_RESOURCES + OFFSET_CALORIES_ICON,
 };
 
@@ -347,37 +347,37 @@ const lv_img_dsc_t wd_img_chevron_right = {
 
 const lv_img_dsc_t wd_img_connect_icon_off = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 14,
-    .data_size = 728,
+    .data_size = 438,
     .data = BINARY_RESOURCES + OFFSET_CONNECT_ICON_OFF,
 };
 
 const lv_img_dsc_t wd_img_connect_icon_on = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 14,
-    .data_size = 728,
+    .data_size = 476,
     .data = BINARY_RESOURCES + OFFSET_CONNECT_ICON_ON,
 };
 
 const lv_img_dsc_t wd_img_contacts = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1514,
     .data = BINARY_RESOURCES + OFFSET_CONTACTS,
 };
 
 const lv_img_dsc_t wd_img_dial = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 1680,
     .data = BINARY_RESOURCES + OFFSET_DIAL,
 };
 
@@ -392,145 +392,145 @@ const lv_img_dsc_t wd_img_dial_backspace = {
 
 const lv_img_dsc_t wd_img_dial_number_0 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1308,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_0,
 };
 
 const lv_img_dsc_t wd_img_dial_number_1 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1056,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_1,
 };
 
 const lv_img_dsc_t wd_img_dial_number_2 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1090,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_2,
 };
 
 const lv_img_dsc_t wd_img_dial_number_3 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1088,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_3,
 };
 
 const lv_img_dsc_t wd_img_dial_number_4 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1158,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_4,
 };
 
 const lv_img_dsc_t wd_img_dial_number_5 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1054,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_5,
 };
 
 const lv_img_dsc_t wd_img_dial_number_6 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1228,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_6,
 };
 
 const lv_img_dsc_t wd_img_dial_number_7 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1032,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_7,
 };
 
 const lv_img_dsc_t wd_img_dial_number_8 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1324,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_8,
 };
 
 const lv_img_dsc_t wd_img_dial_number_9 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 74,
     .header.h = 56,
-    .data_size = 8288,
+    .data_size = 1212,
     .data = BINARY_RESOURCES + OFFSET_DIAL_NUMBER_9,
 };
 
 const lv_img_dsc_t wd_img_digital2_consume_small = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 16,
     .header.h = 20,
-    .data_size = 640,
+    .data_size = 414,
     .data = BINARY_RESOURCES + OFFSET_DIGITAL2_CONSUME_SMALL,
 };
 
 const lv_img_dsc_t wd_img_digital2_exercise_small = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 18,
     .header.h = 20,
-    .data_size = 720,
+    .data_size = 606,
     .data = BINARY_RESOURCES + OFFSET_DIGITAL2_EXERCISE_SMALL,
 };
 
 const lv_img_dsc_t wd_img_digital2_heart_small = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 22,
     .header.h = 18,
-    .data_size = 792,
+    .data_size = 430,
     .data = BINARY_RESOURCES + OFFSET_DIGITAL2_HEART_SMALL,
 };
 
 const lv_img_dsc_t wd_img_digital_clock_thumbnail = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 214,
     .header.h = 214,
-    .data_size = 91592,
+    .data_size = 29720,
     .data = BINARY_RESOURCES + OFFSET_DIGITAL_CLOCK_THUMBNAIL,
 };
 
 const lv_img_dsc_t wd_img_distance_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 28,
     .header.h = 28,
-    .data_size = 1568,
+    .data_size = 1076,
     .data = BINARY_RESOURCES + OFFSET_DISTANCE_ICON,
 };
 
 const lv_img_dsc_t wd_img_heartrate_background = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 270,
     .header.h = 144,
-    .data_size = 77760,
+    .data_size = 3020,
     .data = BINARY_RESOURCES + OFFSET_HEARTRATE_BACKGROUND,
 };
 
@@ -545,244 +545,244 @@ const lv_img_dsc_t wd_img_heartrate_lower = {
 
 const lv_img_dsc_t wd_img_heartrate_upper = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 20,
     .header.h = 16,
-    .data_size = 640,
+    .data_size = 522,
     .data = BINARY_RESOURCES + OFFSET_HEARTRATE_UPPER,
 };
 
 const lv_img_dsc_t wd_img_heart_icon_50 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 50,
     .header.h = 50,
-    .data_size = 5000,
+    .data_size = 3518,
     .data = BINARY_RESOURCES + OFFSET_HEART_ICON_50,
 };
 
 const lv_img_dsc_t wd_img_heart_icon_70 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 70,
     .header.h = 70,
-    .data_size = 9800,
+    .data_size = 5360,
     .data = BINARY_RESOURCES + OFFSET_HEART_ICON_70,
 };
 
 const lv_img_dsc_t wd_img_incoming_call_reminder = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 32,
     .header.h = 32,
-    .data_size = 2048,
+    .data_size = 1508,
     .data = BINARY_RESOURCES + OFFSET_INCOMING_CALL_REMINDER,
 };
 
 const lv_img_dsc_t wd_img_music_backward = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 36,
     .header.h = 32,
-    .data_size = 2304,
+    .data_size = 712,
     .data = BINARY_RESOURCES + OFFSET_MUSIC_BACKWARD,
 };
 
 const lv_img_dsc_t wd_img_music_forward = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 36,
     .header.h = 32,
-    .data_size = 2304,
+    .data_size = 712,
     .data = BINARY_RESOURCES + OFFSET_MUSIC_FORWARD,
 };
 
 const lv_img_dsc_t wd_img_music_pause = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 6904,
     .data = BINARY_RESOURCES + OFFSET_MUSIC_PAUSE,
 };
 
 const lv_img_dsc_t wd_img_music_play = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 6812,
     .data = BINARY_RESOURCES + OFFSET_MUSIC_PLAY,
 };
 
 const lv_img_dsc_t wd_img_notification_del_all = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 200,
     .header.h = 48,
-    .data_size = 19200,
+    .data_size = 3374,
     .data = BINARY_RESOURCES + OFFSET_NOTIFICATION_DEL_ALL,
 };
 
 const lv_img_dsc_t wd_img_notification_del_msg_btn = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 60,
     .header.h = 92,
-    .data_size = 11040,
+    .data_size = 1752,
     .data = BINARY_RESOURCES + OFFSET_NOTIFICATION_DEL_MSG_BTN,
 };
 
 const lv_img_dsc_t wd_img_notification_msg_wechat = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 48,
     .header.h = 48,
-    .data_size = 4608,
+    .data_size = 2584,
     .data = BINARY_RESOURCES + OFFSET_NOTIFICATION_MSG_WECHAT,
 };
 
 const lv_img_dsc_t wd_img_notification_title = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 110,
     .header.h = 20,
-    .data_size = 4400,
+    .data_size = 2680,
     .data = BINARY_RESOURCES + OFFSET_NOTIFICATION_TITLE,
 };
 
 const lv_img_dsc_t wd_img_quick_elc_100 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 12,
-    .data_size = 624,
+    .data_size = 300,
     .data = BINARY_RESOURCES + OFFSET_QUICK_ELC_100,
 };
 
 const lv_img_dsc_t wd_img_quick_elc_20 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 12,
-    .data_size = 624,
+    .data_size = 312,
     .data = BINARY_RESOURCES + OFFSET_QUICK_ELC_20,
 };
 
 const lv_img_dsc_t wd_img_quick_elc_40 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 12,
-    .data_size = 624,
+    .data_size = 316,
     .data = BINARY_RESOURCES + OFFSET_QUICK_ELC_40,
 };
 
 const lv_img_dsc_t wd_img_quick_elc_5 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 12,
-    .data_size = 624,
+    .data_size = 304,
     .data = BINARY_RESOURCES + OFFSET_QUICK_ELC_5,
 };
 
 const lv_img_dsc_t wd_img_quick_elc_60 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 12,
-    .data_size = 624,
+    .data_size = 316,
     .data = BINARY_RESOURCES + OFFSET_QUICK_ELC_60,
 };
 
 const lv_img_dsc_t wd_img_quick_elc_80 = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 26,
     .header.h = 12,
-    .data_size = 624,
+    .data_size = 316,
     .data = BINARY_RESOURCES + OFFSET_QUICK_ELC_80,
 };
 
 const lv_img_dsc_t wd_img_quick_tab_about = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 2280,
     .data = BINARY_RESOURCES + OFFSET_QUICK_TAB_ABOUT,
 };
 
 const lv_img_dsc_t wd_img_quick_tab_brightness = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 3210,
     .data = BINARY_RESOURCES + OFFSET_QUICK_TAB_BRIGHTNESS,
 };
 
 const lv_img_dsc_t wd_img_quick_tab_dont_off = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 2644,
     .data = BINARY_RESOURCES + OFFSET_QUICK_TAB_DONT_OFF,
 };
 
 const lv_img_dsc_t wd_img_quick_tab_dont_on = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 2644,
     .data = BINARY_RESOURCES + OFFSET_QUICK_TAB_DONT_ON,
 };
 
 const lv_img_dsc_t wd_img_quick_tab_flashlight = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 2606,
     .data = BINARY_RESOURCES + OFFSET_QUICK_TAB_FLASHLIGHT,
 };
 
 const lv_img_dsc_t wd_img_quick_tab_setting = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 3232,
     .data = BINARY_RESOURCES + OFFSET_QUICK_TAB_SETTING,
 };
 
 const lv_img_dsc_t wd_img_quick_tab_taiwan_off = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 2928,
     .data = BINARY_RESOURCES + OFFSET_QUICK_TAB_TAIWAN_OFF,
 };
 
 const lv_img_dsc_t wd_img_quick_tab_taiwan_on = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 80,
     .header.h = 80,
-    .data_size = 12800,
+    .data_size = 2928,
     .data = BINARY_RESOURCES + OFFSET_QUICK_TAB_TAIWAN_ON,
 };
 
 const lv_img_dsc_t wd_img_step_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 28,
     .header.h = 28,
-    .data_size = 1568,
+    .data_size = 1204,
     .data = BINARY_RESOURCES + OFFSET_STEP_ICON,
 };
 
@@ -797,82 +797,82 @@ const lv_img_dsc_t wd_img_vivid_clock_hr = {
 
 const lv_img_dsc_t wd_img_vivid_clock_thumbnail = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 214,
     .header.h = 214,
-    .data_size = 91592,
+    .data_size = 64650,
     .data = BINARY_RESOURCES + OFFSET_VIVID_CLOCK_THUMBNAIL,
 };
 
 const lv_img_dsc_t wd_img_volume_control_background = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 220,
     .header.h = 50,
-    .data_size = 22000,
+    .data_size = 1104,
     .data = BINARY_RESOURCES + OFFSET_VOLUME_CONTROL_BACKGROUND,
 };
 
 const lv_img_dsc_t wd_img_volume_control_indicator = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 132,
     .header.h = 4,
-    .data_size = 1056,
+    .data_size = 436,
     .data = BINARY_RESOURCES + OFFSET_VOLUME_CONTROL_INDICATOR,
 };
 
 const lv_img_dsc_t wd_img_volume_down = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 12,
     .header.h = 12,
-    .data_size = 288,
+    .data_size = 112,
     .data = BINARY_RESOURCES + OFFSET_VOLUME_DOWN,
 };
 
 const lv_img_dsc_t wd_img_volume_down_disabled = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 12,
     .header.h = 12,
-    .data_size = 288,
+    .data_size = 112,
     .data = BINARY_RESOURCES + OFFSET_VOLUME_DOWN_DISABLED,
 };
 
 const lv_img_dsc_t wd_img_volume_up = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 12,
     .header.h = 12,
-    .data_size = 288,
+    .data_size = 196,
     .data = BINARY_RESOURCES + OFFSET_VOLUME_UP,
 };
 
 const lv_img_dsc_t wd_img_volume_up_disabled = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 12,
     .header.h = 12,
-    .data_size = 288,
+    .data_size = 196,
     .data = BINARY_RESOURCES + OFFSET_VOLUME_UP_DISABLED,
 };
 
 const lv_img_dsc_t wd_img_watchface_bg = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 360,
     .header.h = 360,
-    .data_size = 259200,
+    .data_size = 84666,
     .data = BINARY_RESOURCES + OFFSET_WATCHFACE_BG,
 };
 
 const lv_img_dsc_t wd_img_watchface_icon_battery = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 19,
     .header.h = 19,
-    .data_size = 722,
+    .data_size = 630,
     .data = BINARY_RESOURCES + OFFSET_WATCHFACE_ICON_BATTERY,
 };
 
@@ -896,64 +896,64 @@ const lv_img_dsc_t wd_img_watchface_icon_hr = {
 
 const lv_img_dsc_t wd_img_watchface_icon_step = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 22,
     .header.h = 19,
-    .data_size = 836,
+    .data_size = 660,
     .data = BINARY_RESOURCES + OFFSET_WATCHFACE_ICON_STEP,
 };
 
 const lv_img_dsc_t wd_img_weather_clear = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 40,
     .header.h = 40,
-    .data_size = 3200,
+    .data_size = 892,
     .data = BINARY_RESOURCES + OFFSET_WEATHER_CLEAR,
 };
 
 const lv_img_dsc_t wd_img_weather_moonrise_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 20,
     .header.h = 20,
-    .data_size = 800,
+    .data_size = 588,
     .data = BINARY_RESOURCES + OFFSET_WEATHER_MOONRISE_ICON,
 };
 
 const lv_img_dsc_t wd_img_weather_moonset_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 20,
     .header.h = 20,
-    .data_size = 800,
+    .data_size = 586,
     .data = BINARY_RESOURCES + OFFSET_WEATHER_MOONSET_ICON,
 };
 
 const lv_img_dsc_t wd_img_weather_moon_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 20,
     .header.h = 20,
-    .data_size = 800,
+    .data_size = 682,
     .data = BINARY_RESOURCES + OFFSET_WEATHER_MOON_ICON,
 };
 
 const lv_img_dsc_t wd_img_weather_sunrise_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 20,
     .header.h = 20,
-    .data_size = 800,
+    .data_size = 510,
     .data = BINARY_RESOURCES + OFFSET_WEATHER_SUNRISE_ICON,
 };
 
 const lv_img_dsc_t wd_img_weather_sunset_icon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 20,
     .header.h = 20,
-    .data_size = 800,
+    .data_size = 506,
     .data = BINARY_RESOURCES + OFFSET_WEATHER_SUNSET_ICON,
 };
 
@@ -968,19 +968,19 @@ const lv_img_dsc_t wd_img_weather_sun_icon = {
 
 const lv_img_dsc_t wd_img_weather_thunderstorm = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 40,
     .header.h = 40,
-    .data_size = 3200,
+    .data_size = 1000,
     .data = BINARY_RESOURCES + OFFSET_WEATHER_THUNDERSTORM,
 };
 
 const lv_img_dsc_t wd_img_weather_typhoon = {
     .header.always_zero = 0,
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .header.cf = LV_IMG_CF_GDX_RLE_RGB565,
     .header.w = 40,
     .header.h = 40,
-    .data_size = 3200,
+    .data_size = 752,
     .data = BINARY_RESOURCES + OFFSET_WEATHER_TYPHOON,
 };
 
@@ -5,173 +5,173 @@
 #include "lv_port_gximg.h"
 
 #define OFFSET_10_POWER_OFF              0x0
-#define OFFSET_1_SCAN_DEVICE             0x1200
-#define OFFSET_2_BOND_DEVICE             0x2400
-#define OFFSET_3_RECONNECTON_CONTROL     0x3600
-#define OFFSET_4_RECONNECTON_TIMES       0x4800
-#define OFFSET_5_ENTER_ANIFF             0x5a00
-#define OFFSET_6_ANIFF_PERIOD            0x6c00
-#define OFFSET_7_VERSION                 0x7e00
-#define OFFSET_8_RESTORE_SETTING         0x9000
-#define OFFSET_9_OTA                     0xa200
-#define OFFSET_APP_01_WORKOUT            0xb400
-#define OFFSET_APP_02_ACTIVITY           0xe600
-#define OFFSET_APP_03_HR                 0x11800
-#define OFFSET_APP_04_STOPWATCH          0x14a00
-#define OFFSET_APP_05_SPO2               0x17c00
-#define OFFSET_APP_06_EVENTS             0x1ae00
-#define OFFSET_APP_07_SETTINGS           0x1e000
-#define OFFSET_BLACK_CLOCK_FACE          0x21200
-#define OFFSET_BLACK_CLOCK_STEP          0x60680
-#define OFFSET_BLACK_CLOCK_SUN           0x60c98
-#define OFFSET_BLACK_CLOCK_THUMBNAIL     0x610ba
-#define OFFSET_BT_DEVICE_MANAGEMENT      0x77682
-#define OFFSET_BT_DEVICE_MUSIC           0x78882
-#define OFFSET_BT_DEVICE_PHONECALL       0x79a82
-#define OFFSET_BT_ICON                   0x7ac82
-#define OFFSET_CALLS                     0x7d502
-#define OFFSET_CALL_ACCEPT_LARGE         0x7e702
-#define OFFSET_CALL_DIAL                 0x81902
-#define OFFSET_CALL_HANG_UP              0x83522
-#define OFFSET_CALL_MUTE                 0x89c42
-#define OFFSET_CALL_MUTE_DISABLED        0x8b862
-#define OFFSET_CALL_MUTE_LARGE           0x8d482
-#define OFFSET_CALL_MUTE_LARGE_DISABLED  0x90682
-#define OFFSET_CALL_REJECT_LARGE         0x93882
-#define OFFSET_CALL_VOLUME               0x96a82
-#define OFFSET_CALORIES_ICON             0x986a2
-#define OFFSET_CHEVRON_RIGHT             0x98cc2
-#define OFFSET_CONNECT_ICON_OFF          0x98ea2
-#define OFFSET_CONNECT_ICON_ON           0x9917a
-#define OFFSET_CONTACTS                  0x99452
-#define OFFSET_DIAL                      0x9a652
-#define OFFSET_DIAL_BACKSPACE            0x9b852
-#define OFFSET_DIAL_NUMBER_0             0x9c31a
-#define OFFSET_DIAL_NUMBER_1             0x9e37a
-#define OFFSET_DIAL_NUMBER_2             0xa03da
-#define OFFSET_DIAL_NUMBER_3             0xa243a
-#define OFFSET_DIAL_NUMBER_4             0xa449a
-#define OFFSET_DIAL_NUMBER_5             0xa64fa
-#define OFFSET_DIAL_NUMBER_6             0xa855a
-#define OFFSET_DIAL_NUMBER_7             0xaa5ba
-#define OFFSET_DIAL_NUMBER_8             0xac61a
-#define OFFSET_DIAL_NUMBER_9             0xae67a
-#define OFFSET_DIGITAL2_CONSUME_SMALL    0xb06da
-#define OFFSET_DIGITAL2_EXERCISE_SMALL   0xb095a
-#define OFFSET_DIGITAL2_HEART_SMALL      0xb0c2a
-#define OFFSET_DIGITAL_CLOCK_THUMBNAIL   0xb0f42
-#define OFFSET_DISTANCE_ICON             0xc750a
-#define OFFSET_HEARTRATE_BACKGROUND      0xc7b2a
-#define OFFSET_HEARTRATE_LOWER           0xdaaea
-#define OFFSET_HEARTRATE_UPPER           0xdad6a
-#define OFFSET_HEART_ICON_50             0xdafea
-#define OFFSET_HEART_ICON_70             0xdc372
-#define OFFSET_INCOMING_CALL_REMINDER    0xde9ba
-#define OFFSET_MUSIC_BACKWARD            0xdf1ba
-#define OFFSET_MUSIC_FORWARD             0xdfaba
-#define OFFSET_MUSIC_PAUSE               0xe03ba
-#define OFFSET_MUSIC_PLAY                0xe35ba
-#define OFFSET_NOTIFICATION_DEL_ALL      0xe67ba
-#define OFFSET_NOTIFICATION_DEL_MSG_BTN  0xeb2ba
-#define OFFSET_NOTIFICATION_MSG_WECHAT   0xeddda
-#define OFFSET_NOTIFICATION_TITLE        0xeefda
-#define OFFSET_QUICK_ELC_100             0xf010a
-#define OFFSET_QUICK_ELC_20              0xf037a
-#define OFFSET_QUICK_ELC_40              0xf05ea
-#define OFFSET_QUICK_ELC_5               0xf085a
-#define OFFSET_QUICK_ELC_60              0xf0aca
-#define OFFSET_QUICK_ELC_80              0xf0d3a
-#define OFFSET_QUICK_TAB_ABOUT           0xf0faa
-#define OFFSET_QUICK_TAB_BRIGHTNESS      0xf41aa
-#define OFFSET_QUICK_TAB_DONT_OFF        0xf73aa
-#define OFFSET_QUICK_TAB_DONT_ON         0xfa5aa
-#define OFFSET_QUICK_TAB_FLASHLIGHT      0xfd7aa
-#define OFFSET_QUICK_TAB_SETTING         0x1009aa
-#define OFFSET_QUICK_TAB_TAIWAN_OFF      0x103baa
-#define OFFSET_QUICK_TAB_TAIWAN_ON       0x106daa
-#define OFFSET_STEP_ICON                 0x109faa
-#define OFFSET_VIVID_CLOCK_HR            0x10a5ca
-#define OFFSET_VIVID_CLOCK_THUMBNAIL     0x10a7ca
-#define OFFSET_VOLUME_CONTROL_BACKGROUND 0x120d92
-#define OFFSET_VOLUME_CONTROL_INDICATOR  0x126382
-#define OFFSET_VOLUME_DOWN               0x1267a2
-#define OFFSET_VOLUME_DOWN_DISABLED      0x1268c2
-#define OFFSET_VOLUME_UP                 0x1269e2
-#define OFFSET_VOLUME_UP_DISABLED        0x126b02
-#define OFFSET_WATCHFACE_BG              0x126c22
-#define OFFSET_WATCHFACE_ICON_BATTERY    0x1660a2
-#define OFFSET_WATCHFACE_ICON_ENERGY     0x166374
-#define OFFSET_WATCHFACE_ICON_HR         0x1665b4
-#define OFFSET_WATCHFACE_ICON_STEP       0x16683c
-#define OFFSET_WEATHER_CLEAR             0x166b80
-#define OFFSET_WEATHER_MOONRISE_ICON     0x167800
-#define OFFSET_WEATHER_MOONSET_ICON      0x167b20
-#define OFFSET_WEATHER_MOON_ICON         0x167e40
-#define OFFSET_WEATHER_SUNRISE_ICON      0x168160
-#define OFFSET_WEATHER_SUNSET_ICON       0x168480
-#define OFFSET_WEATHER_SUN_ICON          0x1687a0
-#define OFFSET_WEATHER_THUNDERSTORM      0x168ac0
-#define OFFSET_WEATHER_TYPHOON           0x169740
-#define OFFSET_WF_NUM_0                  0x16a3c0
-#define OFFSET_WF_NUM_1                  0x16a4d8
-#define OFFSET_WF_NUM_2                  0x16a5f0
-#define OFFSET_WF_NUM_3                  0x16a708
-#define OFFSET_WF_NUM_4                  0x16a820
-#define OFFSET_WF_NUM_5                  0x16a938
-#define OFFSET_WF_NUM_6                  0x16aa50
-#define OFFSET_WF_NUM_7                  0x16ab68
-#define OFFSET_WF_NUM_8                  0x16ac80
-#define OFFSET_WF_NUM_9                  0x16ad98
-#define OFFSET_WATCHFACE_CENTER_POINT    0x16aeb0
+#define OFFSET_1_SCAN_DEVICE             0x624
+#define OFFSET_2_BOND_DEVICE             0xc3c
+#define OFFSET_3_RECONNECTON_CONTROL     0x11ac
+#define OFFSET_4_RECONNECTON_TIMES       0x1750
+#define OFFSET_5_ENTER_ANIFF             0x1e04
+#define OFFSET_6_ANIFF_PERIOD            0x244c
+#define OFFSET_7_VERSION                 0x2a38
+#define OFFSET_8_RESTORE_SETTING         0x30b0
+#define OFFSET_9_OTA                     0x367c
+#define OFFSET_APP_01_WORKOUT            0x3cf8
+#define OFFSET_APP_02_ACTIVITY           0x4be8
+#define OFFSET_APP_03_HR                 0x649c
+#define OFFSET_APP_04_STOPWATCH          0x80c8
+#define OFFSET_APP_05_SPO2               0x93b8
+#define OFFSET_APP_06_EVENTS             0xb1fc
+#define OFFSET_APP_07_SETTINGS           0xbd0c
+#define OFFSET_BLACK_CLOCK_FACE          0xd554
+#define OFFSET_BLACK_CLOCK_STEP          0x17808
+#define OFFSET_BLACK_CLOCK_SUN           0x17d1c
+#define OFFSET_BLACK_CLOCK_THUMBNAIL     0x17fb0
+#define OFFSET_BT_DEVICE_MANAGEMENT      0x20890
+#define OFFSET_BT_DEVICE_MUSIC           0x20f94
+#define OFFSET_BT_DEVICE_PHONECALL       0x21e94
+#define OFFSET_BT_ICON                   0x22d4c
+#define OFFSET_CALLS                     0x23f20
+#define OFFSET_CALL_ACCEPT_LARGE         0x24598
+#define OFFSET_CALL_DIAL                 0x262a4
+#define OFFSET_CALL_HANG_UP              0x26bb8
+#define OFFSET_CALL_MUTE                 0x28574
+#define OFFSET_CALL_MUTE_DISABLED        0x28e58
+#define OFFSET_CALL_MUTE_LARGE           0x29710
+#define OFFSET_CALL_MUTE_LARGE_DISABLED  0x2a3e4
+#define OFFSET_CALL_REJECT_LARGE         0x2b06c
+#define OFFSET_CALL_VOLUME               0x2cba4
+#define OFFSET_CALORIES_ICON             0x2d51c
+#define OFFSET_CHEVRON_RIGHT             0x2d970
+#define OFFSET_CONNECT_ICON_OFF          0x2db50
+#define OFFSET_CONNECT_ICON_ON           0x2dd08
+#define OFFSET_CONTACTS                  0x2dee4
+#define OFFSET_DIAL                      0x2e4d0
+#define OFFSET_DIAL_BACKSPACE            0x2eb60
+#define OFFSET_DIAL_NUMBER_0             0x2f628
+#define OFFSET_DIAL_NUMBER_1             0x2fb44
+#define OFFSET_DIAL_NUMBER_2             0x2ff64
+#define OFFSET_DIAL_NUMBER_3             0x303a8
+#define OFFSET_DIAL_NUMBER_4             0x307e8
+#define OFFSET_DIAL_NUMBER_5             0x30c70
+#define OFFSET_DIAL_NUMBER_6             0x31090
+#define OFFSET_DIAL_NUMBER_7             0x3155c
+#define OFFSET_DIAL_NUMBER_8             0x31964
+#define OFFSET_DIAL_NUMBER_9             0x31e90
+#define OFFSET_DIGITAL2_CONSUME_SMALL    0x3234c
+#define OFFSET_DIGITAL2_EXERCISE_SMALL   0x324ec
+#define OFFSET_DIGITAL2_HEART_SMALL      0x3274c
+#define OFFSET_DIGITAL_CLOCK_THUMBNAIL   0x328fc
+#define OFFSET_DISTANCE_ICON             0x39d14
+#define OFFSET_HEARTRATE_BACKGROUND      0x3a148
+#define OFFSET_HEARTRATE_LOWER           0x3ad14
+#define OFFSET_HEARTRATE_UPPER           0x3af94
+#define OFFSET_HEART_ICON_50             0x3b1a0
+#define OFFSET_HEART_ICON_70             0x3bf60
+#define OFFSET_INCOMING_CALL_REMINDER    0x3d450
+#define OFFSET_MUSIC_BACKWARD            0x3da34
+#define OFFSET_MUSIC_FORWARD             0x3dcfc
+#define OFFSET_MUSIC_PAUSE               0x3dfc4
+#define OFFSET_MUSIC_PLAY                0x3fabc
+#define OFFSET_NOTIFICATION_DEL_ALL      0x41558
+#define OFFSET_NOTIFICATION_DEL_MSG_BTN  0x42288
+#define OFFSET_NOTIFICATION_MSG_WECHAT   0x42960
+#define OFFSET_NOTIFICATION_TITLE        0x43378
+#define OFFSET_QUICK_ELC_100             0x43df0
+#define OFFSET_QUICK_ELC_20              0x43f1c
+#define OFFSET_QUICK_ELC_40              0x44054
+#define OFFSET_QUICK_ELC_5               0x44190
+#define OFFSET_QUICK_ELC_60              0x442c0
+#define OFFSET_QUICK_ELC_80              0x443fc
+#define OFFSET_QUICK_TAB_ABOUT           0x44538
+#define OFFSET_QUICK_TAB_BRIGHTNESS      0x44e20
+#define OFFSET_QUICK_TAB_DONT_OFF        0x45aac
+#define OFFSET_QUICK_TAB_DONT_ON         0x46500
+#define OFFSET_QUICK_TAB_FLASHLIGHT      0x46f54
+#define OFFSET_QUICK_TAB_SETTING         0x47984
+#define OFFSET_QUICK_TAB_TAIWAN_OFF      0x48624
+#define OFFSET_QUICK_TAB_TAIWAN_ON       0x49194
+#define OFFSET_STEP_ICON                 0x49d04
+#define OFFSET_VIVID_CLOCK_HR            0x4a1b8
+#define OFFSET_VIVID_CLOCK_THUMBNAIL     0x4a3b8
+#define OFFSET_VOLUME_CONTROL_BACKGROUND 0x5a044
+#define OFFSET_VOLUME_CONTROL_INDICATOR  0x5a494
+#define OFFSET_VOLUME_DOWN               0x5a648
+#define OFFSET_VOLUME_DOWN_DISABLED      0x5a6b8
+#define OFFSET_VOLUME_UP                 0x5a728
+#define OFFSET_VOLUME_UP_DISABLED        0x5a7ec
+#define OFFSET_WATCHFACE_BG              0x5a8b0
+#define OFFSET_WATCHFACE_ICON_BATTERY    0x6f36c
+#define OFFSET_WATCHFACE_ICON_ENERGY     0x6f5e4
+#define OFFSET_WATCHFACE_ICON_HR         0x6f824
+#define OFFSET_WATCHFACE_ICON_STEP       0x6faac
+#define OFFSET_WEATHER_CLEAR             0x6fd40
+#define OFFSET_WEATHER_MOONRISE_ICON     0x700bc
+#define OFFSET_WEATHER_MOONSET_ICON      0x70308
+#define OFFSET_WEATHER_MOON_ICON         0x70554
+#define OFFSET_WEATHER_SUNRISE_ICON      0x70800
+#define OFFSET_WEATHER_SUNSET_ICON       0x70a00
+#define OFFSET_WEATHER_SUN_ICON          0x70bfc
+#define OFFSET_WEATHER_THUNDERSTORM      0x70f1c
+#define OFFSET_WEATHER_TYPHOON           0x71304
+#define OFFSET_WF_NUM_0                  0x715f4
+#define OFFSET_WF_NUM_1                  0x7170c
+#define OFFSET_WF_NUM_2                  0x71824
+#define OFFSET_WF_NUM_3                  0x7193c
+#define OFFSET_WF_NUM_4                  0x71a54
+#define OFFSET_WF_NUM_5                  0x71b6c
+#define OFFSET_WF_NUM_6                  0x71c84
+#define OFFSET_WF_NUM_7                  0x71d9c
+#define OFFSET_WF_NUM_8                  0x71eb4
+#define OFFSET_WF_NUM_9                  0x71fcc
+#define OFFSET_WATCHFACE_CENTER_POINT    0x720e4
 
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_00    0x16b27c
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_06    0x16c03c
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_12    0x16ce6c
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_18    0x16dcf0
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_24    0x16ebd4
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_30    0x16faf8
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_36    0x170a38
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_42    0x1719c4
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_48    0x1729d8
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_54    0x1739b8
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_60    0x174a74
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_66    0x175b14
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_72    0x176ba8
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_78    0x177c30
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_84    0x178ca4
-#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_90    0x179d24
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_00     0x17ad88
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_06     0x17bfc8
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_12     0x17d28c
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_18     0x17e5d4
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_24     0x17f994
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_30     0x180d90
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_36     0x1821c8
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_42     0x183670
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_48     0x184bec
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_54     0x18611c
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_60     0x18777c
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_66     0x188db8
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_72     0x18a3d4
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_78     0x18b9dc
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_84     0x18cfe0
-#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_90     0x18e5e0
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_00  0x18fbb8
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_06  0x190074
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_12  0x1907d8
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_18  0x191004
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_24  0x1918bc
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_30  0x19222c
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_36  0x192c40
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_42  0x193698
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_48  0x194144
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_54  0x194c18
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_60  0x1957c4
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_66  0x196418
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_72  0x197108
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_78  0x197e6c
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_84  0x198c18
-#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_90  0x199a04
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_00    0x724b0
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_06    0x73270
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_12    0x740a0
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_18    0x74f24
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_24    0x75e08
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_30    0x76d2c
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_36    0x77c6c
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_42    0x78bf8
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_48    0x79c0c
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_54    0x7abec
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_60    0x7bca8
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_66    0x7cd48
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_72    0x7dddc
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_78    0x7ee64
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_84    0x7fed8
+#define OFFSET_GXIMG_WATCHFACE_HAND_HOUR_90    0x80f58
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_00     0x81fbc
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_06     0x831fc
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_12     0x844c0
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_18     0x85808
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_24     0x86bc8
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_30     0x87fc4
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_36     0x893fc
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_42     0x8a8a4
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_48     0x8be20
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_54     0x8d350
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_60     0x8e9b0
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_66     0x8ffec
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_72     0x91608
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_78     0x92c10
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_84     0x94214
+#define OFFSET_GXIMG_WATCHFACE_HAND_MIN_90     0x95814
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_00  0x96dec
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_06  0x972a8
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_12  0x97a0c
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_18  0x98238
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_24  0x98af0
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_30  0x99460
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_36  0x99e74
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_42  0x9a8cc
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_48  0x9b378
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_54  0x9be4c
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_60  0x9c9f8
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_66  0x9d64c
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_72  0x9e33c
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_78  0x9f0a0
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_84  0x9fe4c
+#define OFFSET_GXIMG_WATCHFACE_HAND_SECOND_90  0xa0c38
 
 LV_IMG_DECLARE(wd_img_10_power_off);
 LV_IMG_DECLARE(wd_img_1_scan_device);
@@ -250,7 +250,73 @@ static void draw_event_cb(lv_event_t *e)
 }
 #endif
 
+static void _create_hr_chart(lv_obj_t *p_window)
+{
+#if USE_GX_CHART > 0
+    {
+        /*Create a chart*/
+        _hr_chart = lv_gx_chart_create(p_window);
+        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_STYLE, LV_STATE_DEFAULT);
+        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_SERIES_STYLE, LV_PART_ITEMS);
+        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_INDIC_STYLE, LV_PART_INDICATOR);
+        lv_obj_set_size(_hr_chart, 270, 144);
+        lv_obj_set_pos(_hr_chart, 40, 124);
+        lv_gx_chart_set_type(_hr_chart, LV_GX_CHART_TYPE_LINE);
+        lv_gx_chart_set_range(_hr_chart, LV_GX_CHART_AXIS_SECONDARY_Y, 0, 180);
+        lv_gx_chart_set_point_count(_hr_chart, 24);
+
+        /*Add two data series*/
+        _hr_ser_min = lv_gx_chart_add_series(_hr_chart, lv_palette_main(LV_PALETTE_RED), LV_GX_CHART_AXIS_SECONDARY_Y);
+        _hr_ser_max = lv_gx_chart_add_series(_hr_chart, lv_palette_main(LV_PALETTE_GREEN), LV_GX_CHART_AXIS_SECONDARY_Y);
+    }
+#else
+    { /* Set CHART */
+        //_hr_chart_bg_img = lv_img_create(g_card_heartrate_detail_chart_win.window);
+        // lv_img_set_src(_hr_chart_bg_img, &wd_img_heartrate_background);
+        // lv_obj_set_pos(_hr_chart_bg_img, 45, 140);
+
+        /*Create a chart*/
+        _hr_chart = lv_chart_create(p_window);
+        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_STYLE, LV_STATE_DEFAULT);
+        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_SERIES_STYLE, LV_PART_ITEMS);
+        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_INDIC_STYLE, LV_PART_INDICATOR);
+        lv_obj_set_style_text_font(_hr_chart, &lv_font_montserrat_20, LV_STATE_DEFAULT);
+        lv_obj_set_size(_hr_chart, 280, 160);
+        lv_obj_set_pos(_hr_chart, 40, 124);
+        lv_chart_set_type(_hr_chart, LV_CHART_TYPE_LINE);
+        lv_chart_set_range(_hr_chart, LV_CHART_AXIS_SECONDARY_Y, 60, 180);
+        lv_chart_set_point_count(_hr_chart, 24);
+        lv_obj_add_event_cb(_hr_chart, draw_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+        lv_obj_set_style_bg_color(_hr_chart, lv_color_black(), LV_PART_MAIN);
+        // lv_obj_set_style_border_width(_hr_chart, 0, LV_PART_MAIN);
+
+        /*Add ticks and label to every axis*/
+        lv_chart_set_axis_tick(_hr_chart, LV_CHART_AXIS_PRIMARY_X,   0, 0, 13, 2, true, 40);
+        lv_chart_set_axis_tick(_hr_chart, LV_CHART_AXIS_SECONDARY_Y, 0, 0, 6,  2, true, 40);
+        lv_chart_set_div_line_count(_hr_chart, 7, 0);
+        lv_obj_set_style_pad_column(_hr_chart, 1, LV_PART_MAIN);
+
+        /*Add two data series*/
+        _hr_ser_min = lv_chart_add_series(_hr_chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_SECONDARY_Y);
+        _hr_ser_max = lv_chart_add_series(_hr_chart, lv_palette_main(LV_PALETTE_GREEN), LV_CHART_AXIS_SECONDARY_Y);
+
+        lv_chart_refresh(_hr_chart); /*Required after direct set*/
+    }
+#endif
+}
+
 #if LV_GDX_PATCH_USE_FAST_TILEVIEW
+static bool _hr_chart_build_step(lv_obj_t *p_window, uint32_t step)
+{
+    if (step == 0)
+    {
+        _create_hr_chart(p_window);
+        return false;
+    }
+    _prepare_hr_data(24);
+    return true;
+}
+
 static void heartrate_chart_event_cb(lv_event_t *e)
 {
     if (e->code == LV_EVENT_DELETE)
@@ -317,65 +383,16 @@ lv_obj_t *lv_heartrate_chart_layout_create(lv_obj_t *parent_tv_obj)
     lv_obj_add_style(p_label_hr_unit, (lv_style_t *)&CHART_UNIT_LABEL_STYLE, LV_STATE_DEFAULT);
     lv_obj_set_pos(p_label_hr_unit, 214, 50);
 
-#if USE_GX_CHART > 0
-    {
-        /*Create a chart*/
-        _hr_chart = lv_gx_chart_create(p_window);
-        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_STYLE, LV_STATE_DEFAULT);
-        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_SERIES_STYLE, LV_PART_ITEMS);
-        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_INDIC_STYLE, LV_PART_INDICATOR);
-        lv_obj_set_size(_hr_chart, 270, 144);
-        lv_obj_set_pos(_hr_chart, 40, 124);
-        lv_gx_chart_set_type(_hr_chart, LV_GX_CHART_TYPE_LINE);
-        lv_gx_chart_set_range(_hr_chart, LV_GX_CHART_AXIS_SECONDARY_Y, 0, 180);
-        lv_gx_chart_set_point_count(_hr_chart, 24);
-
-        /*Add two data series*/
-        _hr_ser_min = lv_gx_chart_add_series(_hr_chart, lv_palette_main(LV_PALETTE_RED), LV_GX_CHART_AXIS_SECONDARY_Y);
-        _hr_ser_max = lv_gx_chart_add_series(_hr_chart, lv_palette_main(LV_PALETTE_GREEN), LV_GX_CHART_AXIS_SECONDARY_Y);
-    }
-#else
-    { /* Set CHART */
-        //_hr_chart_bg_img = lv_img_create(g_card_heartrate_detail_chart_win.window);
-        // lv_img_set_src(_hr_chart_bg_img, &wd_img_heartrate_background);
-        // lv_obj_set_pos(_hr_chart_bg_img, 45, 140);
-
-        /*Create a chart*/
-        _hr_chart = lv_chart_create(p_window);
-        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_STYLE, LV_STATE_DEFAULT);
-        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_SERIES_STYLE, LV_PART_ITEMS);
-        lv_obj_add_style(_hr_chart, (lv_style_t *)&CHART_INDIC_STYLE, LV_PART_INDICATOR);
-        lv_obj_set_style_text_font(_hr_chart, &lv_font_montserrat_20, LV_STATE_DEFAULT);
-        lv_obj_set_size(_hr_chart, 280, 160);
-        lv_obj_set_pos(_hr_chart, 40, 124);
-        lv_chart_set_type(_hr_chart, LV_CHART_TYPE_LINE);
-        lv_chart_set_range(_hr_chart, LV_CHART_AXIS_SECONDARY_Y, 60, 180);
-        lv_chart_set_point_count(_hr_chart, 24);
-        lv_obj_add_event_cb(_hr_chart, draw_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
-        lv_obj_set_style_bg_color(_hr_chart, lv_color_black(), LV_PART_MAIN);
-        // lv_obj_set_style_border_width(_hr_chart, 0, LV_PART_MAIN);
-
-        /*Add ticks and label to every axis*/
-        lv_chart_set_axis_tick(_hr_chart, LV_CHART_AXIS_PRIMARY_X,   0, 0, 13, 2, true, 40);
-        lv_chart_set_axis_tick(_hr_chart, LV_CHART_AXIS_SECONDARY_Y, 0, 0, 6,  2, true, 40);
-        lv_chart_set_div_line_count(_hr_chart, 7, 0);
-        lv_obj_set_style_pad_column(_hr_chart, 1, LV_PART_MAIN);
-
-        /*Add two data series*/
-        _hr_ser_min = lv_chart_add_series(_hr_chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_SECONDARY_Y);
-        _hr_ser_max = lv_chart_add_series(_hr_chart, lv_palette_main(LV_PALETTE_GREEN), LV_CHART_AXIS_SECONDARY_Y);
-
-        lv_chart_refresh(_hr_chart); /*Required after direct set*/
-    }
-#endif
-
-    _prepare_hr_data(24);
-
     // _clear_and_reset_state();
 
 #if LV_GDX_PATCH_USE_FAST_TILEVIEW
+    // The chart is the heavy part, the tileview builds it after the window is shown.
+    lv_fast_tileview_build_later(p_window, _hr_chart_build_step);
     lv_obj_add_event_cb(p_window, heartrate_chart_event_cb, LV_EVENT_ALL, NULL);
 #else
+    _create_hr_chart(p_window);
+    _prepare_hr_data(24);
+
     if (NULL == _hb_animation_timer)
     {
         _hb_animation_timer = lv_timer_create(_hb_timer_callback, 350, NULL);
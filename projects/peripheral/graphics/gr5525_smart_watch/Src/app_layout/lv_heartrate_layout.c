@@ -183,6 +183,11 @@ static void heartrate_event_cb(lv_event_t * e)
             lv_timer_pause(_hb_animation_timer);
         }
     }
+    else if (e->code == LV_EVENT_REFRESH)
+    {
+        // Reattached from the tileview cache, show the latest values before it slides in.
+        _hb_timer_callback(NULL);
+    }
 }
 
 static void btn_event_cb(lv_event_t * e) {
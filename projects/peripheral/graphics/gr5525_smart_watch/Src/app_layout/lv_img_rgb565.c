@@ -9,6 +9,7 @@
  *      INCLUDES
  *********************/
 #include "lv_img_rgb565.h"
+#include "lv_port_gximg.h"
 
 
 /*********************
@@ -153,7 +154,14 @@ static void lv_img_rgb565_event(const lv_obj_class_t *class_p, lv_event_t *evt)
         #else
         lv_area_t img_coords = obj->coords;
         lv_img_dsc_t * p_img_dsc = (lv_img_dsc_t *)rgb565_img_src;
-        blit_rgb565(draw_ctx, &img_coords, &p_img_dsc->header, p_img_dsc->data);
+        if (p_img_dsc->header.cf == LV_IMG_CF_GDX_RLE_RGB565)
+        {
+            lv_port_gximg_draw_rle(draw_ctx, NULL, &img_coords, p_img_dsc);
+        }
+        else
+        {
+            blit_rgb565(draw_ctx, &img_coords, &p_img_dsc->header, p_img_dsc->data);
+        }
         #endif
     }
     else {
@@ -1,6 +1,7 @@
 #include "lvgl.h"
 #include "lv_layout_router.h"
 #include "lv_bt_dev_info.h"
+#include "system_manager.h"
 
 extern lv_obj_t * lv_menulist_layout_create(lv_obj_t * parent_tv_obj);
 extern lv_obj_t * lv_ecg_control_layout_create(lv_obj_t * parent_tv_obj);
@@ -70,394 +71,254 @@ void lv_layout_startup(void) {
 
 
 #if LV_GDX_PATCH_USE_FAST_TILEVIEW
-lv_obj_t * layout_router(lv_obj_t * obj, int map_id, int new_row, int new_col, lv_fast_tileview_transition_effect_t * p_effect)
+/*
+ * ROUTE TABLE
+ *****************************************************************************************
+ */
+#define ROUTE_FLAG_KEEP_ALIVE   (1u << 0)   // cache the tile when it is left instead of deleting it
+#define ROUTE_FLAG_NO_PREFETCH  (1u << 1)   // do not build the tile ahead while the neighbour is idle
+
+// Every tile of every map, the tiles of a map are consecutive.
+enum
 {
-    printf("==> SHOW TILE: ID=%d, ROW=%d, COL=%d\n", map_id, new_row, new_col);
-    lv_obj_set_style_bg_color(obj, lv_color_make(0x0, 0x0, 0x0), 0);
-    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    ROUTE_TILE_STATUS,
+    ROUTE_TILE_LIST_ENTRY,
+    ROUTE_TILE_WATCHFACE,
+    ROUTE_TILE_HEARTRATE,
+    ROUTE_TILE_WATCHFACE_2,
+    ROUTE_TILE_NOTIFICATION,
+    ROUTE_TILE_SETTINGS,
+    ROUTE_TILE_APP_LIST,
+    ROUTE_TILE_HR_CHART,
+    ROUTE_TILE_OTA,
+    ROUTE_TILE_SWITCH_WF,
+    ROUTE_TILE_BT_PAIR_DEV,
+    ROUTE_TILE_BT_PAIRED_DEV,
+    ROUTE_TILE_BT_REMOVE_DEV,
+    ROUTE_TILE_BT_MANAGE,
+    ROUTE_TILE_BT_DEVICE,
+    ROUTE_TILE_BT_DIAL,
+    ROUTE_TILE_BT_CALLING,
+    ROUTE_TILE_BT_MUSIC,
+    ROUTE_TILE_BT_DISCOVERY,
+    ROUTE_TILE_BT_DISCONNECT,
+    ROUTE_TILE_BT_NO_ENTRY,
+    ROUTE_TILE_BT_LOCAL_AUDIO,
+    ROUTE_TILE_BT_FACTORY_RESET,
+    ROUTE_TILE_CNT,
+};
+
+typedef struct
+{
+    const char *name;
+    lv_obj_t *(*create)(lv_obj_t *parent_tv_obj);
+    int8_t row;
+    int8_t col;
+    uint8_t flags;          // ROUTE_FLAG_*
+    uint16_t mem_hint;      // lv_mem bytes create() is expected to take at most (as measured by the host simulator,
+                            // 64-bit pointers), checked by lv_layout_router_dump_stats()
+} layout_route_tile_t;
+
+typedef struct
+{
+    uint8_t first_tile;     // ROUTE_TILE_*
+    uint8_t tile_cnt;       // 0 for a map without tiles
+    int8_t back_col;        // swiping to (0, back_col) returns to the previous map, 0 if it cannot be left by swiping
+    bool (*can_back)(void); // NULL, or returns false while the map must not be left
+} layout_route_t;
 
+typedef struct
+{
+    uint16_t visit_cnt;     // shown, created or from the tile cache
+    uint16_t create_cnt;
+    uint32_t create_us_sum;
+    uint32_t create_us_max;
+    uint32_t mem_max;       // lv_mem bytes taken by create()
+    uint32_t heap_peak;     // lv_mem bytes in use right after create()
+} layout_route_stat_t;
+
+static lv_obj_t *_create_bt_pair_dev(lv_obj_t *parent_tv_obj)
+{
+    return lv_bt_pair_dev_layout_create(parent_tv_obj, (void *)&s_router_params.bt_dev_info);
+}
+
+static lv_obj_t *_create_bt_remove_dev(lv_obj_t *parent_tv_obj)
+{
+    return lv_bt_remove_dev_layout_create(parent_tv_obj, (void *)&s_router_params.bt_dev_info);
+}
+
+static lv_obj_t *_create_bt_disconnect(lv_obj_t *parent_tv_obj)
+{
+    return lv_bt_disconnect_layout_create(parent_tv_obj, (void *)&s_router_params.bt_dev_info);
+}
+
+static bool _bt_local_audio_can_back(void)
+{
+    extern bool lv_bt_local_audio_is_playing(void);
+    return !lv_bt_local_audio_is_playing();
+}
+
+#define ROUTE_TILE(_name, _create, _row, _col, _flags, _mem_hint) \
+    { .name = _name, .create = _create, .row = _row, .col = _col, .flags = _flags, .mem_hint = _mem_hint }
+
+static const layout_route_tile_t s_route_tiles[ROUTE_TILE_CNT] = {
+    // 主界面地图，除了下中的消息页面，离开后都缓存起来，再次滑入时不用重新创建
+    [ROUTE_TILE_STATUS]           = ROUTE_TILE("status",         lv_status_layout_create,            -1,  0, ROUTE_FLAG_KEEP_ALIVE, 5000),  // 上中
+    [ROUTE_TILE_LIST_ENTRY]       = ROUTE_TILE("list_entry",     lv_list_entry_layout_create,         0, -1, ROUTE_FLAG_KEEP_ALIVE, 3200),  // 中左
+    [ROUTE_TILE_WATCHFACE]        = ROUTE_TILE("watchface",      lv_watchface_layout_create,          0,  0, ROUTE_FLAG_KEEP_ALIVE, 3600),  // 中中
+    [ROUTE_TILE_HEARTRATE]        = ROUTE_TILE("heartrate",      lv_heartrate_layout_create,          0,  1, ROUTE_FLAG_KEEP_ALIVE, 3200),  // 中右
+    [ROUTE_TILE_WATCHFACE_2]      = ROUTE_TILE("watchface_2",    lv_watchface_layout_create,          0,  2, ROUTE_FLAG_KEEP_ALIVE, 3600),
+    [ROUTE_TILE_NOTIFICATION]     = ROUTE_TILE("notification",   lv_notification_layout_create,       1,  0, ROUTE_FLAG_NO_PREFETCH, 9600), // 下中
     // 弹出的菜单界面地图
-    if (map_id == TILEVIEW_MAP_ID_SETTINGS)
-    {
-        if (new_row == 0) {
-            if (new_col == 0) {
-                return lv_notification_layout_create(obj);
-            }
-            if (new_col == 1) {
-                // 实现侧滑返回的效果，向左滑动就返回。
-                // 此时该函数必须return NULL，否则最终显示的是该函数return的值。
-                lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    if (map_id == TILEVIEW_MAP_ID_APP_LIST)
-    {
-        if (new_row == 0 && new_col == 0){
-            return lv_app_list_layout_create(obj);
-        }
-        // else {
-        //     // 任何方向滑动都退出
-        //     lv_fast_tileview_pop(obj);
-        // }
-        if (new_row == 0 && new_col == 1)
-        {
-            // 向左滑动就返回。
-            lv_fast_tileview_pop(obj);
-        }
-        return NULL;
-    }
-    if (map_id == TILEVIEW_MAP_ID_HR_CHART)
-    {
-        if (new_row == 0 && new_col == 0){
-            return lv_heartrate_chart_layout_create(obj);
-        }
-        if (new_row == 0 && new_col == -1)
-        {
-            // 向右滑动就返回。
-            lv_fast_tileview_pop(obj);
-        }
-        return NULL;
-    }
-    if (map_id == TILEVIEW_MAP_ID_OTA)
-    {
-        if (new_row == 0) {
-            if (new_col == 0) {
-                return lv_ota_layout_create(obj);
-            }
-            if (new_col == 1) {
-                // 侧滑返回
-                lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    if (map_id == TILEVIEW_MAP_ID_SWITCH_WF)
-    {
-        if (new_row == 0) {
-            if (new_col == 0) {
-                return lv_watchface_switch_layout_create(obj);
-            }
-            if (new_col == 1) {
-//                lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    // if (map_id == TILEVIEW_MAP_ID_BT_SCAN_DEV)
-    // {
-    //     if (new_row == 0) {
-    //         if (new_col == 0) {
-    //             return lv_bt_scan_dev_layout_create(obj);
-    //         }
-    //         if (new_col == 1) {
-    //            lv_fast_tileview_pop(obj);
-    //         }
-    //     }
-    //     return NULL;
-    // }
-    if (map_id == TILEVIEW_MAP_ID_BT_PAIR_DEV)
-    {
-        if (new_row == 0) {
-            if (new_col == 0) {
-                return lv_bt_pair_dev_layout_create(obj, (void *)&s_router_params.bt_dev_info);
-            }
-            if (new_col == 1) {
-               lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    if (map_id == TILEVIEW_MAP_ID_BT_PAIRED_DEV)
-    {
-        if (new_row == 0) {
-            if (new_col == 0) {
-                return lv_bt_paired_dev_layout_create(obj);
-            }
-            if (new_col == 1) {
-               lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    if (map_id == TILEVIEW_MAP_ID_BT_REMOVE_DEV)
-    {
-        if (new_row == 0) {
-            if (new_col == 0) {
-                return lv_bt_remove_dev_layout_create(obj, (void *)&s_router_params.bt_dev_info);
-            }
-            if (new_col == 1) {
-               lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    if (map_id == TILEVIEW_MAP_ID_BT_MANAGE)
-    {
-        if (new_row == 0) {
-            if (new_col == 0) {
-                return lv_bt_manage_layout_create(obj);
-            }
-            if (new_col == 1) {
-               lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    if (map_id == TILEVIEW_MAP_ID_BT_DEVICE)
-    {
-        if (new_row == 0) {
-            if (new_col == 0) {
-                return lv_bt_device_layout_create(obj);
-            }
-            if (new_col == 1) {
-               lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    // if (map_id == TILEVIEW_MAP_ID_BT_PHONECALL)
-    // {
-    //     if (new_row == 0)
-    //     {
-    //         if (new_col == 0)
-    //         {
-    //             return lv_bt_phonecall_layout_create(obj);
-    //         }
-    //         if (new_col == 1)
-    //         {
-    //             lv_fast_tileview_pop(obj);
-    //         }
-    //     }
-    //     return NULL;
-    // }
-    if (map_id == TILEVIEW_MAP_ID_BT_DIAL)
-    {
-        if (new_row == 0)
-        {
-            if (new_col == 0)
-            {
-                return lv_bt_dial_layout_create(obj);
-            }
-            if (new_col == 1)
-            {
-                lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
-    }
-    // if (map_id == TILEVIEW_MAP_ID_BT_CONTACTS)
-    // {
-    //     if (new_row == 0)
-    //     {
-    //         if (new_col == 0)
-    //         {
-    //             return lv_bt_contact_layout_create(obj);
-    //         }
-    //         if (new_col == 1)
-    //         {
-    //             lv_fast_tileview_pop(obj);
-    //         }
-    //     }
-    //     return NULL;
-    // }
-    if (map_id == TILEVIEW_MAP_ID_BT_CALLING)
+    [ROUTE_TILE_SETTINGS]         = ROUTE_TILE("settings",       lv_notification_layout_create,       0,  0, 0, 9600),
+    [ROUTE_TILE_APP_LIST]         = ROUTE_TILE("app_list",       lv_app_list_layout_create,           0,  0, 0, 9000),
+    [ROUTE_TILE_HR_CHART]         = ROUTE_TILE("hr_chart",       lv_heartrate_chart_layout_create,    0,  0, 0, 2000),
+    [ROUTE_TILE_OTA]              = ROUTE_TILE("ota",            lv_ota_layout_create,                0,  0, 0, 2000),
+    [ROUTE_TILE_SWITCH_WF]        = ROUTE_TILE("switch_wf",      lv_watchface_switch_layout_create,   0,  0, 0, 5400),
+    // [ROUTE_TILE_BT_SCAN_DEV]   = ROUTE_TILE("bt_scan_dev",    lv_bt_scan_dev_layout_create,        0,  0, 0, 0),
+    [ROUTE_TILE_BT_PAIR_DEV]      = ROUTE_TILE("bt_pair_dev",    _create_bt_pair_dev,                 0,  0, 0, 3000),
+    [ROUTE_TILE_BT_PAIRED_DEV]    = ROUTE_TILE("bt_paired_dev",  lv_bt_paired_dev_layout_create,      0,  0, 0, 1200),
+    [ROUTE_TILE_BT_REMOVE_DEV]    = ROUTE_TILE("bt_remove_dev",  _create_bt_remove_dev,               0,  0, 0, 3000),
+    [ROUTE_TILE_BT_MANAGE]        = ROUTE_TILE("bt_manage",      lv_bt_manage_layout_create,          0,  0, 0, 7000),
+    [ROUTE_TILE_BT_DEVICE]        = ROUTE_TILE("bt_device",      lv_bt_device_layout_create,          0,  0, 0, 3800),
+    [ROUTE_TILE_BT_DIAL]          = ROUTE_TILE("bt_dial",        lv_bt_dial_layout_create,            0,  0, 0, 5200),
+    [ROUTE_TILE_BT_CALLING]       = ROUTE_TILE("bt_calling",     lv_bt_calling_layout_create,         0,  0, 0, 2000),
+    [ROUTE_TILE_BT_MUSIC]         = ROUTE_TILE("bt_music",       lv_bt_music_layout_create,           0,  0, 0, 4000),
+    [ROUTE_TILE_BT_DISCOVERY]     = ROUTE_TILE("bt_discovery",   lv_bt_discovery_layout_create,       0,  0, 0, 3000),
+    [ROUTE_TILE_BT_DISCONNECT]    = ROUTE_TILE("bt_disconnect",  _create_bt_disconnect,               0,  0, 0, 3000),
+    [ROUTE_TILE_BT_NO_ENTRY]      = ROUTE_TILE("bt_no_entry",    lv_bt_no_entry_layout_create,        0,  0, 0, 2400),
+    [ROUTE_TILE_BT_LOCAL_AUDIO]   = ROUTE_TILE("bt_local_audio", lv_bt_local_audio_layout_create,     0,  0, 0, 1800),
+    [ROUTE_TILE_BT_FACTORY_RESET] = ROUTE_TILE("bt_factory_reset", lv_bt_factory_reset_layout_create, 0,  0, 0, 3000),
+};
+
+#define ROUTE(_first_tile, _tile_cnt, _back_col, _can_back) \
+    { .first_tile = _first_tile, .tile_cnt = _tile_cnt, .back_col = _back_col, .can_back = _can_back }
+
+// 侧滑返回：向左滑动（back_col = 1）或向右滑动（back_col = -1）就返回
+static const layout_route_t s_routes[TILEVIEW_MAP_ID_MAX] = {
+    [TILEVIEW_MAP_ID_MAIN_SCREEN]      = ROUTE(ROUTE_TILE_STATUS,           6,  0, NULL),
+    [TILEVIEW_MAP_ID_SETTINGS]         = ROUTE(ROUTE_TILE_SETTINGS,         1,  1, NULL),
+    [TILEVIEW_MAP_ID_APP_LIST]         = ROUTE(ROUTE_TILE_APP_LIST,         1,  1, NULL),
+    [TILEVIEW_MAP_ID_HR_CHART]         = ROUTE(ROUTE_TILE_HR_CHART,         1, -1, NULL),
+    [TILEVIEW_MAP_ID_OTA]              = ROUTE(ROUTE_TILE_OTA,              1,  1, NULL),
+    [TILEVIEW_MAP_ID_SWITCH_WF]        = ROUTE(ROUTE_TILE_SWITCH_WF,        1,  0, NULL),
+    [TILEVIEW_MAP_ID_BT_PAIR_DEV]      = ROUTE(ROUTE_TILE_BT_PAIR_DEV,      1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_PAIRED_DEV]    = ROUTE(ROUTE_TILE_BT_PAIRED_DEV,    1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_REMOVE_DEV]    = ROUTE(ROUTE_TILE_BT_REMOVE_DEV,    1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_MANAGE]        = ROUTE(ROUTE_TILE_BT_MANAGE,        1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_DEVICE]        = ROUTE(ROUTE_TILE_BT_DEVICE,        1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_DIAL]          = ROUTE(ROUTE_TILE_BT_DIAL,          1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_CALLING]       = ROUTE(ROUTE_TILE_BT_CALLING,       1,  0, NULL),
+    [TILEVIEW_MAP_ID_BT_MUSIC]         = ROUTE(ROUTE_TILE_BT_MUSIC,         1,  1, NULL),
+    // [TILEVIEW_MAP_ID_BT_OTA]        = ROUTE(ROUTE_TILE_BT_OTA,           1,  1, _bt_ota_can_back), 升级期间（g_bt_ota_lock）不能返回
+    [TILEVIEW_MAP_ID_BT_DISCOVERY]     = ROUTE(ROUTE_TILE_BT_DISCOVERY,     1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_DISCONNECT]    = ROUTE(ROUTE_TILE_BT_DISCONNECT,    1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_NO_ENTRY]      = ROUTE(ROUTE_TILE_BT_NO_ENTRY,      1,  1, NULL),
+    [TILEVIEW_MAP_ID_BT_LOCAL_AUDIO]   = ROUTE(ROUTE_TILE_BT_LOCAL_AUDIO,   1,  1, _bt_local_audio_can_back),
+    [TILEVIEW_MAP_ID_BT_FACTORY_RESET] = ROUTE(ROUTE_TILE_BT_FACTORY_RESET, 1,  1, NULL),
+};
+
+static layout_route_stat_t s_route_stats[ROUTE_TILE_CNT];
+
+static void _route_visit_cb(lv_event_t *e)
+{
+    s_route_stats[(uintptr_t)lv_event_get_user_data(e)].visit_cnt++;
+}
+
+static lv_obj_t *_route_create_tile(lv_obj_t *obj, uint32_t tile_id)
+{
+    const layout_route_tile_t *p_route_tile = &s_route_tiles[tile_id];
+    layout_route_stat_t *p_stat = &s_route_stats[tile_id];
+
+    // 只缓存的页面才值得提前建造
+    if ((p_route_tile->flags & ROUTE_FLAG_NO_PREFETCH) && lv_fast_tileview_is_prefetching(obj))
     {
-        if (new_row == 0)
-        {
-            if (new_col == 0)
-            {
-                return lv_bt_calling_layout_create(obj);
-            }
-        }
         return NULL;
     }
-    /*
-    if (map_id == TILEVIEW_MAP_ID_BT_OTA)
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t used_before = mon.total_size - mon.free_size;
+    uint32_t t_start = sys_timestamp_us();
+
+    lv_obj_t *p_tile = p_route_tile->create(obj);
+
+    uint32_t us = sys_timestamp_us() - t_start;
+    lv_mem_monitor(&mon);
+    uint32_t used_after = mon.total_size - mon.free_size;
+    if (!p_tile)
     {
-        if (new_row == 0)
-        {
-            if (new_col == 0)
-            {
-                return lv_bt_ota_layout_create(obj);
-            }
-            if (new_col == 1)
-            {
-                extern bool g_bt_ota_lock;
-                if (!g_bt_ota_lock)
-                {
-                    lv_fast_tileview_pop(obj);
-                }
-            }
-        }
         return NULL;
     }
-    */
-    if (map_id == TILEVIEW_MAP_ID_BT_MUSIC)
+
+    p_stat->create_cnt++;
+    p_stat->create_us_sum += us;
+    p_stat->create_us_max = LV_MAX(p_stat->create_us_max, us);
+    if (used_after > used_before)
     {
-        if (new_row == 0)
-        {
-            if (new_col == 0)
-            {
-                return lv_bt_music_layout_create(obj);
-            }
-            if (new_col == 1)
-            {
-                lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
+        p_stat->mem_max = LV_MAX(p_stat->mem_max, used_after - used_before);
     }
-    if (map_id == TILEVIEW_MAP_ID_BT_DISCOVERY)
+    p_stat->heap_peak = LV_MAX(p_stat->heap_peak, used_after);
+
+    lv_obj_add_event_cb(p_tile, _route_visit_cb, LV_EVENT_READY, (void *)(uintptr_t)tile_id);
+    if (p_route_tile->flags & ROUTE_FLAG_KEEP_ALIVE)
     {
-        if (new_row == 0)
-        {
-            if (new_col == 0)
-            {
-                return lv_bt_discovery_layout_create(obj);
-            }
-            if (new_col == 1)
-            {
-                lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
+        lv_fast_tileview_set_keep_alive(p_tile, true);
     }
-    // if (map_id == TILEVIEW_MAP_ID_BT_RECONN_TIMES)
-    // {
-    //     if (new_row == 0)
-    //     {
-    //         if (new_col == 0)
-    //         {
-    //             return lv_bt_reconn_times_layout_create(obj);
-    //         }
-    //         if (new_col == 1)
-    //         {
-    //             lv_fast_tileview_pop(obj);
-    //         }
-    //     }
-    //     return NULL;
-    // }
-    // if (map_id == TILEVIEW_MAP_ID_BT_RECONN_TIMES_CONFIRM)
-    // {
-    //     if (new_row == 0)
-    //     {
-    //         if (new_col == 0)
-    //         {
-    //             return lv_bt_reconn_times_confirm_layout_create(obj, (void *)&s_router_params.reconn_times);
-    //         }
-    //         if (new_col == 1)
-    //         {
-    //             lv_fast_tileview_pop(obj);
-    //         }
-    //     }
-    //     return NULL;
-    // }
-    if (map_id == TILEVIEW_MAP_ID_BT_DISCONNECT)
+    return p_tile;
+}
+
+lv_obj_t * layout_router(lv_obj_t * obj, int map_id, int new_row, int new_col, lv_fast_tileview_transition_effect_t * p_effect)
+{
+    printf("==> SHOW TILE: ID=%d, ROW=%d, COL=%d\n", map_id, new_row, new_col);
+    lv_obj_set_style_bg_color(obj, lv_color_make(0x0, 0x0, 0x0), 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+
+    if (map_id < 0 || map_id >= TILEVIEW_MAP_ID_MAX)
     {
-        if (new_row == 0)
-        {
-            if (new_col == 0)
-            {
-                return lv_bt_disconnect_layout_create(obj, (void *)&s_router_params.bt_dev_info);
-            }
-            if (new_col == 1)
-            {
-                lv_fast_tileview_pop(obj);
-            }
-        }
         return NULL;
     }
-    if (map_id == TILEVIEW_MAP_ID_BT_NO_ENTRY)
+    const layout_route_t *p_route = &s_routes[map_id];
+
+    for (uint32_t i = p_route->first_tile; i < (uint32_t)p_route->first_tile + p_route->tile_cnt; i++)
     {
-        if (new_row == 0)
+        if (s_route_tiles[i].row == new_row && s_route_tiles[i].col == new_col)
         {
-            if (new_col == 0)
-            {
-                return lv_bt_no_entry_layout_create(obj);
-            }
-            if (new_col == 1)
-            {
-                lv_fast_tileview_pop(obj);
-            }
+            return _route_create_tile(obj, i);
         }
-        return NULL;
     }
-    if (map_id == TILEVIEW_MAP_ID_BT_LOCAL_AUDIO)
+
+    // 实现侧滑返回的效果。此时该函数必须return NULL，否则最终显示的是该函数return的值。
+    if (p_route->back_col != 0 && new_row == 0 && new_col == p_route->back_col)
     {
-        if (new_row == 0)
+        if (!p_route->can_back || p_route->can_back())
         {
-            if (new_col == 0)
-            {
-                return lv_bt_local_audio_layout_create(obj);
-            }
-            if (new_col == 1)
-            {
-                extern bool lv_bt_local_audio_is_playing(void);
-                if (!lv_bt_local_audio_is_playing())
-                {
-                    lv_fast_tileview_pop(obj);
-                }
-            }
+            lv_fast_tileview_pop(obj);
         }
-        return NULL;
     }
-    if (map_id == TILEVIEW_MAP_ID_BT_FACTORY_RESET)
+    return NULL;
+}
+
+void lv_layout_router_dump_stats(int (*p_printf)(const char *, ...))
+{
+    if (!p_printf)
     {
-        if (new_row == 0)
-        {
-            if (new_col == 0)
-            {
-                return lv_bt_factory_reset_layout_create(obj);
-            }
-            if (new_col == 1)
-            {
-                lv_fast_tileview_pop(obj);
-            }
-        }
-        return NULL;
+        p_printf = printf;
     }
-
-    // 主界面地图
-    switch (new_row)
+    p_printf("route             visits created create avg/max(us) mem max/hint(B) heap peak(B)\n");
+    for (uint32_t i = 0; i < ROUTE_TILE_CNT; i++)
     {
-    case -1:
-        if (new_col == 0) // 上中
-        {
-            return lv_status_layout_create(obj);
-        }
-        break;
-
-    case 0:
-        if (new_col == -1) // 中左
-        {
-            return lv_list_entry_layout_create(obj);
-        }
-        else if (new_col == 0) // 中中
-        {
-            return lv_watchface_layout_create(obj);
-        }
-        else if (new_col == 1) // 中右
-        {
-            return lv_heartrate_layout_create(obj);
-        }
-        else if (new_col == 2)
+        const layout_route_stat_t *p_stat = &s_route_stats[i];
+        if (p_stat->create_cnt == 0)
         {
-            return lv_watchface_layout_create(obj);
+            continue;
         }
-        break;
-
-    case 1:
-        if (new_col == 0) // 下中
-        {
-            return lv_notification_layout_create(obj);
-        }
-        break;
-
-    default:
-        break;
+        p_printf("%-17s %6u %7u %9lu %9lu %7lu %7u %12lu%s\n", s_route_tiles[i].name,
+                 (unsigned)p_stat->visit_cnt, (unsigned)p_stat->create_cnt,
+                 (unsigned long)(p_stat->create_us_sum / p_stat->create_cnt), (unsigned long)p_stat->create_us_max,
+                 (unsigned long)p_stat->mem_max, (unsigned)s_route_tiles[i].mem_hint, (unsigned long)p_stat->heap_peak,
+                 p_stat->mem_max > s_route_tiles[i].mem_hint ? "  <- over the memory hint" : "");
     }
-    return NULL;
 }
 
 void _init_fast_tileview(void)
@@ -85,5 +85,10 @@ void lv_layout_router_show_bt_local_audio(lv_obj_t *from_obj);
 
 void lv_layout_router_show_factory_reset(lv_obj_t *from_obj);
 
+/** @brief Print the counters of every route that was created: visits, creation time and lv_mem taken,
+ *         to decide which screens are worth caching. NULL prints with printf() (UART on the device).
+*/
+void lv_layout_router_dump_stats(int (*p_printf)(const char *, ...));
+
 #endif // __LV_LAYOUT_ROUTER_H__
 
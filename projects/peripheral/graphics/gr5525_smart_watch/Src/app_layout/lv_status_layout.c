@@ -176,6 +176,11 @@ static void status_layout_event_cb(lv_event_t * e)
             lv_timer_pause(p_refr_timer);
         }
     }
+    else if (e->code == LV_EVENT_REFRESH)
+    {
+        // reattached from the tileview cache
+        status_bar_refr_cb(p_refr_timer);
+    }
 }
 #endif
 
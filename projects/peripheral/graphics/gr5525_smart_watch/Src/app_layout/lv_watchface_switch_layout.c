@@ -41,9 +41,12 @@ static void watchface_select_released_cb(lv_event_t *e)
     {
         lv_obj_t *p_target = lv_event_get_target(e);
         // NOTE: WatchFace Switching feature totally depends on watch face layout self destroy
-        // So it won't work if watch face layout destroy is disabled
+        // So it won't work if watch face layout destroy is disabled, and the cached watch face tiles must be dropped
         uintptr_t idx = (uintptr_t)lv_event_get_user_data(e);
         wf_mngr_set_current_watchface((int32_t)idx);
+#if LV_GDX_PATCH_USE_FAST_TILEVIEW
+        lv_fast_tileview_cache_clear(p_target);
+#endif
         lv_layout_router_back(p_target);
     }
 }
@@ -47,9 +47,16 @@ lv_obj_t *wf_mngr_create_watchface_layout(lv_obj_t *obj)
     }
     lv_obj_t *p_wf = p_cur_watchface->create_func(obj);
     lv_obj_add_event_cb(p_wf, wf_mngr_lifecycle_cb, LV_EVENT_ALL, NULL);
-    if (s_wf_refr_timer && s_wf_refr_timer->timer_cb)
+    if (p_wf->user_data && s_wf_refr_timer && s_wf_refr_timer->timer_cb)
     {
+        // first refresh of the new watchface, the running timer may still serve the one on screen
+        void *p_owner = s_wf_refr_timer->user_data;
+        s_wf_refr_timer->user_data = (void *)p_wf;
         s_wf_refr_timer->timer_cb(s_wf_refr_timer);
+        if (!s_wf_refr_timer->paused)
+        {
+            s_wf_refr_timer->user_data = p_owner;
+        }
     }
     return p_wf;
 }
@@ -122,7 +129,11 @@ void *wf_mngr_create_refr_ctx_impl(lv_obj_t *p_window, uint32_t ctx_size, uint16
         s_wf_refr_timer = lv_timer_create_basic();
     }
     s_wf_refr_timer->timer_cb = refr_cb;
-    s_wf_refr_timer->user_data = (void *)p_window;
+    // a watchface built ahead by the tileview must not take the timer from the one on screen
+    if (s_wf_refr_timer->paused || !s_wf_refr_timer->user_data)
+    {
+        s_wf_refr_timer->user_data = (void *)p_window;
+    }
     return p_window->user_data;
 }
 
@@ -144,6 +155,21 @@ static void wf_mngr_lifecycle_cb(lv_event_t *event)
             {
                 lv_mem_free(p_wf->user_data);
             }
+            // a cached watchface may be deleted while another one owns the timer
+            if (s_wf_refr_timer && s_wf_refr_timer->user_data == (void *)p_wf)
+            {
+                lv_timer_pause(s_wf_refr_timer);
+                s_wf_refr_timer->user_data = NULL;
+            }
+            break;
+
+        case LV_EVENT_REFRESH:
+            // reattached from the tileview cache, the timer may have served the other watchface tile
+            if (p_wf->user_data && s_wf_refr_timer && s_wf_refr_timer->timer_cb)
+            {
+                s_wf_refr_timer->user_data = (void *)p_wf;
+                s_wf_refr_timer->timer_cb(s_wf_refr_timer);
+            }
             break;
 
         case LV_EVENT_READY:
@@ -152,6 +178,7 @@ static void wf_mngr_lifecycle_cb(lv_event_t *event)
             {
                 if (s_wf_refr_timer)
                 {
+                    s_wf_refr_timer->user_data = (void *)p_wf;
                     lv_timer_resume(s_wf_refr_timer);
                     lv_timer_ready(s_wf_refr_timer);
                 }
@@ -8,6 +8,7 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "system_manager.h"
 
 #if CFG_LPCLK_INTERNAL_EN == 0
 #error "GR5625 MUST USE INTERNAL OSC AS LPCLK!"
@@ -134,7 +135,10 @@ void bt_api_on_msg_arrived(const bt_api_msg_t *msg)
                 if (s_resp_callback[i].resp_type == resp_type || s_resp_callback[i].resp_type == IND_ALL)
                 {
                     bt_api_msg_t *msg_copy = copy_msg(msg);
-                    lv_res_t res = lv_async_call(resp_callback_async_wrapper, (void *)msg_copy);
+                    if (!sys_gui_call(resp_callback_async_wrapper, (void *)msg_copy))
+                    {
+                        free_copied_msg(msg_copy);
+                    }
                 }
             }
         }
@@ -150,7 +154,10 @@ void bt_api_on_msg_arrived(const bt_api_msg_t *msg)
                 if (s_ind_callback[i].ind_type == ind_type || s_ind_callback[i].ind_type == IND_ALL)
                 {
                     bt_api_msg_t *msg_copy = copy_msg(msg);
-                    lv_res_t res = lv_async_call(ind_callback_async_wrapper, (void *)msg_copy);
+                    if (!sys_gui_call(ind_callback_async_wrapper, (void *)msg_copy))
+                    {
+                        free_copied_msg(msg_copy);
+                    }
                 }
             }
         }
@@ -29,6 +29,13 @@
  */
 #define LV_MEM_USED_MONITOR (0)
 
+/*
+ * TP acquisition: 1 - the TP INT line starts an I2C DMA read of every report,
+ *                 0 - lv_indev_read_task() polls the TP every LV_INDEV_DEF_READ_PERIOD
+ */
+#define TP_ACQUIRE_ON_INT   (1)
+#define TP_RELEASE_TIMEOUT  (100)   /* ms without report while touched, then the report is read without INT */
+
 /*
  * Flash Device Setting
  */
@@ -58,6 +65,10 @@ extern void lv_home_layout_init(void);
  *****************************************************************************************
  */
 static bool lv_env_is_inited = false;
+#if TP_ACQUIRE_ON_INT
+static volatile bool s_tp_touched = false;
+static volatile TickType_t s_tp_report_tick = 0;
+#endif
 
 extern void lv_layout_startup(void);
 
@@ -65,6 +76,24 @@ extern void lv_layout_startup(void);
  * LOCAL FUNCTION DEFINITIONS
  ****************************************************************************************
  */
+#if TP_ACQUIRE_ON_INT
+/* I2C DMA completion interrupt of a TP report */
+static void tp_report_cb(bool pressed, int16_t x, int16_t y)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    touchpad_indev_push(pressed, x, y);
+    s_tp_report_tick = xTaskGetTickCountFromISR();
+    if (pressed && !s_tp_touched)
+    {
+        vTaskNotifyGiveFromISR(g_task_handle.indev_handle, &xHigherPriorityTaskWoken);
+    }
+    s_tp_touched = pressed;
+    sys_gui_wakeup();
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+#endif
+
 static void lvgl_env_init(void)
 {
     sys_adjust_dig_core_voltage(1120);
@@ -75,7 +104,9 @@ static void lvgl_env_init(void)
     lv_env_is_inited = true;
 
     app_rtc_init(NULL);
-    sys_sem_init(&g_semphr.gui_refresh_sem);
+#if TP_ACQUIRE_ON_INT
+    tp_set_report_cb(tp_report_cb);
+#endif
 }
 
 /*
@@ -91,9 +122,14 @@ void gui_schedule_task(void *p_arg)
 
     while (1)
     {
+        sys_gui_run_calls();
         delayTime = lv_task_handler();
-        // sys_sem_take(g_semphr.gui_refresh_sem, delayTime);
-        vTaskDelay(delayTime);
+        /*
+         * Sleep until the next LVGL timer is due (forever if none), unless a TP report, a sys_gui_call()
+         * or another sys_gui_wakeup() comes first. FreeRTOS tickless idle sleeps meanwhile.
+         */
+        ulTaskNotifyTake(pdTRUE, delayTime == LV_NO_TIMER_READY ? portMAX_DELAY : delayTime);
+        lv_port_indev_wakeup();
     }
 }
 
@@ -102,14 +138,29 @@ void lv_indev_read_task(void *args)
 {
     while (1)
     {
+#if TP_ACQUIRE_ON_INT
+        /* Sleep until the screen is touched, tp_report_cb() gives the points */
+        if (!s_tp_touched)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        /* A report may be lost while the previous one is read, don't miss the release */
+        if (xTaskGetTickCount() - s_tp_report_tick >= TP_RELEASE_TIMEOUT)
+        {
+            tp_read_report_async();
+        }
+        vTaskDelay(TP_RELEASE_TIMEOUT);
+#else
         if (lv_env_is_inited)
         {
             touchpad_indev_cache();
         }
-        sys_sem_give(g_semphr.gui_refresh_sem);
+        sys_gui_wakeup();
         {
             vTaskDelay(LV_INDEV_DEF_READ_PERIOD);
         }
+#endif
     }
 }
 
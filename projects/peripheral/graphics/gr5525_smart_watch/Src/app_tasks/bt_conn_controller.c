@@ -1,5 +1,6 @@
 #include "bt_conn_controller.h"
 #include "lvgl.h"
+#include "system_manager.h"
 #include "FreeRTOS.h"
 #include "app_log.h"
 
@@ -98,7 +99,7 @@ void bt_conn_controller_ind_handler(const bt_api_msg_t *p_rx_info)
 
         if (s_bt_conn_ctx_listener)
         {
-            lv_async_call(listener_async_call_wrapper, NULL);
+            sys_gui_call(listener_async_call_wrapper, NULL);
         }
     }
     break;
@@ -145,7 +146,7 @@ void bt_conn_controller_ind_handler(const bt_api_msg_t *p_rx_info)
 
         if (s_bt_conn_ctx_listener)
         {
-            lv_async_call(listener_async_call_wrapper, NULL);
+            sys_gui_call(listener_async_call_wrapper, NULL);
         }
     }
     break;
@@ -184,7 +185,7 @@ void bt_conn_controller_ind_handler(const bt_api_msg_t *p_rx_info)
 
         if (s_bt_conn_ctx_listener)
         {
-            lv_async_call(listener_async_call_wrapper, NULL);
+            sys_gui_call(listener_async_call_wrapper, NULL);
         }
     }
     break;
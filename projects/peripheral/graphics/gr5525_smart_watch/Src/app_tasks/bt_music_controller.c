@@ -1,6 +1,7 @@
 #include "bt_music_controller.h"
 #include "FreeRTOS.h"
 #include "lvgl.h"
+#include "system_manager.h"
 #include "app_log.h"
 
 static bt_music_ctx_t s_bt_music_ctx = {
@@ -93,7 +94,7 @@ void bt_music_controller_ind_handler(const bt_api_msg_t *msg)
 
     if (s_ctx_listener && s_bt_music_ctx.changed.value > 0)
     {
-        lv_async_call(listener_async_call_wrapper, NULL);
+        sys_gui_call(listener_async_call_wrapper, NULL);
     }
 }
 
@@ -1,6 +1,7 @@
 #include "bt_phonecall_controller.h"
 #include "app_bt.h"
 #include "lvgl.h"
+#include "system_manager.h"
 #include "FreeRTOS.h"
 #include "lv_layout_router.h"
 #include "app_log.h"
@@ -46,12 +47,12 @@ void bt_phonecall_controller_ind_handler(const bt_api_msg_t *msg)
 
         if (s_phonecall_ctx.call_state == CALL_STATE_INCOMING)
         {
-            lv_async_call(incoming_call_async_wrapper, NULL);
+            sys_gui_call(incoming_call_async_wrapper, NULL);
         }
 
         if (s_call_state_updated_cb)
         {
-            lv_async_call(call_state_updated_async_wrapper, NULL);
+            sys_gui_call(call_state_updated_async_wrapper, NULL);
         }
 
         // printf("Call State Updated: %s With [%s]\n", CALL_STATE_STR[msg->data.indication->call_line_state.state], s_phonecall_ctx.phone_number);
@@ -98,7 +99,7 @@ void bt_phonecall_controller_ind_handler(const bt_api_msg_t *msg)
             s_phonecall_ctx.call_state = CALL_STATE_END;
             if (s_call_state_updated_cb)
             {
-                lv_async_call(call_state_updated_async_wrapper, NULL);
+                sys_gui_call(call_state_updated_async_wrapper, NULL);
             }
         }
     }
@@ -106,6 +106,13 @@
 #define PMU_CALIBRATION_ENABLE  1
 #endif
 
+// <o> Enable the timing wheel of the app timer
+// <0=> DISABLE
+// <1=> ENABLE
+#ifndef APP_TIMER_WHEEL_ENABLE
+#define APP_TIMER_WHEEL_ENABLE  1
+#endif
+
 // <o> The Number of sectors for NVDS
 // <i> Default:  1
 #ifndef NVDS_NUM_SECTOR
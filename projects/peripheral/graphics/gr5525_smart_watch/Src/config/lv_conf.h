@@ -54,6 +54,10 @@
 #define LV_GDX_PATCH_CUSTOM_SCROLL                  ((LV_ENABLE_GDX_PATCH) && 1)                /* handle scroll event by self instead of lv_indev_scroll. */
 #define LV_GDX_PATCH_USE_FAST_TILEVIEW              ((LV_GDX_PATCH_CUSTOM_SCROLL) && 1)         /* FAST TILE VIEW */
 #define LV_GDX_PATCH_SET_CLIP_AREA_ONCE             ((LV_ENABLE_GDX_PATCH) && 1)                /* Set clip area only once before refreshing invalid area for reducing command overhead. This will reduce ~1.8(0.2*9)ms in full refresh. */
+#define LV_GDX_PATCH_JOIN_AREA_CB                   ((LV_ENABLE_GDX_PATCH) && 1)                /* let the display driver merge the invalid areas (lv_disp_drv_t.join_area_cb) instead of lv_refr_join_area(). */
+#define LV_GDX_PATCH_ROUND_DISP                     ((LV_ENABLE_GDX_PATCH) && 1)                /* do not draw objects in the invisible corners of a round panel (lv_disp_drv_t.round_inset) and let the driver narrow every band (lv_disp_drv_t.band_area_cb). */
+#define LV_GDX_PATCH_INDEV_THROW_VECT               ((LV_ENABLE_GDX_PATCH) && 1)                /* a pointer read_cb may report the finger velocity (lv_indev_data_t.throw_vect), used for the scroll throw instead of the low pass filtered point difference. */
+#define LV_GDX_PATCH_TIMER_HEAP                     ((LV_ENABLE_GDX_PATCH) && 1)                /* keep the lv_timers in a queue ordered by deadline, lv_timer_handler() only looks at the due ones instead of scanning all of them. */
 
 #define LV_GDX_PATCH_USE_GX_CHART                   ((LV_ENABLE_GDX_PATCH) && 1)                /* use custom gx cahrt widget */
 #define LV_GDX_PATCH_IGNORE_CHILDLESS_SCREEN_LAYER  ((LV_ENABLE_GDX_PATCH) && 1)                /* DO NOT render childless top layer and childless sys layer. reduce about 0.1ms*/
@@ -137,6 +141,10 @@
 #define LV_TICK_CUSTOM_SYS_TIME_EXPR (xTaskGetTickCount())    /*Expression evaluating to current system time in ms*/
 #endif   /*LV_TICK_CUSTOM*/
 
+/*Microsecond clock of the fast tileview: time budget of the tile build slices and the creation statistics*/
+#define LV_FAST_TILEVIEW_CLOCK_INCLUDE "system_manager.h"
+#define LV_FAST_TILEVIEW_CLOCK_US() (sys_timestamp_us())
+
 /*Default Dot Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
  *(Not so important, you can adjust it to modify default sizes and spaces)*/
 #define LV_DPI_DEF 130     /*[px/inch]*/
@@ -2,6 +2,12 @@
 #include "tp_config.h"
 #include <stdio.h>
 
+#define TP_REPORT_REG       (0x5C)
+#define TP_REPORT_LEN       (5)
+
+static tp_report_cb_t s_tp_report_cb = NULL;
+static uint8_t s_tp_report[TP_REPORT_LEN];
+
 static const uint16_t s_tp_value_360[] = {
     0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
     12, 13, 13, 14, 15, 16, 16, 17, 18, 19, 19, 20, 21, 21, 22, 23,
@@ -48,12 +54,8 @@ void tp_set_sleep_mode(bool sleep_enable)
     }
 }
 
-bool tp_get_data(int16_t *p_x, int16_t *p_y)
+static bool tp_decode(const uint8_t *read_data, int16_t *p_x, int16_t *p_y)
 {
-    uint8_t read_data[5];
-
-    tp_read(0x5c, read_data, 5);
-
     if (read_data[0] == 128 || (read_data[0] == 0 && read_data[1] == 0 \
        && read_data[2] == 0 && read_data[3] == 0 && read_data[4] == 0))
     {
@@ -79,6 +81,45 @@ bool tp_get_data(int16_t *p_x, int16_t *p_y)
     }
 }
 
+bool tp_get_data(int16_t *p_x, int16_t *p_y)
+{
+    uint8_t read_data[TP_REPORT_LEN];
+
+    tp_read(TP_REPORT_REG, read_data, TP_REPORT_LEN);
+
+    return tp_decode(read_data, p_x, p_y);
+}
+
+/* I2C DMA completion interrupt */
+static void tp_report_read_cb(bool success)
+{
+    int16_t x = 0;
+    int16_t y = 0;
+
+    if (success && s_tp_report_cb != NULL)
+    {
+        bool pressed = tp_decode(s_tp_report, &x, &y);
+        s_tp_report_cb(pressed, x, y);
+    }
+}
+
+bool tp_read_report_async(void)
+{
+    return tp_read_async(TP_REPORT_REG, s_tp_report, TP_REPORT_LEN, tp_report_read_cb);
+}
+
+/* TP INT line, a new report is ready */
+static void tp_int_cb(void)
+{
+    tp_read_report_async();
+}
+
+void tp_set_report_cb(tp_report_cb_t report_cb)
+{
+    s_tp_report_cb = report_cb;
+    tp_config_set_int_cb(report_cb != NULL ? tp_int_cb : NULL);
+}
+
 void tp_init(void)
 {
     tp_config_init((void *)0);
@@ -4,9 +4,15 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/* Called from the I2C DMA completion interrupt with every report read after the TP INT line */
+typedef void (*tp_report_cb_t)(bool pressed, int16_t x, int16_t y);
 
 void tp_set_sleep_mode(bool sleep_enable);
 bool tp_get_data(int16_t *p_x, int16_t *p_y);
+/* Read every report when the TP raises its INT line, NULL to stop */
+void tp_set_report_cb(tp_report_cb_t report_cb);
+/* Read the current report without waiting for the INT line, false if a read is in flight */
+bool tp_read_report_async(void);
 void tp_init(void);
 
 #endif
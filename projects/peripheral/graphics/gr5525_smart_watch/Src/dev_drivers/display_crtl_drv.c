@@ -5,7 +5,9 @@
 #include "display_fls_amo139_360p_qspi_drv.h"
 #include "lv_refr.h"
 #include "system_manager.h"
+#include "render_profiler.h"
 #include "app_log.h"
+#include <string.h>
 
 
 #define FLUSH_SYNC_MODE         1  // 0 - cpu sync wait; 1 - sem async wait
@@ -13,11 +15,30 @@
 #define QSPI_DISP_USE_DYN_MEM   0
 
 #if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
-static lv_area_t const *s_clip_area = NULL;
+static lv_area_t        s_clip_window;              /* invalid area being refreshed */
+static lv_area_t        s_show_window;              /* panel write window */
+static lv_coord_t       s_show_next_row = -1;       /* row of the panel write pointer, -1 for a new clip area or after a skipped band */
 #endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
 
+#if DISP_FLUSH_PIPELINED
+static lv_disp_drv_t * volatile s_flush_drv = NULL;
+#endif // DISP_FLUSH_PIPELINED
+
+/* Pipeline timing, accumulated by disp_crtl_flush()/disp_crtl_wait() and closed in the TX event */
+static disp_crtl_pipe_stats_t   s_pipe_cur;
+static disp_crtl_pipe_stats_t   s_pipe_last;
+static volatile bool            s_pipe_last_valid = false;
+static uint32_t                 s_pipe_frame_start = 0;
+static volatile uint32_t        s_pipe_band_start = 0;
+static volatile bool            s_pipe_band_last = false;
+
 static void     display_qspi_evt_handler(app_qspi_evt_t *p_evt);
 
+static uint32_t _pipe_cycles(void);
+static uint32_t _pipe_cycles_to_us(uint32_t cycles);
+static void     _pipe_band_done(void);
+static void     _pipe_frame_done(uint32_t now);
+
 static void     lv_fps_update(void);
 static void     lv_refresh_fps_draw(void);
 
@@ -52,6 +73,10 @@ void disp_crtl_init(void) {
     _display_sem_give();
 #endif
 
+    /* Cycle counter for the pipeline timing */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
     extern void diag_gpio_pins_init(void) ;
     diag_gpio_pins_init();
     return;
@@ -146,28 +171,49 @@ void disp_crtl_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_
     screen_info.scrn_pixel_height = area->y2 - area->y1 + 1;
     screen_info.scrn_pixel_depth  = 2;
 
+    uint32_t wait_start = _pipe_cycles();
+    if(s_pipe_cur.bands == 0 && s_pipe_cur.skipped == 0) {
+        s_pipe_frame_start = wait_start;
+    }
+
 #if FLUSH_SYNC_MODE == 1
+    render_profiler_zone_begin(rp_wait);
     _display_sem_take();
+    render_profiler_zone_end(RP_ZONE_FLUSH_WAIT, NULL, rp_wait);
 #endif
 
+    s_pipe_cur.stall_us += _pipe_cycles_to_us(_pipe_cycles() - wait_start);
+    s_pipe_cur.bands++;
+    s_pipe_band_last = disp_drv->draw_buf->flushing_last;
+#if DISP_FLUSH_PIPELINED
+    s_flush_drv = disp_drv;
+#endif // DISP_FLUSH_PIPELINED
+
     diag_gpioa_pin_set(APP_IO_PIN_3, true);
     diag_gpioa_pin_set(APP_IO_PIN_4, true);
 
 #if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
-    if (s_clip_area)
+    if (area->y1 == s_show_next_row && area->x1 == s_show_window.x1 && area->x2 == s_show_window.x2 && area->y2 <= s_show_window.y2)
     {
-#if SCREEN_TYPE == 0
-        qspi_screen_set_show_area(s_clip_area->x1, s_clip_area->x2, s_clip_area->y1, s_clip_area->y2);
-#elif SCREEN_TYPE == 1
-		display_fls_amo139_set_show_area(s_clip_area->x1, s_clip_area->x2, s_clip_area->y1, s_clip_area->y2);
-#endif
-        s_clip_area = NULL;
+        // Do whatever "first call" do except send leading address
+        screen_cmd.leading_address = screen_cmd.ongoing_address;
     }
     else
     {
-        // Do whatever "first call" do except send leading address
-        screen_cmd.leading_address = screen_cmd.ongoing_address;
+        // First band of the clip area, or a band after a skipped or narrowed one: open the window
+        // down to the clip area end, so the next bands of the same width continue in it
+        s_show_window = *area;
+        if (area->x1 == s_clip_window.x1 && area->x2 == s_clip_window.x2)
+        {
+            s_show_window.y2 = s_clip_window.y2;
+        }
+#if SCREEN_TYPE == 0
+        qspi_screen_set_show_area(s_show_window.x1, s_show_window.x2, s_show_window.y1, s_show_window.y2);
+#elif SCREEN_TYPE == 1
+		display_fls_amo139_set_show_area(s_show_window.x1, s_show_window.x2, s_show_window.y1, s_show_window.y2);
+#endif
     }
+    s_show_next_row = area->y2 + 1;
 
 #if SCREEN_TYPE == 1
     if (g_need_te_sync)
@@ -189,6 +235,7 @@ void disp_crtl_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_
     qspi_display_clear_flag();
 #endif
 
+    s_pipe_band_start = _pipe_cycles();
     app_qspi_send_display_frame(APP_QSPI_ID_2, &screen_cmd, &screen_info, (const uint8_t *)draw_buf->buf_act);
 
 #if FLUSH_SYNC_MODE == 0
@@ -200,10 +247,61 @@ void disp_crtl_set_show(void) {
 
 }
 
+void disp_crtl_skip(lv_disp_drv_t * disp_drv, const lv_area_t * area) {
+
+    if(disp_drv->draw_buf->flushing_last) {
+        lv_fps_update();
+    }
+
+#if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+    /* The write pointer stays before the skipped band */
+    s_show_next_row = -1;
+#endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+
+    /* Without DISP_FLUSH_PIPELINED the previous band may still be on the bus */
+    GLOBAL_EXCEPTION_DISABLE();
+    uint32_t now = _pipe_cycles();
+    if(s_pipe_cur.bands == 0 && s_pipe_cur.skipped == 0) {
+        s_pipe_frame_start = now;
+    }
+    s_pipe_cur.skipped++;
+    if(disp_drv->draw_buf->flushing_last) {
+        _pipe_frame_done(now);
+    }
+    GLOBAL_EXCEPTION_ENABLE();
+}
+
+void disp_crtl_wait(void) {
+#if FLUSH_SYNC_MODE == 1
+    uint32_t wait_start = _pipe_cycles();
+
+    /* The TX event gives the semaphore after lv_disp_flush_ready(), hand it back for the next flush */
+    render_profiler_zone_begin(rp_wait);
+    _display_sem_take();
+    _display_sem_give();
+    render_profiler_zone_end(RP_ZONE_FLUSH_WAIT, NULL, rp_wait);
+
+    s_pipe_cur.stall_us += _pipe_cycles_to_us(_pipe_cycles() - wait_start);
+#endif
+}
+
+bool disp_crtl_pipe_stats_get(disp_crtl_pipe_stats_t *p_stats) {
+    if(!s_pipe_last_valid) {
+        return false;
+    }
+
+    GLOBAL_EXCEPTION_DISABLE();
+    *p_stats = s_pipe_last;
+    GLOBAL_EXCEPTION_ENABLE();
+
+    return true;
+}
+
 #if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
 void disp_crtl_set_clip_area(const lv_area_t *clip_area)
 {
-    s_clip_area = clip_area;
+    s_clip_window   = *clip_area;
+    s_show_next_row = -1;
 }
 #endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
 
@@ -216,15 +314,9 @@ static void display_qspi_evt_handler(app_qspi_evt_t *p_evt) {
     switch (p_evt->type)
     {
         case APP_QSPI_EVT_TX_CPLT:
-#if FLUSH_SYNC_MODE== 0
-            is_display_cmplt = true;
-#else
-            _display_sem_give();
-#endif // FLUSH_SYNC_MODE== 0
-            break;
-
         case APP_QSPI_EVT_ERROR:
         case APP_QSPI_EVT_ABORT:
+            _pipe_band_done();
 #if FLUSH_SYNC_MODE== 0
             is_display_cmplt = true;
 #else
@@ -237,6 +329,41 @@ static void display_qspi_evt_handler(app_qspi_evt_t *p_evt) {
     }
 }
 
+/* Runs in the QSPI DMA interrupt once a band left the bus */
+static void _pipe_band_done(void) {
+    uint32_t now = _pipe_cycles();
+
+    s_pipe_cur.bus_us += _pipe_cycles_to_us(now - s_pipe_band_start);
+
+    if(s_pipe_band_last) {
+        _pipe_frame_done(now);
+    }
+
+#if DISP_FLUSH_PIPELINED
+    /* Release the draw buffer before waking up disp_crtl_wait() */
+    if(s_flush_drv) {
+        lv_disp_flush_ready(s_flush_drv);
+        s_flush_drv = NULL;
+    }
+#endif // DISP_FLUSH_PIPELINED
+}
+
+static void _pipe_frame_done(uint32_t now) {
+    s_pipe_cur.frame_us   = _pipe_cycles_to_us(now - s_pipe_frame_start);
+    s_pipe_cur.overlap_us = (s_pipe_cur.bus_us > s_pipe_cur.stall_us) ? (s_pipe_cur.bus_us - s_pipe_cur.stall_us) : 0;
+    s_pipe_last           = s_pipe_cur;
+    s_pipe_last_valid     = true;
+    memset(&s_pipe_cur, 0, sizeof(s_pipe_cur));
+}
+
+static uint32_t _pipe_cycles(void) {
+    return DWT->CYCCNT;
+}
+
+static uint32_t _pipe_cycles_to_us(uint32_t cycles) {
+    return cycles / (SystemCoreClock / 1000000u);
+}
+
 #if FLUSH_SYNC_MODE == 0
 static void qspi_display_clear_flag(void) {
     is_display_cmplt = false;
@@ -255,6 +382,7 @@ static void qspi_display_wait_cplt(void) {
 #define LV_SHOW_FPS_IN_UART                         1
 #define LV_CALC_AVG_FPS                             1
 #define LV_FPS_CACHE_NB                             4
+#define LV_SHOW_PIPE_IN_UART                        0   // print disp_crtl_pipe_stats_t once per second
 
 /*
  * EXTERNAL DECLARATION
@@ -292,6 +420,13 @@ static void lv_fps_update(void){
 #if LV_SHOW_FPS_IN_UART
         //APP_LOG_DEBUG("FPS: %d, CPU: %d \n", s_refresh_fps, sys_cpu_usage());
         // printf("%.2f FPS\n", 1000.f * s_frame_flushed / elapse);
+#endif
+#if LV_SHOW_PIPE_IN_UART
+        disp_crtl_pipe_stats_t pipe;
+        if(disp_crtl_pipe_stats_get(&pipe)) {
+            printf("PIPE: frame %dus, bus %dus, stall %dus, overlap %dus, %d bands, %d skipped\n",
+                   pipe.frame_us, pipe.bus_us, pipe.stall_us, pipe.overlap_us, pipe.bands, pipe.skipped);
+        }
 #endif
         s_frame_flushed = 0;
         s_last_fps_calculated = lv_tick_get();
@@ -11,10 +11,38 @@
 #define TE_SIGNAL_ENABLED   0
 #endif // SCREEN_TYPE == 1
 
+/*
+ * 1 - disp_crtl_flush() only starts the QSPI DMA and returns, lv_disp_flush_ready() is
+ *     called from the TX complete event, so LVGL renders the next band into the other
+ *     draw buffer while the current one is on the bus.
+ * 0 - disp_crtl_flush() returns with the band queued and the caller marks it flushed.
+ */
+#define DISP_FLUSH_PIPELINED    1
+
+/* Pipeline timing of one frame (first band queued -> last band sent), unit in us */
+typedef struct
+{
+    uint32_t frame_us;          /* first band queued to last TX complete */
+    uint32_t bus_us;            /* sum of the QSPI band transfers */
+    uint32_t stall_us;          /* render side blocked waiting for the bus */
+    uint32_t overlap_us;        /* bus time hidden behind rendering, bus_us - stall_us */
+    uint16_t bands;             /* bands sent in the frame */
+    uint16_t skipped;           /* bands not sent because the panel already shows them */
+} disp_crtl_pipe_stats_t;
+
 void disp_crtl_init(void);
 void disp_crtl_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
 void disp_crtl_set_show(void);
 
+/* Account a band that is not sent (its pixels are unchanged), the caller marks it flushed */
+void disp_crtl_skip(lv_disp_drv_t * disp_drv, const lv_area_t * area);
+
+/* Block until the band on the bus is sent, used as lv_disp_drv_t.wait_cb */
+void disp_crtl_wait(void);
+
+/* Timing of the last completed frame, returns false before the first frame */
+bool disp_crtl_pipe_stats_get(disp_crtl_pipe_stats_t *p_stats);
+
 #if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
 void disp_crtl_set_clip_area(const lv_area_t *clip_area);
 #else
@@ -1,6 +1,7 @@
 #include <stdint.h>
 #include "app_qspi.h"
 #include "qspi_flash.h"
+#include "qspi_psram.h"
 
 
 /*
@@ -10,6 +11,15 @@
 #define Q_NOR_FLASH_CLOCK_PREESCALER                2u
 #define Q_NOR_FLASH_PIN_GROUP                       QSPI0_PIN_GROUP_0
 
+/*
+ * PSRAM Device Setting, only used when BOARD_QSPI1_PSRAM is set (see lv_port_disp.c)
+ */
+#define PSRAM_QSPI_ID                               APP_QSPI_ID_1
+#define PSRAM_CLOCK_PREESCALER                      2u
+#define PSRAM_PIN_GROUP                             QSPI1_PIN_GROUP_0
+#define PSRAM_XIP_BASE                              QSPI1_XIP_BASE
+#define PSRAM_SIZE                                  (8u * 1024u * 1024u)    /* APS6404L, 64 Mbit */
+
 void gx_flash_init()
 {
     uint8_t flash_id = SPI_FLASH_init(Q_NOR_FLASH_QSPI_ID, Q_NOR_FLASH_CLOCK_PREESCALER, Q_NOR_FLASH_PIN_GROUP);
@@ -25,3 +35,17 @@ void gx_flash_init()
     app_qspi_config_memory_mappped(Q_NOR_FLASH_QSPI_ID, dev);
     app_qspi_mmap_set_endian_mode(Q_NOR_FLASH_QSPI_ID, APP_QSPI_MMAP_ENDIAN_MODE_2);
 }
+
+void *gx_psram_init(uint32_t *p_size)
+{
+    /* qspi_psram_init_as_xip() returns the low byte of the ID */
+    uint32_t psram_id = qspi_psram_init_as_xip(PSRAM_QSPI_ID, PSRAM_CLOCK_PREESCALER, PSRAM_PIN_GROUP);
+    if(psram_id != (PSRAM_DEVICE_ID & 0xFFu))
+    {
+        printf("PSRAM init error\r\n");
+        *p_size = 0;
+        return NULL;
+    }
+    *p_size = PSRAM_SIZE;
+    return (void *)PSRAM_XIP_BASE;
+}
@@ -4,4 +4,11 @@
 #include "lv_port_disp.h"
 
 void gx_flash_init(void);
+
+/**
+ * @brief Initialize the QSPI PSRAM and map it for XIP (read and write).
+ * @param p_size returns the size of the mapped region, 0 on failure
+ * @return start of the mapped region, NULL on failure
+ */
+void *gx_psram_init(uint32_t *p_size);
 #endif
@@ -1,11 +1,13 @@
 #include "tp_config.h"
 #include "app_gpiote.h"
 #include "app_i2c.h"
+#include "app_i2c_dma.h"
 #include "grx_hal.h"
 #include <stdbool.h>
 #include "lvgl.h"
 
 static tp_int_cb_func_t s_tp_int_cb = NULL;
+static volatile tp_read_cb_func_t s_tp_read_cb = NULL;
 
 static void tp_interrupt_callback(app_io_evt_t *p_evt)
 {
@@ -18,6 +20,17 @@ static void tp_interrupt_callback(app_io_evt_t *p_evt)
     }
 }
 
+static void tp_i2c_evt_handler(app_i2c_evt_t *p_evt)
+{
+    tp_read_cb_func_t read_cb = s_tp_read_cb;
+
+    if(read_cb != NULL)
+    {
+        s_tp_read_cb = NULL;
+        read_cb(p_evt->type == APP_I2C_EVT_RX_DATA);
+    }
+}
+
 
 static void tp_pin_init(void)
 {
@@ -81,11 +94,46 @@ bool tp_read(uint8_t reg_addr, uint8_t *buffer, uint16_t len)
     return true;
 }
 
+bool tp_read_async(uint8_t reg_addr, uint8_t *buffer, uint16_t len, tp_read_cb_func_t read_cb)
+{
+    uint16_t ret = 0;
+    bool     busy;
+
+    /* The INT line and the indev task may both start a read */
+    GLOBAL_EXCEPTION_DISABLE();
+    busy = (s_tp_read_cb != NULL);
+    if (!busy)
+    {
+        s_tp_read_cb = read_cb;
+    }
+    GLOBAL_EXCEPTION_ENABLE();
+
+    if (busy)
+    {
+        return false;
+    }
+
+    ret = app_i2c_dma_mem_read_async(TP_I2C_ID, TP_I2C_ADDR, reg_addr, I2C_MEMADD_SIZE_8BIT, buffer, len);
+    if (ret != APP_DRV_SUCCESS)
+    {
+        s_tp_read_cb = NULL;
+        return false;
+    }
+    return true;
+}
+
+
+void tp_config_set_int_cb(tp_int_cb_func_t tp_int_cb)
+{
+    s_tp_int_cb = tp_int_cb;
+}
+
 app_i2c_params_t tp_params = TP_I2C_PARAM_CONFIG;
 void tp_config_init(tp_int_cb_func_t tp_int_cb)
 {
     s_tp_int_cb = tp_int_cb;
-    app_i2c_init(&tp_params, NULL);
+    app_i2c_init(&tp_params, tp_i2c_evt_handler);
+    app_i2c_dma_init(&tp_params);
 
     tp_pin_init();
     tp_rst();
@@ -132,10 +132,14 @@
 #define TP_I2C_ADDR          (0x2C)
 
 typedef void (*tp_int_cb_func_t)(void);
+typedef void (*tp_read_cb_func_t)(bool success);
 
 
 bool tp_write(uint8_t reg_addr, uint8_t value);
 bool tp_read(uint8_t reg_addr, uint8_t *buffer, uint16_t len);
+/* DMA read, read_cb is called from the I2C interrupt. false if a read is already in flight */
+bool tp_read_async(uint8_t reg_addr, uint8_t *buffer, uint16_t len, tp_read_cb_func_t read_cb);
+void tp_config_set_int_cb(tp_int_cb_func_t tp_int_cb);
 void tp_config_init(tp_int_cb_func_t tp_int_cb);
 
 #endif
@@ -376,6 +376,10 @@ static void indev_pointer_proc(lv_indev_t * i, lv_indev_data_t * data)
 
     i->proc.types.pointer.act_point.x = data->point.x;
     i->proc.types.pointer.act_point.y = data->point.y;
+#if LV_GDX_PATCH_INDEV_THROW_VECT
+    i->proc.types.pointer.drv_throw_vect = data->throw_vect;
+    i->proc.types.pointer.has_drv_throw_vect = data->has_throw_vect;
+#endif
 
     if(i->proc.state == LV_INDEV_STATE_PRESSED) {
         indev_proc_press(&i->proc);
@@ -920,8 +924,17 @@ static void indev_proc_press(_lv_indev_proc_t * proc)
     proc->types.pointer.vect.x = proc->types.pointer.act_point.x - proc->types.pointer.last_point.x;
     proc->types.pointer.vect.y = proc->types.pointer.act_point.y - proc->types.pointer.last_point.y;
 
-    proc->types.pointer.scroll_throw_vect.x = (proc->types.pointer.scroll_throw_vect.x + proc->types.pointer.vect.x) / 2;
-    proc->types.pointer.scroll_throw_vect.y = (proc->types.pointer.scroll_throw_vect.y + proc->types.pointer.vect.y) / 2;
+#if LV_GDX_PATCH_INDEV_THROW_VECT
+    if(proc->types.pointer.has_drv_throw_vect) {
+        /*The driver measured the velocity from timestamped samples, no need to filter*/
+        proc->types.pointer.scroll_throw_vect = proc->types.pointer.drv_throw_vect;
+    }
+    else
+#endif
+    {
+        proc->types.pointer.scroll_throw_vect.x = (proc->types.pointer.scroll_throw_vect.x + proc->types.pointer.vect.x) / 2;
+        proc->types.pointer.scroll_throw_vect.y = (proc->types.pointer.scroll_throw_vect.y + proc->types.pointer.vect.y) / 2;
+    }
 
     proc->types.pointer.scroll_throw_vect_ori = proc->types.pointer.scroll_throw_vect;
 
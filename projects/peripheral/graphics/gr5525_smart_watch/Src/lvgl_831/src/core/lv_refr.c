@@ -18,6 +18,7 @@
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
+#include "render_profiler.h"
 
 #if LV_USE_PERF_MONITOR || LV_USE_MEM_MONITOR
     #include "../widgets/lv_label.h"
@@ -281,6 +282,22 @@ lv_disp_t * _lv_refr_get_disp_refreshing(void)
     return disp_refr;
 }
 
+#if LV_GDX_PATCH_ROUND_DISP
+bool _lv_refr_area_is_visible(const lv_area_t * area_p)
+{
+    const lv_coord_t * round_inset = disp_refr->driver->round_inset;
+    if(round_inset == NULL) return true;
+
+    /*The row closest to the center line has the widest visible span*/
+    lv_coord_t ver_max = lv_disp_get_ver_res(disp_refr) - 1;
+    lv_coord_t row = LV_CLAMP(area_p->y1, ver_max / 2, area_p->y2);
+    if(row < 0 || row > ver_max) return false;
+
+    lv_coord_t inset = round_inset[row];
+    return area_p->x2 >= inset && area_p->x1 <= lv_disp_get_hor_res(disp_refr) - 1 - inset;
+}
+#endif // LV_GDX_PATCH_ROUND_DISP
+
 /**
  * Set the display which is being refreshed.
  * It shouldn't be used directly by the user.
@@ -318,11 +335,13 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     }
 
     /*Refresh the screen's layout if required*/
+    render_profiler_zone_begin(rp_layout);
     lv_obj_update_layout(disp_refr->act_scr);
     if(disp_refr->prev_scr) lv_obj_update_layout(disp_refr->prev_scr);
 
     lv_obj_update_layout(disp_refr->top_layer);
     lv_obj_update_layout(disp_refr->sys_layer);
+    render_profiler_zone_end(RP_ZONE_LAYOUT, NULL, rp_layout);
 
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
@@ -486,6 +505,12 @@ __attribute__((unused)) static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
+#if LV_GDX_PATCH_JOIN_AREA_CB
+    if(disp_refr->driver->join_area_cb) {
+        disp_refr->driver->join_area_cb(disp_refr->driver, disp_refr->inv_areas, disp_refr->inv_area_joined, disp_refr->inv_p);
+        return;
+    }
+#endif // LV_GDX_PATCH_JOIN_AREA_CB
     for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
         if(disp_refr->inv_area_joined[join_in] != 0) continue;
 
@@ -616,6 +641,9 @@ static void refr_area(const lv_area_t * area_p)
         draw_ctx->buf = disp_refr->driver->draw_buf->buf_act;
         if(sub_area.y2 > y2) sub_area.y2 = y2;
         row_last = sub_area.y2;
+#if LV_GDX_PATCH_ROUND_DISP
+        if(disp_refr->driver->band_area_cb) disp_refr->driver->band_area_cb(disp_refr->driver, &sub_area);
+#endif // LV_GDX_PATCH_ROUND_DISP
         if(y2 == row_last) disp_refr->driver->draw_buf->last_part = 1;
         refr_area_part(draw_ctx);
     }
@@ -631,6 +659,9 @@ static void refr_area(const lv_area_t * area_p)
         draw_ctx->clip_area = &sub_area;
         draw_ctx->buf = disp_refr->driver->draw_buf->buf_act;
         disp_refr->driver->draw_buf->last_part = 1;
+#if LV_GDX_PATCH_ROUND_DISP
+        if(disp_refr->driver->band_area_cb) disp_refr->driver->band_area_cb(disp_refr->driver, &sub_area);
+#endif // LV_GDX_PATCH_ROUND_DISP
         refr_area_part(draw_ctx);
     }
 }
@@ -82,6 +82,15 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p);
  */
 lv_disp_t * _lv_refr_get_disp_refreshing(void);
 
+#if LV_GDX_PATCH_ROUND_DISP
+/**
+ * Check whether an area has any pixel on the visible part of the display being refreshed
+ * @param area_p pointer to an area
+ * @return false if the area is entirely in the invisible corners (see lv_disp_drv_t.round_inset)
+ */
+bool _lv_refr_area_is_visible(const lv_area_t * area_p);
+#endif // LV_GDX_PATCH_ROUND_DISP
+
 /**
  * Set the display which is being refreshed.
  * It shouldn't be used directly by the user.
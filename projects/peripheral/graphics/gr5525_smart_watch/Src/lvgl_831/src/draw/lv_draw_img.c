@@ -13,6 +13,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
+#include "render_profiler.h"
 
 #if LV_GDX_PATCH_GX_IMG > 0u
 #include "lv_port_gximg.h"
@@ -77,12 +78,14 @@ void lv_draw_img(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * dsc, const
     if(dsc->opa <= LV_OPA_MIN) return;
 
     lv_res_t res;
+    render_profiler_zone_begin(rp_img);
     if(draw_ctx->draw_img) {
         res = draw_ctx->draw_img(draw_ctx, dsc, coords, src);
     }
     else {
         res = decode_and_draw(draw_ctx, dsc, coords, src);
     }
+    render_profiler_count_end(RP_ZONE_IMG, rp_img);
 
     if(res == LV_RES_INV) {
         LV_LOG_WARN("Image draw error");
@@ -290,6 +293,11 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
         lv_port_gximg_draw(draw_ctx, draw_dsc, coords, cdsc->dec_dsc.src, false, false);
         return LV_RES_OK;
     }
+    else if (cdsc->dec_dsc.header.cf == LV_IMG_CF_GDX_RLE_RGB565)
+    {
+        lv_port_gximg_draw_rle(draw_ctx, draw_dsc, coords, cdsc->dec_dsc.src);
+        return LV_RES_OK;
+    }
     else if (cdsc->dec_dsc.header.cf == LV_IMG_CF_GDX_GXIMG_BUNDLE)
     {
         lv_port_gximg_draw_bundle(draw_ctx, draw_dsc, coords, cdsc->dec_dsc.src);
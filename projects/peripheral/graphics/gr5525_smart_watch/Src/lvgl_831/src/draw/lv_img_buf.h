@@ -80,6 +80,7 @@ enum {
     LV_IMG_CF_GDX_SIMP_RGB565,          /**< Defined by goodix, just used for simple rgb565 image, no transform effects(scale, rotation, opa) */
     LV_IMG_CF_GDX_GXIMG,
     LV_IMG_CF_GDX_GXIMG_BUNDLE,
+    LV_IMG_CF_GDX_RLE_RGB565,           /**< Defined by goodix, opaque rgb565 image compressed per row, see lv_port_gximg.h */
 #endif
 
     LV_IMG_CF_RGB888,
@@ -29,6 +29,8 @@
 #if LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
 LV_ATTRIBUTE_FAST_MEM void draw_letter_normal_opt(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                                      const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p);
+LV_ATTRIBUTE_FAST_MEM void draw_letter_blend_opt(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                 const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p);
 #endif
 LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                                      const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p);
@@ -175,13 +177,21 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
     }
     else {
 #if LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
-        if (dsc->bg_opaque)
+        /* Both fast paths write RGB565 4 bpp glyphs straight into the buffer: masks, other
+         * blend modes and bpp take the generic path */
+        lv_area_t letter_area;
+        lv_area_set(&letter_area, gpos.x, gpos.y, gpos.x + g.box_w - 1, gpos.y + g.box_h - 1);
+        if (g.bpp != 4 || dsc->blend_mode != LV_BLEND_MODE_NORMAL || lv_draw_mask_is_any(&letter_area))
+        {
+            draw_letter_normal(draw_ctx, dsc, &gpos, &g, map_p);
+        }
+        else if (dsc->bg_opaque)
         {
             draw_letter_normal_opt(draw_ctx, dsc, &gpos, &g, map_p);
         }
         else
         {
-            draw_letter_normal(draw_ctx, dsc, &gpos, &g, map_p);
+            draw_letter_blend_opt(draw_ctx, dsc, &gpos, &g, map_p);
         }
 #else
         draw_letter_normal(draw_ctx, dsc, &gpos, &g, map_p);
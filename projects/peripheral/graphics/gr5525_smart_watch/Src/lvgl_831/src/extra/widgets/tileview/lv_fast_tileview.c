@@ -16,6 +16,17 @@
  * 2、显示，LV_EVENT_READY，此时可以获取资源，并开始实时更新页面中的内容。
  * 3、暂停，LV_EVENT_CANCEL，此时需要释放资源，并停止更新页面中的内容。
  * 4、销毁，LV_EVENT_DELETE，一般不需要处理。
+ * 5、恢复，LV_EVENT_REFRESH，仅对设置了 lv_fast_tileview_set_keep_alive() 的页面：离开时页面被隐藏并缓存，而不是销毁，
+ *    再次显示时不会重新创建，而是先收到该事件以更新数据，然后再收到 LV_EVENT_READY。
+ *
+ * 滑动切换时（LV_FAST_TILEVIEW_SNAPSHOT），2个页面先各自渲染一次快照，动画期间页面被隐藏，只绘制快照，
+ * 帧率不再受页面复杂度影响。动画结束后再显示页面本身。快照优先放在LVGL堆中，放不下就放在
+ * lv_fast_tileview_set_snapshot_pool() 提供的内存中（如XIP映射的PSRAM）。
+ *
+ * 建造耗时的页面可以分步建造（lv_fast_tileview_build_later()）：建造者函数只创建占位内容，其余部分在之后的
+ * lv_task_handler()中按时间片（LV_FAST_TILEVIEW_BUILD_SLICE_US）逐步创建，全部完成后页面才收到 LV_EVENT_READY。
+ * 空闲时（LV_FAST_TILEVIEW_PREFETCH）会预先建造当前页面的相邻页面，放入页面缓存，滑入时不用再创建。
+ * 每个页面的创建耗时记录在统计表中，用 lv_fast_tileview_dump_stats() 打印。
  *
  * 使用技巧：
  * 1、侧滑返回功能：在tile的建造者函数lv_fast_tileview_create_tile_cb中，调用lv_fast_tileview_pop()函数并且return NULL，就能实现该效果。
@@ -29,6 +40,12 @@
  *********************/
 #include "lv_fast_tileview.h"
 #include "../../../core/lv_indev.h"
+#include "../../../draw/lv_img_cache.h"
+#include "../../others/snapshot/lv_snapshot.h"
+#ifdef LV_FAST_TILEVIEW_CLOCK_INCLUDE
+#include LV_FAST_TILEVIEW_CLOCK_INCLUDE
+#endif
+#include <stdio.h>
 
 #if LV_GDX_PATCH_USE_FAST_TILEVIEW
 /*********************
@@ -37,6 +54,12 @@
 #define TRANSLATION_THRESHOLD (DISP_VER_RES / 4)
 #define SCROLL_ANIM_TIME_MIN    200    /*ms*/
 #define SCROLL_ANIM_TIME_MAX    400    /*ms*/
+#define TILE_CACHE_MEM_LOW      (8U * 1024U)    /*free lv_mem bytes, below it cached tiles are evicted ...*/
+#define TILE_CACHE_MEM_HIGH     (12U * 1024U)   /*... until this much is free again*/
+#define SNAPSHOT_MEM_RESERVE    (8U * 1024U)    /*lv_mem bytes left to the tiles when a snapshot is put in the LVGL heap*/
+#define PREFETCH_MEM_MIN        (20U * 1024U)   /*free lv_mem bytes needed to build a neighbour tile ahead*/
+#define PREFETCH_ALL_DONE       0x0FU
+#define STAT_ID_NONE            0xFFU
 
 //#undef LV_GDX_PATCH_DISABLE_STYLE_REFRESH      // for test
 //#define LV_GDX_PATCH_DISABLE_STYLE_REFRESH 0
@@ -44,6 +67,19 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_FAST_TILEVIEW_STAT_CNT > 0
+typedef struct {
+    int16_t map_id;
+    int16_t row;
+    int16_t col;
+    uint16_t create_cnt;
+    uint16_t build_cnt;
+    uint32_t create_sum_us;
+    uint32_t create_max_us;
+    uint32_t build_sum_us;
+    uint32_t build_max_us;
+} _tile_stat_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -53,6 +89,37 @@ static void fast_tileview_evt_cb(const lv_obj_class_t *p_class, lv_event_t * e);
 static void _lv_fast_tileview_complete_translation(lv_fast_tileview_t * tv);
 static void _move_tile_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y);
 static lv_fast_tileview_t * _obtain_fast_tileview(lv_obj_t * from_obj);
+static lv_obj_t * _obtain_tile(lv_fast_tileview_t * tv, int map_id, int row, int col, lv_fast_tileview_transition_effect_t * p_effect);
+static void _release_tile(lv_fast_tileview_t * tv, lv_obj_t * tile, int map_id, int row, int col);
+static lv_obj_t * _create_tile(lv_fast_tileview_t * tv, int map_id, int row, int col, lv_fast_tileview_transition_effect_t * p_effect);
+static void _delete_tile(lv_fast_tileview_t * tv, lv_obj_t * tile);
+static void _start_tile(lv_fast_tileview_t * tv, lv_obj_t * tile);
+static void _stop_tile(lv_fast_tileview_t * tv, lv_obj_t * tile);
+static _lv_fast_tileview_build_job_t * _build_job_find(lv_fast_tileview_t * tv, lv_obj_t * tile);
+static bool _build_jobs_run(lv_fast_tileview_t * tv);
+static void _build_job_done(lv_fast_tileview_t * tv, _lv_fast_tileview_build_job_t * p_job);
+static void _worker_cb(lv_timer_t * timer);
+static void _worker_update(lv_fast_tileview_t * tv);
+#if LV_FAST_TILEVIEW_PREFETCH
+static void _prefetch_one(lv_fast_tileview_t * tv);
+#endif
+#if LV_FAST_TILEVIEW_STAT_CNT > 0
+static uint8_t _stat_get(int map_id, int row, int col);
+#endif
+#if LV_FAST_TILEVIEW_CACHE_CNT > 0
+static _lv_fast_tileview_tile_cache_entry_t * _tile_cache_find(lv_fast_tileview_t * tv, int map_id, int row, int col);
+static _lv_fast_tileview_tile_cache_entry_t * _tile_cache_free_slot(lv_fast_tileview_t * tv);
+static void _tile_cache_put(lv_fast_tileview_t * tv, lv_obj_t * tile, int map_id, int row, int col);
+static bool _tile_cache_evict_oldest(lv_fast_tileview_t * tv);
+static void _tile_cache_trim(lv_fast_tileview_t * tv);
+#endif
+static void _shift_tile(lv_fast_tileview_t * tv, lv_obj_t * tile, lv_coord_t diff_x, lv_coord_t diff_y);
+#if LV_FAST_TILEVIEW_SNAPSHOT
+static void _snapshot_get_area(const _lv_fast_tileview_snapshot_t * p_snap, lv_area_t * p_area);
+static void _snapshot_begin(lv_fast_tileview_t * tv);
+static void _snapshot_end(lv_fast_tileview_t * tv);
+static void _snapshot_draw(lv_fast_tileview_t * tv, lv_draw_ctx_t * draw_ctx);
+#endif
 #if LV_GDX_PATCH_DISABLE_STYLE_REFRESH
 static lv_obj_t * _try_create_tile(lv_fast_tileview_t * tv, int new_map_id, int new_row, int new_col, lv_fast_tileview_transition_effect_t * p_effect);
 #else
@@ -62,6 +129,14 @@ static lv_obj_t * _try_create_tile(lv_fast_tileview_t * tv, int new_map_id, int
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_FAST_TILEVIEW_SNAPSHOT
+static uint8_t * s_snapshot_pool = NULL;
+static uint32_t s_snapshot_pool_size = 0;
+#endif
+#if LV_FAST_TILEVIEW_STAT_CNT > 0
+static _tile_stat_t s_tile_stats[LV_FAST_TILEVIEW_STAT_CNT];
+static uint8_t s_tile_stat_cnt = 0;
+#endif
 
 const lv_obj_class_t lv_fast_tileview_class = {.constructor_cb = lv_fast_tileview_constructor,
                                           .base_class = &lv_obj_class,
@@ -92,14 +167,15 @@ lv_fast_tileview_t * lv_fast_tileview_create(lv_obj_t * parent, lv_fast_tileview
     // create first tile.
     tv->current_map_id = 0;
     tv->is_creating = true;
-    tv->p_current_tile_obj = _try_create_tile(tv, 0, 0, 0, &tv->effect);
+    tv->p_current_tile_obj = _obtain_tile(tv, 0, 0, 0, &tv->effect);
     tv->is_creating = false;
 
     if (tv->p_current_tile_obj) {
         lv_obj_set_size(tv->p_current_tile_obj, LV_PCT(100), LV_PCT(100));
         //lv_obj_update_layout(tv->p_current_tile_obj);  /*Be sure the size is correct*/
-        lv_event_send(tv->p_current_tile_obj, LV_EVENT_TILE_STARTED, NULL);
+        _start_tile(tv, tv->p_current_tile_obj);
     }
+    _worker_update(tv);
     return tv;
 }
 
@@ -128,7 +204,7 @@ void lv_fast_tileview_push(lv_obj_t * from_obj, int map_id, int row, int col/*,
 
     // 创建新界面
     tv->is_creating = true;
-    lv_obj_t * p_next_tile_obj = _try_create_tile(tv, map_id, row, col, &tv->effect);
+    lv_obj_t * p_next_tile_obj = _obtain_tile(tv, map_id, row, col, &tv->effect);
     tv->is_creating = false;
     if (p_next_tile_obj == NULL) return;
 
@@ -188,7 +264,7 @@ void lv_fast_tileview_push(lv_obj_t * from_obj, int map_id, int row, int col/*,
     // switch(birthplace) {} 设定新的页面的初始位置
 
     // 通知当前页面即将发生页面切换
-    lv_event_send(tv->p_current_tile_obj, LV_EVENT_TILE_STOPPED, NULL);
+    _stop_tile(tv, tv->p_current_tile_obj);
 
     // 特殊处理无切换效果的情况
     // if (effect == LV_FAST_TILEVIEW_EFFECT_NONE) {}
@@ -224,7 +300,7 @@ void lv_fast_tileview_pop(lv_obj_t * from_obj)
         // 创建下一个页面
         lv_fast_tileview_transition_effect_t dummy_effect; // 目前不支持使用滚动效果跳转页面，忽略效果参数
         tv->is_creating = true;
-        lv_obj_t * p_next_tile_obj = _try_create_tile(tv, p_frame->map_id, p_frame->row, p_frame->col, &dummy_effect);
+        lv_obj_t * p_next_tile_obj = _obtain_tile(tv, p_frame->map_id, p_frame->row, p_frame->col, &dummy_effect);
         tv->is_creating = false;
         if (p_next_tile_obj == NULL) {
             // 如果创建失败，就自动尝试继续弹出
@@ -243,7 +319,7 @@ void lv_fast_tileview_pop(lv_obj_t * from_obj)
 
         // 发送生命周期事件
         // 通知当前页面即将发生页面切换
-        lv_event_send(tv->p_current_tile_obj, LV_EVENT_TILE_STOPPED, NULL);
+        _stop_tile(tv, tv->p_current_tile_obj);
 
         // 显示新的页面
         _lv_fast_tileview_complete_translation(tv);
@@ -272,7 +348,7 @@ void lv_fast_tileview_pop_all(lv_obj_t * from_obj)
     // 创建下一个页面
     lv_fast_tileview_transition_effect_t dummy_effect; // 目前不支持使用滚动效果跳转页面，忽略效果参数
     tv->is_creating = true;
-    lv_obj_t * p_next_tile_obj = _try_create_tile(tv, p_frame->map_id, p_frame->row, p_frame->col, &dummy_effect);
+    lv_obj_t * p_next_tile_obj = _obtain_tile(tv, p_frame->map_id, p_frame->row, p_frame->col, &dummy_effect);
     tv->is_creating = false;
     if (p_next_tile_obj == NULL) return;
 
@@ -288,12 +364,114 @@ void lv_fast_tileview_pop_all(lv_obj_t * from_obj)
 
     // 发送生命周期事件
     // 通知当前页面即将发生页面切换
-    lv_event_send(tv->p_current_tile_obj, LV_EVENT_TILE_STOPPED, NULL);
+    _stop_tile(tv, tv->p_current_tile_obj);
 
     // 显示新的页面
     _lv_fast_tileview_complete_translation(tv);
 }
 
+void lv_fast_tileview_set_keep_alive(lv_obj_t * tile, bool keep_alive)
+{
+    if (keep_alive) {
+        lv_obj_add_flag(tile, LV_FAST_TILEVIEW_FLAG_KEEP_ALIVE);
+    }
+    else {
+        lv_obj_clear_flag(tile, LV_FAST_TILEVIEW_FLAG_KEEP_ALIVE);
+    }
+}
+
+void lv_fast_tileview_cache_clear(lv_obj_t * from_obj)
+{
+#if LV_FAST_TILEVIEW_CACHE_CNT > 0
+    lv_fast_tileview_t * tv = _obtain_fast_tileview(from_obj);
+    if (tv == NULL) return;
+
+    while (_tile_cache_evict_oldest(tv)) {
+    }
+#if LV_FAST_TILEVIEW_PREFETCH
+    // 页面的内容变了，重新预取
+    tv->prefetch_done = 0;
+    for (uint32_t i = 0; i < sizeof(tv->no_prefetch) / sizeof(tv->no_prefetch[0]); i++) {
+        tv->no_prefetch[i].map_id = INT16_MIN;
+    }
+    _worker_update(tv);
+#endif
+#else
+    LV_UNUSED(from_obj);
+#endif
+}
+
+void lv_fast_tileview_build_later(lv_obj_t * tile, lv_fast_tileview_build_step_cb step_cb)
+{
+    lv_fast_tileview_t * tv = _obtain_fast_tileview(tile);
+    _lv_fast_tileview_build_job_t * p_job = NULL;
+    for (uint32_t i = 0; tv != NULL && i < LV_FAST_TILEVIEW_BUILD_JOB_CNT && p_job == NULL; i++) {
+        if (tv->build_jobs[i].p_tile == NULL) {
+            p_job = &tv->build_jobs[i];
+        }
+    }
+    if (p_job == NULL) {
+        // 没有空闲的建造任务，立即建造完整的页面
+        for (uint32_t step = 0; !step_cb(tile, step); step++) {
+        }
+        return;
+    }
+
+    p_job->p_tile = tile;
+    p_job->step_cb = step_cb;
+    p_job->step = 0;
+    p_job->build_us = 0;
+    p_job->stat_id = STAT_ID_NONE;
+    p_job->is_ready_pending = false;
+    _worker_update(tv);
+}
+
+bool lv_fast_tileview_is_prefetching(lv_obj_t * from_obj)
+{
+#if LV_FAST_TILEVIEW_PREFETCH
+    lv_fast_tileview_t * tv = _obtain_fast_tileview(from_obj);
+    return tv != NULL && tv->is_prefetching;
+#else
+    LV_UNUSED(from_obj);
+    return false;
+#endif
+}
+
+void lv_fast_tileview_dump_stats(int (*p_printf)(const char *, ...))
+{
+#if LV_FAST_TILEVIEW_STAT_CNT > 0
+    if (p_printf == NULL) {
+        p_printf = printf;
+    }
+    p_printf("tile(map,row,col)  created  create avg/max(us)  built  build avg/max(us)\n");
+    for (uint32_t i = 0; i < s_tile_stat_cnt; i++) {
+        const _tile_stat_t * p_stat = &s_tile_stats[i];
+        p_printf("(%3d,%3d,%3d)    %7u %9lu %9lu %6u %9lu %8lu%s\n",
+                 p_stat->map_id, p_stat->row, p_stat->col,
+                 (unsigned)p_stat->create_cnt,
+                 (unsigned long)(p_stat->create_cnt ? p_stat->create_sum_us / p_stat->create_cnt : 0),
+                 (unsigned long)p_stat->create_max_us,
+                 (unsigned)p_stat->build_cnt,
+                 (unsigned long)(p_stat->build_cnt ? p_stat->build_sum_us / p_stat->build_cnt : 0),
+                 (unsigned long)p_stat->build_max_us,
+                 p_stat->create_max_us > LV_FAST_TILEVIEW_BUILD_SLICE_US ? "  <- blocks longer than a slice" : "");
+    }
+#else
+    LV_UNUSED(p_printf);
+#endif
+}
+
+void lv_fast_tileview_set_snapshot_pool(void * buf, uint32_t size)
+{
+#if LV_FAST_TILEVIEW_SNAPSHOT
+    s_snapshot_pool = (uint8_t *)buf;
+    s_snapshot_pool_size = buf ? size : 0;
+#else
+    LV_UNUSED(buf);
+    LV_UNUSED(size);
+#endif
+}
+
 /*======================
  * Add/remove functions
  *=====================*/
@@ -307,6 +485,17 @@ static void lv_fast_tileview_constructor(const lv_obj_class_t * class_p, lv_obj_
     // lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
     lv_obj_add_flag(obj, LV_OBJ_FLAG_SCROLL_CUSTOM);
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE); // ensure unscrollable. use special scroll logic instead native scroll logic.
+
+    lv_fast_tileview_t * tv = (lv_fast_tileview_t *)obj;
+    tv->p_worker = lv_timer_create(_worker_cb, LV_FAST_TILEVIEW_PREFETCH_DELAY, tv);
+    if (tv->p_worker) {
+        lv_timer_pause(tv->p_worker);
+    }
+#if LV_FAST_TILEVIEW_PREFETCH
+    for (uint32_t i = 0; i < sizeof(tv->no_prefetch) / sizeof(tv->no_prefetch[0]); i++) {
+        tv->no_prefetch[i].map_id = INT16_MIN;
+    }
+#endif
 }
 
 //static void test_scroll(lv_obj_t * obj, lv_event_t * e)
@@ -367,6 +556,372 @@ static lv_fast_tileview_t * _obtain_fast_tileview(lv_obj_t * from_obj)
     return NULL;
 }
 
+// 优先使用缓存的页面，否则调用建造者函数创建
+static lv_obj_t * _obtain_tile(lv_fast_tileview_t * tv, int map_id, int row, int col, lv_fast_tileview_transition_effect_t * p_effect)
+{
+#if LV_FAST_TILEVIEW_CACHE_CNT > 0
+    _lv_fast_tileview_tile_cache_entry_t * p_entry = _tile_cache_find(tv, map_id, row, col);
+    if (p_entry) {
+        lv_obj_t * tile = p_entry->p_obj;
+        p_entry->p_obj = NULL;
+        // 新的页面要显示在当前页面之上
+        lv_obj_move_to_index(tile, -1);
+        lv_obj_clear_flag(tile, LV_OBJ_FLAG_HIDDEN);
+        // 只让页面更新数据，不重建对象树。还没建造完的页面不处理，建造完成时数据就是最新的
+        if (_build_job_find(tv, tile) == NULL) {
+            lv_event_send(tile, LV_EVENT_REFRESH, NULL);
+        }
+        return tile;
+    }
+
+    // 创建之前，保证有足够的内存
+    _tile_cache_trim(tv);
+#endif
+    return _create_tile(tv, map_id, row, col, p_effect);
+}
+
+// 调用建造者函数，并记录耗时
+static lv_obj_t * _create_tile(lv_fast_tileview_t * tv, int map_id, int row, int col, lv_fast_tileview_transition_effect_t * p_effect)
+{
+#if LV_FAST_TILEVIEW_STAT_CNT > 0
+    uint32_t t_start = LV_FAST_TILEVIEW_CLOCK_US();
+    lv_obj_t * tile = _try_create_tile(tv, map_id, row, col, p_effect);
+    uint32_t us = LV_FAST_TILEVIEW_CLOCK_US() - t_start;
+
+    uint8_t stat_id = tile ? _stat_get(map_id, row, col) : STAT_ID_NONE;
+    if (stat_id != STAT_ID_NONE) {
+        _tile_stat_t * p_stat = &s_tile_stats[stat_id];
+        p_stat->create_cnt++;
+        p_stat->create_sum_us += us;
+        if (us > p_stat->create_max_us) {
+            p_stat->create_max_us = us;
+        }
+        // 分步建造的耗时在建造完成时记录
+        _lv_fast_tileview_build_job_t * p_job = _build_job_find(tv, tile);
+        if (p_job) {
+            p_job->stat_id = stat_id;
+        }
+    }
+    return tile;
+#else
+    return _try_create_tile(tv, map_id, row, col, p_effect);
+#endif
+}
+
+// 销毁页面，没建造完的页面同时放弃建造
+static void _delete_tile(lv_fast_tileview_t * tv, lv_obj_t * tile)
+{
+    _lv_fast_tileview_build_job_t * p_job = _build_job_find(tv, tile);
+    if (p_job) {
+        p_job->p_tile = NULL;
+    }
+    lv_obj_del(tile);
+}
+
+// 页面开始显示。还没建造完的页面，等建造完成后再发送事件
+static void _start_tile(lv_fast_tileview_t * tv, lv_obj_t * tile)
+{
+    _lv_fast_tileview_build_job_t * p_job = _build_job_find(tv, tile);
+    if (p_job) {
+        p_job->is_ready_pending = true;
+        return;
+    }
+    lv_event_send(tile, LV_EVENT_TILE_STARTED, NULL);
+}
+
+// 页面暂停显示。还没建造完的页面没有开始过，不需要暂停
+static void _stop_tile(lv_fast_tileview_t * tv, lv_obj_t * tile)
+{
+    _lv_fast_tileview_build_job_t * p_job = _build_job_find(tv, tile);
+    if (p_job) {
+        p_job->is_ready_pending = false;
+        return;
+    }
+    lv_event_send(tile, LV_EVENT_TILE_STOPPED, NULL);
+}
+
+static _lv_fast_tileview_build_job_t * _build_job_find(lv_fast_tileview_t * tv, lv_obj_t * tile)
+{
+    if (tile == NULL) return NULL;
+    for (uint32_t i = 0; i < LV_FAST_TILEVIEW_BUILD_JOB_CNT; i++) {
+        if (tv->build_jobs[i].p_tile == tile) {
+            return &tv->build_jobs[i];
+        }
+    }
+    return NULL;
+}
+
+// 按时间片运行建造任务，当前页面优先。返回是否还有没完成的任务
+static bool _build_jobs_run(lv_fast_tileview_t * tv)
+{
+    uint32_t t_slice = LV_FAST_TILEVIEW_CLOCK_US();
+    for (;;) {
+        _lv_fast_tileview_build_job_t * p_job = _build_job_find(tv, tv->p_current_tile_obj);
+        for (uint32_t i = 0; i < LV_FAST_TILEVIEW_BUILD_JOB_CNT && p_job == NULL; i++) {
+            if (tv->build_jobs[i].p_tile) {
+                p_job = &tv->build_jobs[i];
+            }
+        }
+        if (p_job == NULL) return false;
+        // 每次至少运行一步
+        if (LV_FAST_TILEVIEW_CLOCK_US() - t_slice >= LV_FAST_TILEVIEW_BUILD_SLICE_US) return true;
+
+        lv_obj_t * tile = p_job->p_tile;
+        uint32_t t_step = LV_FAST_TILEVIEW_CLOCK_US();
+#if LV_GDX_PATCH_DISABLE_STYLE_REFRESH
+        lv_obj_enable_style_refresh(false);
+#endif
+        bool is_done = p_job->step_cb(tile, p_job->step);
+#if LV_GDX_PATCH_DISABLE_STYLE_REFRESH
+        lv_obj_enable_style_refresh(true);
+        lv_obj_refresh_style(tile, LV_PART_ANY, LV_STYLE_PROP_ANY);
+#endif
+        p_job->step++;
+        p_job->build_us += LV_FAST_TILEVIEW_CLOCK_US() - t_step;
+        if (is_done) {
+            _build_job_done(tv, p_job);
+        }
+    }
+}
+
+static void _build_job_done(lv_fast_tileview_t * tv, _lv_fast_tileview_build_job_t * p_job)
+{
+    LV_UNUSED(tv);
+    lv_obj_t * tile = p_job->p_tile;
+    bool is_ready_pending = p_job->is_ready_pending;
+    p_job->p_tile = NULL;
+
+#if LV_FAST_TILEVIEW_STAT_CNT > 0
+    if (p_job->stat_id != STAT_ID_NONE) {
+        _tile_stat_t * p_stat = &s_tile_stats[p_job->stat_id];
+        p_stat->build_cnt++;
+        p_stat->build_sum_us += p_job->build_us;
+        if (p_job->build_us > p_stat->build_max_us) {
+            p_stat->build_max_us = p_job->build_us;
+        }
+    }
+#endif
+    // 页面已经在显示了，现在才开始运行
+    if (is_ready_pending) {
+        lv_event_send(tile, LV_EVENT_TILE_STARTED, NULL);
+    }
+}
+
+static void _worker_cb(lv_timer_t * timer)
+{
+    lv_fast_tileview_t * tv = (lv_fast_tileview_t *)timer->user_data;
+
+    // 滑动期间不打扰动画，没建造完的页面在快照中显示占位内容
+    if (!tv->is_scrolling && !tv->is_animating && tv->p_next_tile_obj == NULL) {
+        if (!_build_jobs_run(tv)) {
+#if LV_FAST_TILEVIEW_PREFETCH
+            _prefetch_one(tv);
+#endif
+        }
+    }
+    _worker_update(tv);
+}
+
+// 有建造任务时每次 lv_task_handler() 都运行，只剩预取时按预取延时运行，否则暂停
+static void _worker_update(lv_fast_tileview_t * tv)
+{
+    if (tv->p_worker == NULL) return;
+
+    for (uint32_t i = 0; i < LV_FAST_TILEVIEW_BUILD_JOB_CNT; i++) {
+        if (tv->build_jobs[i].p_tile) {
+            lv_timer_set_period(tv->p_worker, 1);
+            lv_timer_resume(tv->p_worker);
+            return;
+        }
+    }
+#if LV_FAST_TILEVIEW_PREFETCH
+    if (tv->prefetch_done != PREFETCH_ALL_DONE) {
+        lv_timer_set_period(tv->p_worker, LV_FAST_TILEVIEW_PREFETCH_DELAY);
+        lv_timer_resume(tv->p_worker);
+        return;
+    }
+#endif
+    lv_timer_pause(tv->p_worker);
+}
+
+#if LV_FAST_TILEVIEW_PREFETCH
+static bool _prefetch_is_skipped(lv_fast_tileview_t * tv, int map_id, int row, int col)
+{
+    for (uint32_t i = 0; i < sizeof(tv->no_prefetch) / sizeof(tv->no_prefetch[0]); i++) {
+        const _lv_fast_tileview_tile_stack_frame_t * p_key = &tv->no_prefetch[i];
+        if (p_key->map_id == map_id && p_key->row == row && p_key->col == col) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 空闲时预先建造当前页面的一个相邻页面，放入页面缓存
+static void _prefetch_one(lv_fast_tileview_t * tv)
+{
+    static const int8_t s_neighbours[4][2] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}}; // row, col: 左、右、上、下
+
+    // 用户正在操作时不预取
+    if (lv_disp_get_inactive_time(lv_obj_get_disp(&tv->obj)) < LV_FAST_TILEVIEW_PREFETCH_DELAY) return;
+
+    for (uint32_t i = 0; i < 4; i++) {
+        if (tv->prefetch_done & (1U << i)) continue;
+        tv->prefetch_done |= (1U << i);
+
+        int map_id = tv->current_map_id;
+        int row = tv->current_row + s_neighbours[i][0];
+        int col = tv->current_col + s_neighbours[i][1];
+        if (_tile_cache_find(tv, map_id, row, col) || _prefetch_is_skipped(tv, map_id, row, col)) continue;
+
+        // 不挤掉已经缓存的页面，也不占用页面切换需要的内存
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        if (_tile_cache_free_slot(tv) == NULL || mon.free_size < PREFETCH_MEM_MIN) {
+            tv->prefetch_done = PREFETCH_ALL_DONE;
+            return;
+        }
+
+        // 页面是隐藏的，创建过程不需要刷新屏幕。建造者函数中的退栈会被推迟，然后忽略
+        lv_disp_t * disp = lv_obj_get_disp(&tv->obj);
+        lv_fast_tileview_transition_effect_t dummy_effect;
+        tv->pending_pop_type = 0;
+        tv->is_creating = true;
+        tv->is_prefetching = true;
+        lv_disp_enable_invalidation(disp, false);
+        lv_obj_t * tile = _create_tile(tv, map_id, row, col, &dummy_effect);
+        lv_disp_enable_invalidation(disp, true);
+        tv->is_prefetching = false;
+        tv->is_creating = false;
+
+        if (tile && tv->pending_pop_type == 0 && lv_obj_has_flag(tile, LV_FAST_TILEVIEW_FLAG_KEEP_ALIVE)) {
+            _tile_cache_put(tv, tile, map_id, row, col);
+            return;
+        }
+
+        // 不存在的页面、侧滑返回、不缓存的页面，以后不再预取
+        if (tile) {
+            _delete_tile(tv, tile);
+        }
+        tv->pending_pop_type = 0;
+        _lv_fast_tileview_tile_stack_frame_t * p_key = &tv->no_prefetch[tv->no_prefetch_idx];
+        tv->no_prefetch_idx = (tv->no_prefetch_idx + 1) % (sizeof(tv->no_prefetch) / sizeof(tv->no_prefetch[0]));
+        p_key->map_id = map_id;
+        p_key->row = row;
+        p_key->col = col;
+        return;
+    }
+}
+#endif
+
+#if LV_FAST_TILEVIEW_STAT_CNT > 0
+static uint8_t _stat_get(int map_id, int row, int col)
+{
+    for (uint32_t i = 0; i < s_tile_stat_cnt; i++) {
+        const _tile_stat_t * p_stat = &s_tile_stats[i];
+        if (p_stat->map_id == map_id && p_stat->row == row && p_stat->col == col) {
+            return i;
+        }
+    }
+    if (s_tile_stat_cnt >= LV_FAST_TILEVIEW_STAT_CNT) return STAT_ID_NONE;
+
+    _tile_stat_t * p_stat = &s_tile_stats[s_tile_stat_cnt];
+    lv_memset_00(p_stat, sizeof(*p_stat));
+    p_stat->map_id = map_id;
+    p_stat->row = row;
+    p_stat->col = col;
+    return s_tile_stat_cnt++;
+}
+#endif
+
+// 离开的页面：缓存或者销毁
+static void _release_tile(lv_fast_tileview_t * tv, lv_obj_t * tile, int map_id, int row, int col)
+{
+#if LV_FAST_TILEVIEW_CACHE_CNT > 0
+    if (lv_obj_has_flag(tile, LV_FAST_TILEVIEW_FLAG_KEEP_ALIVE)) {
+        _tile_cache_put(tv, tile, map_id, row, col);
+        return;
+    }
+#else
+    LV_UNUSED(map_id);
+    LV_UNUSED(row);
+    LV_UNUSED(col);
+#endif
+    _delete_tile(tv, tile);
+}
+
+#if LV_FAST_TILEVIEW_CACHE_CNT > 0
+static _lv_fast_tileview_tile_cache_entry_t * _tile_cache_find(lv_fast_tileview_t * tv, int map_id, int row, int col)
+{
+    for (uint32_t i = 0; i < LV_FAST_TILEVIEW_CACHE_CNT; i++) {
+        _lv_fast_tileview_tile_cache_entry_t * p_entry = &tv->tile_cache[i];
+        if (p_entry->p_obj && p_entry->map_id == map_id && p_entry->row == row && p_entry->col == col) {
+            return p_entry;
+        }
+    }
+    return NULL;
+}
+
+static _lv_fast_tileview_tile_cache_entry_t * _tile_cache_free_slot(lv_fast_tileview_t * tv)
+{
+    for (uint32_t i = 0; i < LV_FAST_TILEVIEW_CACHE_CNT; i++) {
+        if (tv->tile_cache[i].p_obj == NULL) {
+            return &tv->tile_cache[i];
+        }
+    }
+    return NULL;
+}
+
+// 隐藏页面并放入缓存，缓存满了就挤掉最久未使用的页面
+static void _tile_cache_put(lv_fast_tileview_t * tv, lv_obj_t * tile, int map_id, int row, int col)
+{
+    _lv_fast_tileview_tile_cache_entry_t * p_slot = _tile_cache_free_slot(tv);
+    if (p_slot == NULL) {
+        _tile_cache_evict_oldest(tv);
+        p_slot = _tile_cache_free_slot(tv);
+    }
+
+    lv_obj_add_flag(tile, LV_OBJ_FLAG_HIDDEN);
+    p_slot->p_obj = tile;
+    p_slot->map_id = map_id;
+    p_slot->row = row;
+    p_slot->col = col;
+    p_slot->last_used = ++tv->tile_cache_stamp;
+
+    _tile_cache_trim(tv);
+}
+
+static bool _tile_cache_evict_oldest(lv_fast_tileview_t * tv)
+{
+    _lv_fast_tileview_tile_cache_entry_t * p_oldest = NULL;
+    for (uint32_t i = 0; i < LV_FAST_TILEVIEW_CACHE_CNT; i++) {
+        _lv_fast_tileview_tile_cache_entry_t * p_entry = &tv->tile_cache[i];
+        if (p_entry->p_obj == NULL) continue;
+        // 用差值比较，计数回绕也能正确找到最久未使用的页面
+        if (p_oldest == NULL || (int16_t)(p_entry->last_used - p_oldest->last_used) < 0) {
+            p_oldest = p_entry;
+        }
+    }
+    if (p_oldest == NULL) return false;
+
+    lv_obj_t * tile = p_oldest->p_obj;
+    p_oldest->p_obj = NULL;
+    _delete_tile(tv, tile);
+    return true;
+}
+
+// 可用内存低于低水位时，按LRU顺序销毁缓存的页面，直到回到高水位
+static void _tile_cache_trim(lv_fast_tileview_t * tv)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    if (mon.free_size >= TILE_CACHE_MEM_LOW) return;
+
+    while (mon.free_size < TILE_CACHE_MEM_HIGH && _tile_cache_evict_oldest(tv)) {
+        lv_mem_monitor(&mon);
+    }
+}
+#endif
+
 static void _move_tile_by(lv_obj_t * obj, lv_coord_t diff_x, lv_coord_t diff_y)
 {
     /*Do nothing if the position is not changed*/
@@ -388,6 +943,128 @@ static void _move_tile_by(lv_obj_t * obj, lv_coord_t diff_x, lv_coord_t diff_y)
     lv_obj_invalidate(obj);
 }
 
+// 快照期间页面是隐藏的，只移动页面本身的坐标并标记快照的脏区，子控件的偏移在页面重新显示时一次性补上
+static void _shift_tile(lv_fast_tileview_t * tv, lv_obj_t * tile, lv_coord_t diff_x, lv_coord_t diff_y)
+{
+#if LV_FAST_TILEVIEW_SNAPSHOT
+    if (tv->is_snapshot) {
+        for (uint32_t i = 0; i < 2; i++) {
+            _lv_fast_tileview_snapshot_t * p_snap = &tv->snapshots[i];
+            if (p_snap->p_tile != tile) continue;
+            if (diff_x == 0 && diff_y == 0) return;
+
+            lv_area_t area;
+            _snapshot_get_area(p_snap, &area);
+            lv_obj_invalidate_area(&tv->obj, &area);
+
+            tile->coords.x1 += diff_x;
+            tile->coords.y1 += diff_y;
+            tile->coords.x2 += diff_x;
+            tile->coords.y2 += diff_y;
+            p_snap->pending.x += diff_x;
+            p_snap->pending.y += diff_y;
+
+            lv_area_move(&area, diff_x, diff_y);
+            lv_obj_invalidate_area(&tv->obj, &area);
+            return;
+        }
+    }
+#endif
+    _move_tile_by(tile, diff_x, diff_y);
+}
+
+#if LV_FAST_TILEVIEW_SNAPSHOT
+static void _snapshot_get_area(const _lv_fast_tileview_snapshot_t * p_snap, lv_area_t * p_area)
+{
+    // 快照包含了页面的扩展绘制区域
+    lv_coord_t ext = (p_snap->img.header.w - lv_area_get_width(&p_snap->p_tile->coords)) / 2;
+    *p_area = p_snap->p_tile->coords;
+    lv_area_increase(p_area, ext, ext);
+}
+
+// 渲染2个页面的快照，然后隐藏页面。内存不够时保持原来的方式，每帧都绘制页面本身。
+static void _snapshot_begin(lv_fast_tileview_t * tv)
+{
+    lv_obj_t * tiles[2] = {tv->p_current_tile_obj, tv->p_next_tile_obj};
+    uint32_t pool_used = 0;
+
+    for (uint32_t i = 0; i < 2; i++) {
+        _lv_fast_tileview_snapshot_t * p_snap = &tv->snapshots[i];
+        uint32_t size = lv_snapshot_buf_size_needed(tiles[i], LV_IMG_CF_TRUE_COLOR);
+        void * buf = NULL;
+
+        // 优先放在LVGL堆中，但要给页面留够内存
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        if (mon.free_biggest_size >= size + SNAPSHOT_MEM_RESERVE) {
+            buf = lv_mem_alloc(size);
+        }
+        p_snap->in_sram = (buf != NULL);
+        if (buf == NULL && s_snapshot_pool && pool_used + size <= s_snapshot_pool_size) {
+            buf = s_snapshot_pool + pool_used;
+            pool_used += (size + 3) & ~3U;
+        }
+
+        if (buf == NULL || lv_snapshot_take_to_buf(tiles[i], LV_IMG_CF_TRUE_COLOR, &p_snap->img, buf, size) != LV_RES_OK) {
+            if (p_snap->in_sram) {
+                lv_mem_free(buf);
+                p_snap->in_sram = false;
+            }
+            // 释放已经拍好的快照
+            _snapshot_end(tv);
+            return;
+        }
+        p_snap->p_tile = tiles[i];
+        p_snap->pending.x = 0;
+        p_snap->pending.y = 0;
+        // 同一个描述符会指向不同的缓冲区，不能使用图片缓存中的旧数据
+        lv_img_cache_invalidate_src(&p_snap->img);
+    }
+
+    lv_obj_add_flag(tiles[0], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(tiles[1], LV_OBJ_FLAG_HIDDEN);
+    tv->is_snapshot = true;
+}
+
+// 恢复页面本身的显示，释放快照
+static void _snapshot_end(lv_fast_tileview_t * tv)
+{
+    for (uint32_t i = 0; i < 2; i++) {
+        _lv_fast_tileview_snapshot_t * p_snap = &tv->snapshots[i];
+        if (p_snap->p_tile == NULL) continue;
+
+        if (tv->is_snapshot) {
+            lv_obj_move_children_by(p_snap->p_tile, p_snap->pending.x, p_snap->pending.y, false);
+            lv_obj_clear_flag(p_snap->p_tile, LV_OBJ_FLAG_HIDDEN);
+        }
+        lv_img_cache_invalidate_src(&p_snap->img);
+        if (p_snap->in_sram) {
+            lv_mem_free((void *)p_snap->img.data);
+            p_snap->in_sram = false;
+        }
+        p_snap->p_tile = NULL;
+    }
+    tv->is_snapshot = false;
+}
+
+static void _snapshot_draw(lv_fast_tileview_t * tv, lv_draw_ctx_t * draw_ctx)
+{
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+
+    // 先画当前页面，新的页面在上面（覆盖效果）
+    for (uint32_t i = 0; i < 2; i++) {
+        _lv_fast_tileview_snapshot_t * p_snap = &tv->snapshots[i];
+        lv_area_t area;
+        lv_area_t common;
+        _snapshot_get_area(p_snap, &area);
+        if (_lv_area_intersect(&common, draw_ctx->clip_area, &area)) {
+            lv_draw_img(draw_ctx, &img_dsc, &area, &p_snap->img);
+        }
+    }
+}
+#endif
+
 static void _move_tile_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
 {
     /*Convert x and y to absolute coordinates*/
@@ -422,11 +1099,11 @@ static void _translate_tile(lv_fast_tileview_t * tv, lv_coord_t diff_x, lv_coord
         switch (tv->birthplace_of_next_tile) {
         case LV_FAST_TILEVIEW_POS_AT_LEFT:
         case LV_FAST_TILEVIEW_POS_AT_RIGHT:
-            _move_tile_by(tv->p_next_tile_obj, diff_x, 0);
+            _shift_tile(tv, tv->p_next_tile_obj, diff_x, 0);
             break;
         case LV_FAST_TILEVIEW_POS_AT_UP:
         case LV_FAST_TILEVIEW_POS_AT_DOWN:
-            _move_tile_by(tv->p_next_tile_obj, 0, diff_y);
+            _shift_tile(tv, tv->p_next_tile_obj, 0, diff_y);
             break;
         default:
             break;
@@ -440,13 +1117,13 @@ static void _translate_tile(lv_fast_tileview_t * tv, lv_coord_t diff_x, lv_coord
         switch (tv->birthplace_of_next_tile) {
         case LV_FAST_TILEVIEW_POS_AT_LEFT:
         case LV_FAST_TILEVIEW_POS_AT_RIGHT:
-            _move_tile_by(tv->p_current_tile_obj, diff_x, 0);
-            _move_tile_by(tv->p_next_tile_obj, diff_x, 0);
+            _shift_tile(tv, tv->p_current_tile_obj, diff_x, 0);
+            _shift_tile(tv, tv->p_next_tile_obj, diff_x, 0);
             break;
         case LV_FAST_TILEVIEW_POS_AT_UP:
         case LV_FAST_TILEVIEW_POS_AT_DOWN:
-            _move_tile_by(tv->p_current_tile_obj, 0, diff_y);
-            _move_tile_by(tv->p_next_tile_obj, 0, diff_y);
+            _shift_tile(tv, tv->p_current_tile_obj, 0, diff_y);
+            _shift_tile(tv, tv->p_next_tile_obj, 0, diff_y);
             break;
         default:
             break;
@@ -461,11 +1138,15 @@ static void _translate_tile(lv_fast_tileview_t * tv, lv_coord_t diff_x, lv_coord
 
 static void _lv_fast_tileview_complete_translation(lv_fast_tileview_t * tv)
 {
+#if LV_FAST_TILEVIEW_SNAPSHOT
+    // 动画结束，换回页面本身
+    _snapshot_end(tv);
+#endif
     if (tv->is_switched) {
         // 发送事件告诉新的页面，可以正常显示了
-        lv_event_send(tv->p_next_tile_obj, LV_EVENT_TILE_STARTED, NULL);
-        // 销毁当前页，并发送事件
-        lv_obj_del(tv->p_current_tile_obj);
+        _start_tile(tv, tv->p_next_tile_obj);
+        // 销毁或缓存当前页，并发送事件
+        _release_tile(tv, tv->p_current_tile_obj, tv->current_map_id, tv->current_row, tv->current_col);
         // 引用新的页面
         tv->p_current_tile_obj = tv->p_next_tile_obj;
         // 确保坐标正确
@@ -477,9 +1158,9 @@ static void _lv_fast_tileview_complete_translation(lv_fast_tileview_t * tv)
     }
     else {
         // 发送事件告诉当前页面，可以恢复显示了
-        lv_event_send(tv->p_current_tile_obj, LV_EVENT_TILE_STARTED, NULL);
-        // 销毁新的页面，并发送事件
-        lv_obj_del(tv->p_next_tile_obj);
+        _start_tile(tv, tv->p_current_tile_obj);
+        // 销毁或缓存新的页面，并发送事件
+        _release_tile(tv, tv->p_next_tile_obj, tv->next_map_id, tv->next_row, tv->next_col);
         // 恢复当前页面的坐标
         // _move_tile_to(tv->p_current_tile_obj, 0, 0);
     }
@@ -487,6 +1168,17 @@ static void _lv_fast_tileview_complete_translation(lv_fast_tileview_t * tv)
 
     // 最后整体刷新一次
     lv_obj_invalidate(&tv->obj);
+
+    // 新的页面空闲一段时间后，再预取它的相邻页面
+#if LV_FAST_TILEVIEW_PREFETCH
+    if (tv->is_switched) {
+        tv->prefetch_done = 0;
+    }
+#endif
+    if (tv->p_worker) {
+        lv_timer_reset(tv->p_worker);
+    }
+    _worker_update(tv);
 }
 
 static void _scroll_x_anim(void * obj, int32_t v)
@@ -621,6 +1313,25 @@ static void fast_tileview_evt_cb(const lv_obj_class_t *p_class, lv_event_t * e)
     #endif
     lv_fast_tileview_class.base_class->event_cb(&lv_fast_tileview_class, e);
 
+#if LV_FAST_TILEVIEW_SNAPSHOT
+    if (code == LV_EVENT_DRAW_MAIN) {
+        if (tv->is_snapshot) {
+            _snapshot_draw(tv, lv_event_get_draw_ctx(e));
+        }
+        return;
+    }
+#endif
+    if (code == LV_EVENT_DELETE) {
+#if LV_FAST_TILEVIEW_SNAPSHOT
+        _snapshot_end(tv);
+#endif
+        if (tv->p_worker) {
+            lv_timer_del(tv->p_worker);
+            tv->p_worker = NULL;
+        }
+        return;
+    }
+
     if (code == LV_EVENT_SCROLL_BEGIN || code == LV_EVENT_SCROLL || code == LV_EVENT_SCROLL_END) {
         if (tv->is_animating) {
             tv->is_ignore_scroll = true;
@@ -672,7 +1383,7 @@ static void fast_tileview_evt_cb(const lv_obj_class_t *p_class, lv_event_t * e)
                     // 尝试创建新的页面。创建的时候就相当给新页面发送了创建事件。
                     tv->pending_pop_type = 0;
                     tv->is_creating = true;
-                    p_next_tile_obj = _try_create_tile(tv, tv->current_map_id, next_row, next_col, &tv->effect);
+                    p_next_tile_obj = _obtain_tile(tv, tv->current_map_id, next_row, next_col, &tv->effect);
                     tv->is_creating = false;
                     if (p_next_tile_obj) {
                         tv->is_scrolling = true;
@@ -702,7 +1413,13 @@ static void fast_tileview_evt_cb(const lv_obj_class_t *p_class, lv_event_t * e)
                             break;
                         }
                         // 发送生命周期时间给旧页面，让旧页面暂停
-                        lv_event_send(tv->p_current_tile_obj, LV_EVENT_TILE_STOPPED, NULL);
+                        _stop_tile(tv, tv->p_current_tile_obj);
+#if LV_FAST_TILEVIEW_SNAPSHOT
+                        // 滑动期间只绘制快照
+                        if (tv->effect != LV_FAST_TILEVIEW_EFFECT_NONE) {
+                            _snapshot_begin(tv);
+                        }
+#endif
                     }
                     else {
                         // 如果没有新的页面，就分情况跳过这次滚动。
@@ -20,6 +20,39 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#ifndef LV_FAST_TILEVIEW_CACHE_CNT
+#define LV_FAST_TILEVIEW_CACHE_CNT      4       // tiles kept alive after they are left, 0 disables the tile cache.
+#endif
+
+#define LV_FAST_TILEVIEW_FLAG_KEEP_ALIVE    LV_OBJ_FLAG_USER_1  // set by lv_fast_tileview_set_keep_alive()
+
+#ifndef LV_FAST_TILEVIEW_SNAPSHOT
+#define LV_FAST_TILEVIEW_SNAPSHOT       LV_USE_SNAPSHOT  // swipe with snapshots of the 2 tiles instead of redrawing their objects every frame.
+#endif
+
+#ifndef LV_FAST_TILEVIEW_BUILD_JOB_CNT
+#define LV_FAST_TILEVIEW_BUILD_JOB_CNT  3       // tiles built incrementally at the same time, see lv_fast_tileview_build_later().
+#endif
+
+#ifndef LV_FAST_TILEVIEW_BUILD_SLICE_US
+#define LV_FAST_TILEVIEW_BUILD_SLICE_US 3000    // build steps run per lv_task_handler() call until this time is used up.
+#endif
+
+#ifndef LV_FAST_TILEVIEW_PREFETCH
+#define LV_FAST_TILEVIEW_PREFETCH       (LV_FAST_TILEVIEW_CACHE_CNT > 0)  // build the neighbours of an idle tile into the tile cache.
+#endif
+
+#ifndef LV_FAST_TILEVIEW_PREFETCH_DELAY
+#define LV_FAST_TILEVIEW_PREFETCH_DELAY 300     // ms a tile has to be idle before its neighbours are built.
+#endif
+
+#ifndef LV_FAST_TILEVIEW_STAT_CNT
+#define LV_FAST_TILEVIEW_STAT_CNT       24      // tiles with creation time statistics, 0 disables them.
+#endif
+
+#ifndef LV_FAST_TILEVIEW_CLOCK_US
+#define LV_FAST_TILEVIEW_CLOCK_US()     (lv_tick_get() * 1000U)
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -43,6 +76,14 @@ typedef uint8_t lv_fast_tileview_pos_t;
 
 typedef lv_obj_t * (*lv_fast_tileview_create_tile_cb)(lv_obj_t * parent, int new_map_id, int new_row, int new_col, lv_fast_tileview_transition_effect_t * p_effect);
 
+/**
+ * One step of an incremental tile, see lv_fast_tileview_build_later().
+ * @param tile  the tile returned by p_tile_creator().
+ * @param step  0 for the first call, then counts up.
+ * @return true when the tile is complete, false to be called again with the next step.
+ */
+typedef bool (*lv_fast_tileview_build_step_cb)(lv_obj_t * tile, uint32_t step);
+
 typedef struct {
     int16_t map_id;
     int16_t row;
@@ -52,6 +93,30 @@ typedef struct {
 
 } _lv_fast_tileview_tile_stack_frame_t;
 
+typedef struct {
+    lv_obj_t * p_obj; // hidden tile, NULL if the slot is free.
+    int16_t map_id;
+    int16_t row;
+    int16_t col;
+    uint16_t last_used; // the least recently used tile is evicted first.
+} _lv_fast_tileview_tile_cache_entry_t;
+
+typedef struct {
+    lv_obj_t * p_tile; // tile still being built, NULL if the slot is free.
+    lv_fast_tileview_build_step_cb step_cb;
+    uint16_t step;
+    uint32_t build_us; // time spent in step_cb() so far.
+    uint8_t stat_id; // creation statistics of the tile, 0xFF if none.
+    bool is_ready_pending; // LV_EVENT_READY is sent when the build is complete.
+} _lv_fast_tileview_build_job_t;
+
+typedef struct {
+    lv_obj_t * p_tile; // hidden while the snapshot is drawn in its place, NULL if unused.
+    lv_img_dsc_t img;
+    lv_point_t pending; // offset of the children, applied when the tile is shown again.
+    bool in_sram; // buffer from lv_mem_alloc(), else from the snapshot pool.
+} _lv_fast_tileview_snapshot_t;
+
 typedef struct {
     lv_obj_t obj;
     int16_t current_map_id; // determine which table will be used.
@@ -70,6 +135,22 @@ typedef struct {
         uint8_t list_capacity;
         uint8_t list_size;
     } tile_stack;
+#if LV_FAST_TILEVIEW_CACHE_CNT > 0
+    _lv_fast_tileview_tile_cache_entry_t tile_cache[LV_FAST_TILEVIEW_CACHE_CNT];
+    uint16_t tile_cache_stamp;
+#endif
+#if LV_FAST_TILEVIEW_SNAPSHOT
+    _lv_fast_tileview_snapshot_t snapshots[2]; // [0] current tile, [1] next tile.
+    bool is_snapshot; // the swipe is drawn from snapshots.
+#endif
+    _lv_fast_tileview_build_job_t build_jobs[LV_FAST_TILEVIEW_BUILD_JOB_CNT];
+    lv_timer_t * p_worker; // runs the build steps and the prefetch, paused when there is nothing to do.
+#if LV_FAST_TILEVIEW_PREFETCH
+    uint8_t prefetch_done; // bit per neighbour of the current tile: left, right, up, down.
+    bool is_prefetching; // p_tile_creator() builds a tile for the tile cache.
+    uint8_t no_prefetch_idx;
+    _lv_fast_tileview_tile_stack_frame_t no_prefetch[4]; // tiles that are not kept alive, building them ahead is wasted.
+#endif
     bool is_switched;
     bool is_animating;
     bool is_ignore_scroll;
@@ -118,6 +199,61 @@ void lv_fast_tileview_pop(lv_obj_t * from_obj);
  */
 void lv_fast_tileview_pop_all(lv_obj_t * from_obj);
 
+/**
+ * @brief Keep a tile alive after it is left. It is hidden and cached instead of deleted, and when it is shown
+ *        again it gets LV_EVENT_REFRESH (update the data) and LV_EVENT_READY instead of running the tile creator.
+ *        Cached tiles are deleted, least recently used first, when the free LVGL heap runs low.
+ *        Call it from p_tile_creator() on the tile to return.
+ *
+ * @param tile          a tile returned by p_tile_creator().
+ * @param keep_alive    true to cache the tile.
+ */
+void lv_fast_tileview_set_keep_alive(lv_obj_t * tile, bool keep_alive);
+
+/**
+ * @brief Delete every cached tile, e.g. when p_tile_creator() would build different content for them now.
+ *
+ * @param from_obj automatically search lv_fast_tileview_t from "from_obj".
+ */
+void lv_fast_tileview_cache_clear(lv_obj_t * from_obj);
+
+/**
+ * @brief Build the rest of a tile later, in slices of LV_FAST_TILEVIEW_BUILD_SLICE_US spread over several
+ *        lv_task_handler() calls. Call it from p_tile_creator() on the tile to return, after creating a cheap
+ *        placeholder content. The tile gets LV_EVENT_READY only when step_cb() returned true.
+ *        If no build slot is free, step_cb() runs to the end right away.
+ *
+ * @param tile      a tile returned by p_tile_creator().
+ * @param step_cb   creates the next part of the tile.
+ */
+void lv_fast_tileview_build_later(lv_obj_t * tile, lv_fast_tileview_build_step_cb step_cb);
+
+/**
+ * @brief Tell p_tile_creator() that the tile is built ahead, for the tile cache while the current tile is idle.
+ *        Return NULL from p_tile_creator() to never build that tile ahead.
+ *
+ * @param from_obj automatically search lv_fast_tileview_t from "from_obj".
+ */
+bool lv_fast_tileview_is_prefetching(lv_obj_t * from_obj);
+
+/**
+ * @brief Print the creation time of every tile: p_tile_creator() (blocking) and the build steps (sliced).
+ *        Tiles whose blocking part is longer than LV_FAST_TILEVIEW_BUILD_SLICE_US are marked.
+ *
+ * @param p_printf print function, NULL for printf().
+ */
+void lv_fast_tileview_dump_stats(int (*p_printf)(const char *, ...));
+
+/**
+ * @brief Give the tileviews a memory region for the swipe snapshots (RGB565, 2 tiles, e.g. an XIP mapped PSRAM).
+ *        A snapshot is put in the LVGL heap when it fits, else in this region. Without room for both tiles
+ *        the swipe redraws the objects as before.
+ *
+ * @param buf   start of the region, NULL to use the LVGL heap only.
+ * @param size  size of the region in bytes.
+ */
+void lv_fast_tileview_set_snapshot_pool(void * buf, uint32_t size);
+
 /*=====================
  * Other functions
  *====================*/
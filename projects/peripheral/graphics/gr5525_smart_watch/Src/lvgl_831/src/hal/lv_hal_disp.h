@@ -141,6 +141,21 @@ typedef struct _lv_disp_drv_t {
     void (*set_clip_area_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * clip_area);
 #endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
 
+#if LV_GDX_PATCH_JOIN_AREA_CB
+    /** OPTIONAL: merge the invalid areas before refreshing. Set `joined[i]` to 1 for every area which should not be
+     * refreshed, the remaining ones are refreshed in array order */
+    void (*join_area_cb)(struct _lv_disp_drv_t * disp_drv, lv_area_t * areas, uint8_t * joined, uint16_t area_cnt);
+#endif // LV_GDX_PATCH_JOIN_AREA_CB
+
+#if LV_GDX_PATCH_ROUND_DISP
+    /** OPTIONAL: first visible column of every row of a round panel, the visible part is symmetric around the
+     * vertical center line. Objects drawn only outside of it are skipped. NULL if every pixel is visible */
+    const lv_coord_t * round_inset;
+
+    /** OPTIONAL: called before every band is rendered, the band may only shrink (e.g. to the visible columns) */
+    void (*band_area_cb)(struct _lv_disp_drv_t * disp_drv, lv_area_t * band);
+#endif // LV_GDX_PATCH_ROUND_DISP
+
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_CHROMA_KEY` by default. (lv_conf.h)*/
     lv_color_t color_chroma_key;
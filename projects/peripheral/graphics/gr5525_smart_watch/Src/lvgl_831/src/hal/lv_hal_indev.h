@@ -82,6 +82,11 @@ typedef struct {
 
     lv_indev_state_t state; /**< LV_INDEV_STATE_REL or LV_INDEV_STATE_PR*/
     bool continue_reading;  /**< If set to true, the read callback is invoked again*/
+#if LV_GDX_PATCH_INDEV_THROW_VECT
+    /** For LV_INDEV_TYPE_POINTER the velocity of the finger in px per read period, used if `has_throw_vect`*/
+    lv_point_t throw_vect;
+    bool has_throw_vect;
+#endif // LV_GDX_PATCH_INDEV_THROW_VECT
 } lv_indev_data_t;
 
 /** Initialized by the user and registered by 'lv_indev_add()'*/
@@ -147,6 +152,9 @@ typedef struct _lv_indev_proc_t {
             lv_point_t scroll_sum; /*Count the dragged pixels to check LV_INDEV_DEF_SCROLL_LIMIT*/
             lv_point_t scroll_throw_vect;
             lv_point_t scroll_throw_vect_ori;
+#if LV_GDX_PATCH_INDEV_THROW_VECT
+            lv_point_t drv_throw_vect; /*Velocity reported by the driver, see lv_indev_data_t.throw_vect*/
+#endif
             struct _lv_obj_t * act_obj;      /*The object being pressed*/
             struct _lv_obj_t * last_obj;     /*The last object which was pressed*/
             struct _lv_obj_t * scroll_obj;   /*The object being scrolled*/
@@ -158,6 +166,9 @@ typedef struct _lv_indev_proc_t {
             lv_dir_t scroll_dir : 4;
             lv_dir_t gesture_dir : 4;
             uint8_t gesture_sent : 1;
+#if LV_GDX_PATCH_INDEV_THROW_VECT
+            uint8_t has_drv_throw_vect : 1;
+#endif
         } pointer;
         struct {
             /*Keypad data*/
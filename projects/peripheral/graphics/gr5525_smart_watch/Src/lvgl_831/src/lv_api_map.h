@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "../lvgl.h"
+#include "render_profiler.h"
 
 /*********************
  *      DEFINES
@@ -34,11 +35,21 @@ extern "C" {
 static inline LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_task_handler(void)
 {
 #if LV_GDX_PATCH_POST_RENDER
+    render_profiler_frame_begin();
+    render_profiler_zone_begin(rp_timers);
     uint32_t sleep_time = lv_timer_handler();
+    render_profiler_zone_end(RP_ZONE_TIMERS, NULL, rp_timers);
     uint32_t render_start_time = lv_tick_get();
     extern void _lv_disp_refr_timer(lv_timer_t * tmr);
+    render_profiler_zone_begin(rp_render);
     _lv_disp_refr_timer(NULL);
+    render_profiler_zone_end(RP_ZONE_RENDER, NULL, rp_render);
+    render_profiler_frame_end();
     uint32_t render_time = lv_tick_elaps(render_start_time);
+    if (sleep_time == LV_NO_TIMER_READY)
+    {
+        return LV_NO_TIMER_READY;
+    }
     if (sleep_time > render_time)
     {
         return sleep_time - render_time;
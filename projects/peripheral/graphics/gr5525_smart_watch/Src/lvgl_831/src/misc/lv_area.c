@@ -22,9 +22,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-#if LV_ENABLE_GDX_PATCH == 0u
 static bool lv_point_within_circle(const lv_area_t * area, const lv_point_t * p);
-#endif
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -205,10 +203,6 @@ bool _lv_area_is_point_on(const lv_area_t * a_p, const lv_point_t * p_p, lv_coor
         return true;
     }
 
-#if LV_ENABLE_GDX_PATCH > 0u
-    // TODO: Try to add some policy to handle circle or big-corner rect
-    return true;
-#else
     lv_coord_t w = lv_area_get_width(a_p) / 2;
     lv_coord_t h = lv_area_get_height(a_p) / 2;
     lv_coord_t max_radius = LV_MIN(w, h);
@@ -253,7 +247,6 @@ bool _lv_area_is_point_on(const lv_area_t * a_p, const lv_point_t * p_p, lv_coor
     }
     /*Not within corners*/
     return true;
-#endif
 }
 
 /**
@@ -547,7 +540,6 @@ void lv_point_transform(lv_point_t * p, int32_t angle, int32_t zoom, const lv_po
 /**********************
  *   STATIC FUNCTIONS
  **********************/
-#if LV_ENABLE_GDX_PATCH == 0u
 static bool lv_point_within_circle(const lv_area_t * area, const lv_point_t * p)
 {
     lv_coord_t r = (area->x2 - area->x1) / 2;
@@ -568,4 +560,3 @@ static bool lv_point_within_circle(const lv_area_t * area, const lv_point_t * p)
     else
         return false;
 }
-#endif
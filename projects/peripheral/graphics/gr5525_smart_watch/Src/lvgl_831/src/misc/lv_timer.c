@@ -18,6 +18,11 @@
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
 
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+#define TIMER_HEAP_NONE     0xFFFF
+#define TIMER_HEAP_INIT_CNT 16
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -25,8 +30,21 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_GDX_PATCH_TIMER_PRIO > 0u
+extern bool lv_timer_is_filtered(lv_timer_t * timer);
+#endif
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+static bool timer_heap_reserve(uint32_t cnt);
+static void timer_heap_insert(lv_timer_t * timer);
+static void timer_heap_remove(lv_timer_t * timer);
+static void timer_heap_update(lv_timer_t * timer);
+static void timer_queue(lv_timer_t * timer);
+static void timer_unqueue(lv_timer_t * timer);
+static void timer_hold(lv_timer_t * timer);
+static void timer_release_held(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -35,6 +53,15 @@ static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
 static bool timer_deleted;
 static bool timer_created;
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+/*Min-heap of the timers to run, ordered by `last_run + period`. Paused timers are not in it.*/
+static lv_timer_t ** timer_heap;
+static uint16_t timer_heap_cnt;
+static uint16_t timer_heap_cap;
+static uint16_t timer_cnt;
+/*Due timers kept out of the heap: filtered ones and the ones already run by this lv_timer_handler()*/
+static lv_timer_t * timer_held;
+#endif
 
 /**********************
  *      MACROS
@@ -55,6 +82,13 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    timer_heap = NULL;
+    timer_heap_cnt = 0;
+    timer_heap_cap = 0;
+    timer_cnt = 0;
+    timer_held = NULL;
+#endif
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -95,6 +129,36 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    /*Run the due timers only, earliest deadline first*/
+    timer_release_held();
+    while(timer_heap_cnt > 0) {
+        lv_timer_t * timer = timer_heap[0];
+        if(lv_timer_time_remaining(timer) != 0) break;
+
+        timer_heap_remove(timer);
+#if LV_GDX_PATCH_TIMER_PRIO > 0u
+        if(lv_timer_is_filtered(timer)) {
+            timer_hold(timer);
+            continue;
+        }
+#endif
+        LV_GC_ROOT(_lv_timer_act) = timer;
+        lv_timer_exec(timer);
+        if(LV_GC_ROOT(_lv_timer_act) == NULL) continue; /*Deleted*/
+        LV_GC_ROOT(_lv_timer_act) = NULL;
+        if(timer->paused) continue;
+
+        /*Due again right away (0 period or made ready by its callback): run it in the next call only*/
+        if(lv_timer_time_remaining(timer) == 0) timer_hold(timer);
+        else timer_queue(timer);
+    }
+    timer_release_held();
+
+    /*Filtered timers stay held, don't wake up for them*/
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    if(timer_heap_cnt > 0) time_till_next = lv_timer_time_remaining(timer_heap[0]);
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     do {
@@ -121,7 +185,12 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
     uint32_t time_till_next = LV_NO_TIMER_READY;
     next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
     while(next) {
+#if LV_GDX_PATCH_TIMER_PRIO > 0u
+        /*A filtered timer can't run now, don't wake up for it*/
+        if(!next->paused && !lv_timer_is_filtered(next)) {
+#else
         if(!next->paused) {
+#endif
             uint32_t delay = lv_timer_time_remaining(next);
             if(delay < time_till_next)
                 time_till_next = delay;
@@ -129,6 +198,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
         next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
     }
+#endif
 
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
@@ -180,6 +250,19 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->user_data = user_data;
 #if LV_GDX_PATCH_TIMER_PRIO > 0u
     new_timer->sys_prio = 0;
+#endif
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    new_timer->is_held = 0;
+    new_timer->heap_idx = TIMER_HEAP_NONE;
+    new_timer->held_next = NULL;
+    /*Room for every timer in the heap, so resuming or re-queuing a timer can't fail later*/
+    if(!timer_heap_reserve(timer_cnt + 1)) {
+        _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), new_timer);
+        lv_mem_free(new_timer);
+        return NULL;
+    }
+    timer_cnt++;
+    timer_heap_insert(new_timer);
 #endif
     timer_created = true;
 
@@ -204,6 +287,11 @@ void lv_timer_del(lv_timer_t * timer)
 {
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
     timer_deleted = true;
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    timer_unqueue(timer);
+    timer_cnt--;
+    if(LV_GC_ROOT(_lv_timer_act) == timer) LV_GC_ROOT(_lv_timer_act) = NULL;
+#endif
 
     lv_mem_free(timer);
 }
@@ -215,11 +303,17 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    timer_unqueue(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    timer_queue(timer);
+#endif
 }
 
 /**
@@ -230,6 +324,9 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    timer_heap_update(timer);
+#endif
 }
 
 /**
@@ -239,6 +336,9 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    timer_heap_update(timer);
+#endif
 }
 
 /**
@@ -259,6 +359,9 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    timer_heap_update(timer);
+#endif
 }
 
 /**
@@ -306,13 +409,14 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
  */
 static bool lv_timer_exec(lv_timer_t * timer)
 {
+#if LV_GDX_PATCH_TIMER_HEAP == 0u /*Else the queue has only the runnable timers*/
 #if LV_GDX_PATCH_TIMER_PRIO > 0u
-    extern bool lv_timer_is_filtered(lv_timer_t * timer);
     if(true == lv_timer_is_filtered(timer)) {
         return false;
     }
 #endif
     if(timer->paused) return false;
+#endif
 
     bool exec = false;
     if(lv_timer_time_remaining(timer) == 0) {
@@ -329,7 +433,11 @@ static bool lv_timer_exec(lv_timer_t * timer)
         exec = true;
     }
 
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    if(LV_GC_ROOT(_lv_timer_act) == timer) { /*The timer might be deleted by itself as well*/
+#else
     if(timer_deleted == false) { /*The timer might be deleted by itself as well*/
+#endif
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             TIMER_TRACE("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
             lv_timer_del(timer);
@@ -352,3 +460,146 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+/**
+ * Tell if a timer has to run before an other one. Ticks wrap around, so compare the difference of the deadlines.
+ */
+static inline bool timer_is_earlier(const lv_timer_t * a, const lv_timer_t * b)
+{
+    return (int32_t)((a->last_run + a->period) - (b->last_run + b->period)) < 0;
+}
+
+static inline void timer_heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    timer_heap[idx] = timer;
+    timer->heap_idx = (uint16_t)idx;
+}
+
+static void timer_heap_up(uint32_t idx)
+{
+    lv_timer_t * timer = timer_heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!timer_is_earlier(timer, timer_heap[parent])) break;
+        timer_heap_set(idx, timer_heap[parent]);
+        idx = parent;
+    }
+    timer_heap_set(idx, timer);
+}
+
+static void timer_heap_down(uint32_t idx)
+{
+    lv_timer_t * timer = timer_heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= timer_heap_cnt) break;
+        if(child + 1 < timer_heap_cnt && timer_is_earlier(timer_heap[child + 1], timer_heap[child])) child++;
+        if(!timer_is_earlier(timer_heap[child], timer)) break;
+        timer_heap_set(idx, timer_heap[child]);
+        idx = child;
+    }
+    timer_heap_set(idx, timer);
+}
+
+/**
+ * Make the heap big enough for `cnt` timers
+ * @return false if out of memory
+ */
+static bool timer_heap_reserve(uint32_t cnt)
+{
+    if(cnt <= timer_heap_cap) return true;
+    if(cnt >= TIMER_HEAP_NONE) return false;
+
+    uint32_t cap = timer_heap_cap ? timer_heap_cap * 2 : TIMER_HEAP_INIT_CNT;
+    if(cap >= TIMER_HEAP_NONE) cap = TIMER_HEAP_NONE - 1;
+    lv_timer_t ** heap = lv_mem_realloc(timer_heap, cap * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(heap);
+    if(heap == NULL) return false;
+
+    timer_heap = heap;
+    timer_heap_cap = (uint16_t)cap;
+    return true;
+}
+
+static void timer_heap_insert(lv_timer_t * timer)
+{
+    timer_heap_set(timer_heap_cnt, timer);
+    timer_heap_cnt++;
+    timer_heap_up(timer->heap_idx);
+}
+
+static void timer_heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    timer->heap_idx = TIMER_HEAP_NONE;
+    timer_heap_cnt--;
+    if(idx == timer_heap_cnt) return;
+
+    /*Move the last timer to the hole and restore the order from there*/
+    lv_timer_t * last = timer_heap[timer_heap_cnt];
+    timer_heap_set(idx, last);
+    timer_heap_up(idx);
+    timer_heap_down(last->heap_idx);
+}
+
+/**
+ * The deadline of a timer changed, move it to its new place
+ */
+static void timer_heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_idx == TIMER_HEAP_NONE) return;
+    timer_heap_up(timer->heap_idx);
+    timer_heap_down(timer->heap_idx);
+}
+
+/**
+ * Put a timer in the heap, unless it's paused, running or already waiting
+ */
+static void timer_queue(lv_timer_t * timer)
+{
+    if(timer->paused || timer->is_held || timer->heap_idx != TIMER_HEAP_NONE) return;
+    if(timer == LV_GC_ROOT(_lv_timer_act)) return; /*lv_timer_handler() puts it back after its callback*/
+    timer_heap_insert(timer);
+}
+
+static void timer_unqueue(lv_timer_t * timer)
+{
+    if(timer->heap_idx != TIMER_HEAP_NONE) {
+        timer_heap_remove(timer);
+    }
+    else if(timer->is_held) {
+        lv_timer_t ** p_next = &timer_held;
+        while(*p_next != timer) p_next = &(*p_next)->held_next;
+        *p_next = timer->held_next;
+        timer->is_held = 0;
+    }
+}
+
+static void timer_hold(lv_timer_t * timer)
+{
+    timer->is_held = 1;
+    timer->held_next = timer_held;
+    timer_held = timer;
+}
+
+/**
+ * Put the held timers back in the heap, except the ones still filtered
+ */
+static void timer_release_held(void)
+{
+    lv_timer_t ** p_next = &timer_held;
+    while(*p_next) {
+        lv_timer_t * timer = *p_next;
+#if LV_GDX_PATCH_TIMER_PRIO > 0u
+        if(lv_timer_is_filtered(timer)) {
+            p_next = &timer->held_next;
+            continue;
+        }
+#endif
+        *p_next = timer->held_next;
+        timer->is_held = 0;
+        timer_heap_insert(timer);
+    }
+}
+#endif /*LV_GDX_PATCH_TIMER_HEAP*/
@@ -51,6 +51,11 @@ typedef struct _lv_timer_t {
 #if LV_GDX_PATCH_TIMER_PRIO > 0u
     uint32_t sys_prio : 1;  /**< system prio, should be run always when true */
 #endif
+#if LV_GDX_PATCH_TIMER_HEAP > 0u
+    uint32_t is_held : 1;   /**< due, but kept out of the queue until the end of lv_timer_handler() */
+    uint16_t heap_idx;      /**< position in the deadline queue, 0xFFFF if not queued */
+    struct _lv_timer_t * held_next;
+#endif
 } lv_timer_t;
 
 /**********************
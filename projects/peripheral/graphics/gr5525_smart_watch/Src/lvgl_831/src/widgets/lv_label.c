@@ -791,6 +791,23 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
 }
 
 
+#if LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
+/**
+ * Background uniformity hint of the palette glyph path: true if the label paints a single
+ * opaque color under every letter, so the glyphs can be written without reading the buffer.
+ */
+static bool label_bg_is_uniform(lv_obj_t * obj)
+{
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN) != NULL) return false;
+    /*Letters near a rounded corner may stand outside the background*/
+    if(lv_obj_get_style_radius(obj, LV_PART_MAIN) != 0) return false;
+    return true;
+}
+#endif
+
 static void draw_main(lv_event_t * e)
 {
     lv_obj_t * obj = lv_event_get_target(e);
@@ -822,6 +839,7 @@ static void draw_main(lv_event_t * e)
 
 #if LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
     label_draw_dsc.background_color = lv_obj_get_style_bg_color(obj, LV_PART_MAIN);
+    label_draw_dsc.bg_opaque = label_bg_is_uniform(obj);
 #endif
 
 #if LV_GCX_PATCH_DISABLE_LABEL_SEL_FUNC
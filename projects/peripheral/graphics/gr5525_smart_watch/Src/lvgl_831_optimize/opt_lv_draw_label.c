@@ -13,6 +13,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
+#include "render_profiler.h"
 
 /*********************
  *      DEFINES
@@ -142,21 +143,36 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label_opt(lv_draw_ctx_t *draw_ctx, const lv_d
     if(!clip_ok) return;
 
 #if LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
-    uint16_t *p_color_palette = dsc_mod.color_palette;
-    uint16_t background_red = dsc->background_color.ch.red;
-    uint16_t background_blue = dsc->background_color.ch.blue;
-    uint16_t background_green = dsc->background_color.ch.green;
-    uint16_t foreground_red = dsc_mod.color.ch.red;
-    uint16_t foreground_blue = dsc_mod.color.ch.blue;
-    uint16_t foreground_green = dsc_mod.color.ch.green;
-
-    for (int i = 0; i < 16; i++)
+    /* The palette bakes one text color over one background color: recolored or selected
+     * letters and translucent text fall back to the blending glyph path */
+    if (dsc_mod.opa < LV_OPA_MAX || (dsc->flag & LV_TEXT_FLAG_RECOLOR))
     {
-        lv_color16_t src_color;
-        src_color.ch.red = (background_red * (15 - i) + foreground_red * i) / 15;
-        src_color.ch.blue = (background_blue * (15 - i) + foreground_blue * i) / 15;
-        src_color.ch.green = (background_green * (15 - i) + foreground_green * i) / 15;
-        p_color_palette[i] = src_color.full;
+        dsc_mod.bg_opaque = 0;
+    }
+#if LV_GCX_PATCH_DISABLE_LABEL_SEL_FUNC
+    if (dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL && dsc->sel_end != LV_DRAW_LABEL_NO_TXT_SEL)
+    {
+        dsc_mod.bg_opaque = 0;
+    }
+#endif // LV_GCX_PATCH_DISABLE_LABEL_SEL_FUNC
+    if (dsc_mod.bg_opaque)
+    {
+        uint16_t *p_color_palette = dsc_mod.color_palette;
+        uint16_t background_red = dsc->background_color.ch.red;
+        uint16_t background_blue = dsc->background_color.ch.blue;
+        uint16_t background_green = dsc->background_color.ch.green;
+        uint16_t foreground_red = dsc_mod.color.ch.red;
+        uint16_t foreground_blue = dsc_mod.color.ch.blue;
+        uint16_t foreground_green = dsc_mod.color.ch.green;
+
+        for (int i = 0; i < 16; i++)
+        {
+            lv_color16_t src_color;
+            src_color.ch.red = (background_red * (15 - i) + foreground_red * i) / 15;
+            src_color.ch.blue = (background_blue * (15 - i) + foreground_blue * i) / 15;
+            src_color.ch.green = (background_green * (15 - i) + foreground_green * i) / 15;
+            p_color_palette[i] = src_color.full;
+        }
     }
 #endif
 
@@ -513,7 +529,9 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label_opt(lv_draw_ctx_t *draw_ctx, const lv_d
 void lv_draw_letter_opt(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,  const lv_point_t * pos_p,
                     uint32_t letter)
 {
+    render_profiler_zone_begin(rp_glyph);
     draw_ctx->draw_letter(draw_ctx, dsc, pos_p, letter);
+    render_profiler_count_end(RP_ZONE_GLYPH, rp_glyph);
 }
 
 
@@ -18,6 +18,16 @@
 /*********************
  *      DEFINES
  *********************/
+/* R and B of an RGB565 pixel in the two half words of a word, G alone: a channel times 255 plus
+ * the rounding offset fits a half word, so R and B are blended with one multiply */
+#define RGB565_RB(c)            ((((uint32_t)(c) & 0xF800u) << 5) | ((uint32_t)(c) & 0x001Fu))
+#define RGB565_G(c)             (((uint32_t)(c) >> 5) & 0x3Fu)
+/* LV_UDIV255() of both half words at once, exact below 0xFFFF */
+#define UDIV255_X2(x)           (((x) + (((x) >> 8) & 0x00FF00FFu) + 0x00010001u) >> 8)
+
+#if LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE && (LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP || LV_COLOR_MIX_ROUND_OFS == 0)
+#error "draw_letter_blend_opt() follows the rounded RGB565 lv_color_mix()"
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -34,6 +44,7 @@
 /**********************
  *  GLOBAL VARIABLES
  **********************/
+extern const uint8_t _lv_bpp4_opa_table[16];
 
 /**********************
  *      MACROS
@@ -47,6 +58,125 @@
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
+/* lv_color_mix() with the foreground side premultiplied, LV_COLOR_MIX_ROUND_OFS included */
+static inline void _blend_px(uint16_t * p_px, uint32_t fg_rb_pre, uint32_t fg_g_pre, uint32_t bg_mix)
+{
+    uint32_t bg = *p_px;
+    uint32_t rb = UDIV255_X2(fg_rb_pre + RGB565_RB(bg) * bg_mix);
+    uint32_t g = fg_g_pre + RGB565_G(bg) * bg_mix;
+    g = (g + (g >> 8) + 1) >> 8;
+    *p_px = (uint16_t)(((rb >> 5) & 0xF800u) | (g << 5) | (rb & 0x001Fu));
+}
+
+/* One 4 bpp pixel: nothing to do when transparent, a plain store when opaque */
+static inline void _blend_nibble(uint16_t * p_px, uint32_t nibble, const uint32_t * p_fg_rb_pre,
+                                 const uint16_t * p_fg_g_pre, const uint8_t * p_bg_mix, uint16_t fg)
+{
+    uint32_t bg_mix = p_bg_mix[nibble];
+    if (bg_mix == LV_OPA_COVER) return;
+    if (bg_mix == 0) {
+        *p_px = fg;
+        return;
+    }
+    _blend_px(p_px, p_fg_rb_pre[nibble], p_fg_g_pre[nibble], bg_mix);
+}
+#endif // LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
+
+/**
+ * 4 bpp glyph blended over whatever is in the buffer, for labels over images, gradients or the
+ * parent's background. The 16 alpha steps of the text color are premultiplied once per letter,
+ * a pixel then costs two table lookups and two multiplies, and the bitmap is walked one byte
+ * (2 pixels) at a time so blank and solid pairs are skipped or stored as a single word.
+ * Masks and blend modes are not handled, lv_draw_sw_letter() only calls it without them.
+ */
+LV_ATTRIBUTE_FAST_MEM void draw_letter_blend_opt(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                 const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p)
+{
+#if LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
+    lv_area_t letter_area;
+    letter_area.x1 = pos->x;
+    letter_area.y1 = pos->y;
+    letter_area.x2 = letter_area.x1 + g->box_w - 1;
+    letter_area.y2 = letter_area.y1 + g->box_h - 1;
+
+    lv_area_t buf_clip_area;
+    lv_area_t glyph_cliped_area;
+    if (!_lv_area_intersect(&buf_clip_area, draw_ctx->buf_area, draw_ctx->clip_area)) return;
+    if (!_lv_area_intersect(&glyph_cliped_area, &letter_area, &buf_clip_area)) return;
+
+    /* Same result as draw_letter_normal() and lv_draw_sw_blend(): the opacity scales the mask
+     * there, then the blend once more, and lv_color_mix() rounds with LV_COLOR_MIX_ROUND_OFS */
+    if (dsc->opa <= LV_OPA_MIN) return;
+    uint16_t fg = dsc->color.full;
+    uint32_t fg_rb_pre[16];
+    uint16_t fg_g_pre[16];
+    uint8_t bg_mix[16];
+    for (uint32_t i = 0; i < 16; i++) {
+        uint32_t mix = _lv_bpp4_opa_table[i];
+        if (dsc->opa < LV_OPA_MAX && mix) {
+            mix = (mix == LV_OPA_COVER) ? dsc->opa : (mix * dsc->opa) >> 8;
+            mix = (mix * dsc->opa) >> 8;
+        }
+        fg_rb_pre[i] = RGB565_RB(fg) * mix + ((LV_COLOR_MIX_ROUND_OFS << 16) | LV_COLOR_MIX_ROUND_OFS);
+        fg_g_pre[i] = (uint16_t)(RGB565_G(fg) * mix + LV_COLOR_MIX_ROUND_OFS);
+        bg_mix[i] = (uint8_t)(LV_OPA_COVER - mix);
+    }
+    uint32_t fg_pair = ((uint32_t)fg << 16) | fg;
+    bool solid_pair = (bg_mix[15] == 0);
+
+    lv_coord_t buf_area_width = lv_area_get_width(draw_ctx->buf_area);
+    lv_coord_t cliped_width = lv_area_get_width(&glyph_cliped_area);
+    lv_coord_t cliped_height = lv_area_get_height(&glyph_cliped_area);
+    uint16_t * p_buf_row = (uint16_t *)draw_ctx->buf + (glyph_cliped_area.y1 - draw_ctx->buf_area->y1) * buf_area_width +
+                           (glyph_cliped_area.x1 - draw_ctx->buf_area->x1);
+    uint32_t bitmap_idx_row = (glyph_cliped_area.y1 - letter_area.y1) * g->box_w + (glyph_cliped_area.x1 - letter_area.x1);
+
+    for (lv_coord_t row = cliped_height; row != 0; row--) {
+        uint16_t * p_px = p_buf_row;
+        uint32_t bitmap_idx = bitmap_idx_row;
+        lv_coord_t cnt = cliped_width;
+        p_buf_row += buf_area_width;
+        bitmap_idx_row += g->box_w;
+
+        // rows are packed without padding, a row may start on the low nibble
+        if (bitmap_idx & 1) {
+            _blend_nibble(p_px, map_p[bitmap_idx >> 1] & 0xF, fg_rb_pre, fg_g_pre, bg_mix, fg);
+            p_px++;
+            bitmap_idx++;
+            cnt--;
+        }
+
+        const uint8_t * p_bits = &map_p[bitmap_idx >> 1];
+        for (; cnt >= 2; cnt -= 2) {
+            uint32_t bits = *p_bits++;
+            if (bits == 0) {
+                p_px += 2;
+                continue;
+            }
+            if (bits == 0xFF && solid_pair) {
+                if (((uintptr_t)p_px & 0x3) == 0) {
+                    *(uint32_t *)p_px = fg_pair;
+                }
+                else {
+                    p_px[0] = fg;
+                    p_px[1] = fg;
+                }
+                p_px += 2;
+                continue;
+            }
+            _blend_nibble(&p_px[0], bits >> 4, fg_rb_pre, fg_g_pre, bg_mix, fg);
+            _blend_nibble(&p_px[1], bits & 0xF, fg_rb_pre, fg_g_pre, bg_mix, fg);
+            p_px += 2;
+        }
+
+        if (cnt) {
+            _blend_nibble(p_px, *p_bits >> 4, fg_rb_pre, fg_g_pre, bg_mix, fg);
+        }
+    }
+#endif // LV_GDX_PATCH_DRAW_FONT_WITH_PALETTE
+}
+
 __attribute__((unused)) LV_ATTRIBUTE_FAST_MEM void draw_letter_normal_opt(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
                                                      const lv_point_t * pos, lv_font_glyph_dsc_t * g, const uint8_t * map_p)
 {
@@ -18,6 +18,7 @@
 #include "../draw/lv_draw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
+#include "render_profiler.h"
 
 /*********************
  *      DEFINES
@@ -62,6 +63,10 @@ void lv_obj_redraw_opt(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     lv_coord_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
     lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
     bool com_clip_res = _lv_area_intersect(&clip_coords_for_obj, clip_area_ori, &obj_coords_ext);
+#if LV_GDX_PATCH_ROUND_DISP
+    /*Nothing to draw in the invisible corners of a round display*/
+    com_clip_res = com_clip_res && _lv_refr_area_is_visible(&clip_coords_for_obj);
+#endif // LV_GDX_PATCH_ROUND_DISP
     /*If the object is visible on the current clip area OR has overflow visible draw it.
      *With overflow visible drawing should happen to apply the masks which might affect children */
     bool should_draw = com_clip_res || lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
@@ -77,6 +82,7 @@ void lv_obj_redraw_opt(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 
     if(should_draw) {
         draw_ctx->clip_area = &clip_coords_for_obj;
+        render_profiler_zone_begin(rp_main);
 
         #if LV_GDX_PATCH_SIMPLIFY_DRAW_EVENT
         e.target = obj;
@@ -97,6 +103,7 @@ void lv_obj_redraw_opt(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
         lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
         #endif
+        render_profiler_zone_end(RP_ZONE_OBJ_DRAW, obj->class_p, rp_main);
 #if LV_USE_REFR_DEBUG
         lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
         lv_draw_rect_dsc_t draw_dsc;
@@ -121,6 +128,11 @@ void lv_obj_redraw_opt(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         if(!_lv_area_intersect(&clip_coords_for_children, clip_area_ori, &obj->coords)) {
             refr_children = false;
         }
+#if LV_GDX_PATCH_ROUND_DISP
+        else if(!_lv_refr_area_is_visible(&clip_coords_for_children)) {
+            refr_children = false;
+        }
+#endif // LV_GDX_PATCH_ROUND_DISP
     }
 
     if(refr_children) {
@@ -136,6 +148,7 @@ void lv_obj_redraw_opt(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     /*If the object was visible on the clip area call the post draw events too*/
     if(should_draw) {
         draw_ctx->clip_area = &clip_coords_for_obj;
+        render_profiler_zone_begin(rp_post);
 
         #if LV_GDX_PATCH_SIMPLIFY_DRAW_EVENT
         e.code = LV_EVENT_DRAW_POST_BEGIN;
@@ -150,6 +163,7 @@ void lv_obj_redraw_opt(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
         lv_event_send(obj, LV_EVENT_DRAW_POST, draw_ctx);
         lv_event_send(obj, LV_EVENT_DRAW_POST_END, draw_ctx);
         #endif
+        render_profiler_zone_end(RP_ZONE_OBJ_POST, obj->class_p, rp_post);
     }
 
     draw_ctx->clip_area = clip_area_ori;
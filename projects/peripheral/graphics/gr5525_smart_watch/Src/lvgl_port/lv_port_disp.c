@@ -9,9 +9,53 @@
 #include "display_crtl_drv.h"
 #include "flash_driver.h"
 #include "lv_port_dma.h"
+#include "lv_port_gximg.h"
 
 #include "app_drv_config.h"
 
+/*
+ * Partial refresh: only the dirty rectangles are rendered and sent, each one in its own
+ * panel window (CASET/RASET). The invalid areas of a frame are merged into at most
+ * DISP_PARTIAL_MAX_RECTS rectangles, and the whole screen is sent once they cover more
+ * than DISP_PARTIAL_FULL_PERCENT of it.
+ */
+#define DISP_PARTIAL_REFRESH            1
+#define DISP_PARTIAL_MAX_RECTS          4
+#define DISP_PARTIAL_RECT_COST_PX       2400u   /* window set + RAMWR restart (~0.2ms) in pixels, cheaper growth is merged */
+#define DISP_PARTIAL_FULL_PERCENT       60u
+
+/*
+ * Band skip: every band is hashed before it is flushed and compared with the last band sent to
+ * exactly the same area. Unchanged bands are not sent again, the panel RAM still holds them.
+ * A sent band drops the signatures of the other areas it overlaps.
+ */
+#define DISP_BAND_HASH_SKIP             1
+#define DISP_BAND_HASH_SLOT_CNT         16
+
+/*
+ * Round panel: only the circle inscribed in the square is visible. Objects in the corners are not
+ * drawn, invalid areas are narrowed to the visible columns of their rows and so is a band, when
+ * that saves more pixels than the extra window costs (DISP_PARTIAL_RECT_COST_PX).
+ */
+#define DISP_ROUND_CLIP                 1
+#define DISP_ROUND_DIAMETER             DISP_HOR_RES    /* enlarge to keep a safety ring */
+
+/*
+ * Swipe snapshots: the fast tileview draws a swipe from RGB565 snapshots of the 2 tiles. By default
+ * they are taken from the LVGL heap (SRAM) when it has room, otherwise the swipe is drawn live.
+ * Boards with a QSPI PSRAM on QSPI1 pin group 0 define BOARD_QSPI1_PSRAM to 1 to put them in the
+ * PSRAM, mapped for XIP. Not on GR5625_SK: those pins (GPIOA 8/9/12-15) are the touch I2C and the
+ * display DC/RST/TE there.
+ */
+#ifndef BOARD_QSPI1_PSRAM
+#define BOARD_QSPI1_PSRAM               0
+#endif
+
+#if BOARD_QSPI1_PSRAM && GR5625_SK
+#error "BOARD_QSPI1_PSRAM: QSPI1 pin group 0 collides with the touch and display pins of GR5625_SK"
+#endif
+
+#define DISP_SNAPSHOT_IN_PSRAM          BOARD_QSPI1_PSRAM
 
 /**********************
  *   LOCAL FUNCTIONS AND VARIABLES
@@ -24,7 +68,22 @@ static void disp_set_clip_area(struct _lv_disp_drv_t * disp_drv, const lv_area_t
 #if (SCREEN_TYPE == 1) && TE_SIGNAL_ENABLED
 static void disp_start_render(struct _lv_disp_drv_t * disp_drv);
 #endif // (SCREEN_TYPE == 1) && TE_SIGNAL_ENABLED
+#if DISP_FLUSH_PIPELINED
+static void disp_wait(struct _lv_disp_drv_t * disp_drv);
+#endif // DISP_FLUSH_PIPELINED
 static void rounder_cb(lv_disp_drv_t * disp_drv, lv_area_t * area);
+#if DISP_PARTIAL_REFRESH && LV_GDX_PATCH_JOIN_AREA_CB
+static void disp_join_area(lv_disp_drv_t * disp_drv, lv_area_t * areas, uint8_t * joined, uint16_t area_cnt);
+#endif // DISP_PARTIAL_REFRESH && LV_GDX_PATCH_JOIN_AREA_CB
+#if DISP_BAND_HASH_SKIP
+static void disp_band_hash_reset(void);
+static bool disp_band_unchanged(const lv_area_t * area, const lv_color_t * color_p);
+#endif // DISP_BAND_HASH_SKIP
+#if DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
+static void disp_round_init(void);
+static bool disp_round_trim(lv_area_t * area);
+static void disp_band_area(lv_disp_drv_t * disp_drv, lv_area_t * band);
+#endif // DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
 static volatile bool g_lvgl_refr_enable = true;
 static volatile bool g_lvgl_disp_enable = true;
 
@@ -41,6 +100,24 @@ __align(16) static uint8_t s_framebuffer_2[DISP_HOR_RES * VER_BUFF_LINE * 2];
 
 __align(16) uint32_t s_magic = 0xDEADBEAF;
 
+#if DISP_BAND_HASH_SKIP
+typedef struct
+{
+    lv_area_t   area;
+    uint32_t    hash;
+    bool        valid;
+} disp_band_sig_t;
+
+static disp_band_sig_t s_band_sig[DISP_BAND_HASH_SLOT_CNT];
+static uint32_t        s_band_sig_next = 0;
+static volatile bool   s_band_sig_stale = false;   /* set by lv_display_enable_set(), reset by the next flush */
+#endif // DISP_BAND_HASH_SKIP
+
+#if DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
+/* First visible column of every row */
+static lv_coord_t s_round_inset[DISP_VER_RES];
+#endif // DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -57,6 +134,13 @@ bool lv_refresh_enable_get(void)
 
 void lv_display_enable_set(bool enable)
 {
+#if DISP_BAND_HASH_SKIP
+    if(enable && !g_lvgl_disp_enable)
+    {
+        /* The panel may have slept, been reset or written by someone else meanwhile */
+        s_band_sig_stale = true;
+    }
+#endif // DISP_BAND_HASH_SKIP
     g_lvgl_disp_enable = enable;
 }
 
@@ -89,16 +173,25 @@ void lv_port_disp_init(void)
     /*Set the resolution of the display*/
     disp_drv.hor_res = DISP_HOR_RES;
     disp_drv.ver_res = DISP_VER_RES;
-    disp_drv.full_refresh = 1;
+    disp_drv.full_refresh = DISP_PARTIAL_REFRESH ? 0 : 1;
 
     /*Used to copy the buffer's content to the display*/
     disp_drv.flush_cb = disp_flush;
 
+#if DISP_FLUSH_PIPELINED
+    /*Sleep on the QSPI TX event instead of spinning on draw_buf->flushing*/
+    disp_drv.wait_cb = disp_wait;
+#endif // DISP_FLUSH_PIPELINED
+
     /*Set a display buffer*/
     disp_drv.draw_buf = &draw_buf_dsc;
 
     disp_drv.rounder_cb = &rounder_cb;
 
+#if DISP_PARTIAL_REFRESH && LV_GDX_PATCH_JOIN_AREA_CB
+    disp_drv.join_area_cb = disp_join_area;
+#endif // DISP_PARTIAL_REFRESH && LV_GDX_PATCH_JOIN_AREA_CB
+
 #if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
     disp_drv.set_clip_area_cb = disp_set_clip_area;
 #endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
@@ -107,10 +200,25 @@ void lv_port_disp_init(void)
     disp_drv.render_start_cb = disp_start_render;
 #endif // (SCREEN_TYPE == 1) && TE_SIGNAL_ENABLED
 
+#if DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
+    disp_round_init();
+    disp_drv.round_inset = s_round_inset;
+    disp_drv.band_area_cb = disp_band_area;
+#endif // DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
+
     lv_disp_t * disp = lv_disp_drv_register(&disp_drv);
     // 不绘制背景颜色
     disp->bg_color = lv_color_black();
     disp->bg_opa = LV_OPA_TRANSP;
+
+    // Resources in binary_resources.bin may be GX-IMG or RLE compressed, register the decoder for all screens
+    lv_gximg_init();
+
+#if DISP_SNAPSHOT_IN_PSRAM && LV_GDX_PATCH_USE_FAST_TILEVIEW && LV_FAST_TILEVIEW_SNAPSHOT
+    uint32_t psram_size = 0;
+    void *p_psram = gx_psram_init(&psram_size);
+    lv_fast_tileview_set_snapshot_pool(p_psram, psram_size);
+#endif // DISP_SNAPSHOT_IN_PSRAM && LV_GDX_PATCH_USE_FAST_TILEVIEW && LV_FAST_TILEVIEW_SNAPSHOT
 }
 
 /**********************
@@ -122,6 +230,11 @@ static void disp_init(void)
     disp_crtl_init();
 
     lv_dma_init();
+
+#if DISP_BAND_HASH_SKIP
+    /* The panel RAM is lost with the panel init */
+    disp_band_hash_reset();
+#endif // DISP_BAND_HASH_SKIP
 }
 
 /* Flush the content of the internal buffer the specific area on the display
@@ -131,16 +244,123 @@ static void disp_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_colo
 {
     if(lv_display_enable_get())
     {
+#if DISP_BAND_HASH_SKIP
+        if(s_band_sig_stale)
+        {
+            s_band_sig_stale = false;
+            disp_band_hash_reset();
+        }
+        if(disp_band_unchanged(area, color_p))
+        {
+            disp_crtl_skip(disp_drv, area);
+            lv_disp_flush_ready(disp_drv);
+            return;
+        }
+#endif // DISP_BAND_HASH_SKIP
         disp_crtl_flush(disp_drv, area, color_p);
+#if DISP_FLUSH_PIPELINED
+        /* lv_disp_flush_ready() comes from the QSPI TX complete event */
+        return;
+#endif // DISP_FLUSH_PIPELINED
     }
-    disp_drv->draw_buf->flushing = 0;
-    disp_drv->draw_buf->flushing_last = 0;
+    lv_disp_flush_ready(disp_drv);
 }
 
+#if DISP_BAND_HASH_SKIP
+#define BAND_HASH_PRIME1    0x9E3779B1u
+#define BAND_HASH_PRIME2    0x85EBCA77u
+#define BAND_HASH_PRIME3    0xC2B2AE3Du
+#define BAND_HASH_ROTL(x, r)    ((x) << (r) | (x) >> (32 - (r)))
+#define BAND_HASH_ROUND(acc, word)  do { (acc) += (word) * BAND_HASH_PRIME2; (acc) = BAND_HASH_ROTL(acc, 13) * BAND_HASH_PRIME1; } while (0)
+
+/* xxHash32 style hash, four independent lanes keep the multiplier busy. Bands are even sized, so whole words */
+__attribute__((section("RAM_CODE"))) static uint32_t disp_band_hash(const uint32_t * p_data, uint32_t words)
+{
+    uint32_t acc1 = BAND_HASH_PRIME1 + BAND_HASH_PRIME2;
+    uint32_t acc2 = BAND_HASH_PRIME2;
+    uint32_t acc3 = 0;
+    uint32_t acc4 = 0u - BAND_HASH_PRIME1;
+    uint32_t n;
+
+    for (n = words >> 2; n > 0; n--)
+    {
+        BAND_HASH_ROUND(acc1, p_data[0]);
+        BAND_HASH_ROUND(acc2, p_data[1]);
+        BAND_HASH_ROUND(acc3, p_data[2]);
+        BAND_HASH_ROUND(acc4, p_data[3]);
+        p_data += 4;
+    }
+    for (n = words & 3u; n > 0; n--)
+    {
+        BAND_HASH_ROUND(acc1, *p_data++);
+    }
+
+    uint32_t h = BAND_HASH_ROTL(acc1, 1) + BAND_HASH_ROTL(acc2, 7) + BAND_HASH_ROTL(acc3, 12) + BAND_HASH_ROTL(acc4, 18) + words;
+    h ^= h >> 15;
+    h *= BAND_HASH_PRIME2;
+    h ^= h >> 13;
+    h *= BAND_HASH_PRIME3;
+    h ^= h >> 16;
+    return h;
+}
+
+/* Forget the sent bands, the panel RAM no longer holds them */
+static void disp_band_hash_reset(void)
+{
+    lv_memset_00(s_band_sig, sizeof(s_band_sig));
+    s_band_sig_next = 0;
+}
+
+/* True when the panel already shows this band, otherwise the band is recorded as sent */
+static bool disp_band_unchanged(const lv_area_t * area, const lv_color_t * color_p)
+{
+    uint32_t hash = disp_band_hash((const uint32_t *)color_p, lv_area_get_size(area) * sizeof(lv_color_t) / 4);
+    disp_band_sig_t * p_slot = NULL;
+    uint32_t i;
+
+    for (i = 0; i < DISP_BAND_HASH_SLOT_CNT; i++)
+    {
+        disp_band_sig_t * p_sig = &s_band_sig[i];
+        if (!p_sig->valid)
+        {
+            continue;
+        }
+        if (_lv_area_is_equal(&p_sig->area, area))
+        {
+            if (p_sig->hash == hash)
+            {
+                return true;
+            }
+            p_slot = p_sig;
+        }
+        else if (_lv_area_is_on(&p_sig->area, area))
+        {
+            p_sig->valid = false;
+        }
+    }
+
+    if (!p_slot)
+    {
+        for (i = 0; i < DISP_BAND_HASH_SLOT_CNT && s_band_sig[i].valid; i++) {}
+        if (i == DISP_BAND_HASH_SLOT_CNT)
+        {
+            i = s_band_sig_next;
+            s_band_sig_next = (s_band_sig_next + 1) % DISP_BAND_HASH_SLOT_CNT;
+        }
+        p_slot = &s_band_sig[i];
+    }
+
+    p_slot->area  = *area;
+    p_slot->hash  = hash;
+    p_slot->valid = true;
+    return false;
+}
+#endif // DISP_BAND_HASH_SKIP
+
 static void rounder_cb(lv_disp_drv_t * disp_drv, lv_area_t * area)
 {
   /* Per RM69330 datasheet, start coord and size must be even*/
-#if (SCREEN_TYPE == 1) && TE_SIGNAL_ENABLED
+#if (SCREEN_TYPE == 1) && TE_SIGNAL_ENABLED && !DISP_PARTIAL_REFRESH
     area->x1 = 0;
     area->x2 = 359;
     // area->y1 = area->y1 & ~1;
@@ -158,8 +378,150 @@ static void rounder_cb(lv_disp_drv_t * disp_drv, lv_area_t * area)
     if ((area->y2 - area->y1 + 1) & 1) {
         area->y2 = area->y2 + 1;
     }
-#endif // (SCREEN_TYPE == 1) && TE_SIGNAL_ENABLED
+#endif // (SCREEN_TYPE == 1) && TE_SIGNAL_ENABLED && !DISP_PARTIAL_REFRESH
+}
+
+#if DISP_PARTIAL_REFRESH && LV_GDX_PATCH_JOIN_AREA_CB
+/* Merge the (already even aligned) invalid areas into a few rectangles, joins of aligned areas stay aligned */
+static void disp_join_area(lv_disp_drv_t * disp_drv, lv_area_t * areas, uint8_t * joined, uint16_t area_cnt)
+{
+    uint32_t rect_cnt = 0;
+    uint32_t i, j;
+
+    for (i = 0; i < area_cnt; i++)
+    {
+        if (!joined[i])
+        {
+#if DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
+            /* Drop the areas in the corners, narrow the others to the visible columns */
+            if (!disp_round_trim(&areas[i]))
+            {
+                continue;
+            }
+#endif // DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
+            areas[rect_cnt++] = areas[i];
+        }
+    }
+
+    /* Join the pair which grows least, until every further join costs more than a new window */
+    while (rect_cnt > 1)
+    {
+        uint32_t best_i = 0, best_j = 0;
+        int32_t  best_growth = INT32_MAX;
+        lv_area_t union_area;
+
+        for (i = 0; i < rect_cnt; i++)
+        {
+            for (j = i + 1; j < rect_cnt; j++)
+            {
+                _lv_area_join(&union_area, &areas[i], &areas[j]);
+                int32_t growth = (int32_t)lv_area_get_size(&union_area) - (int32_t)lv_area_get_size(&areas[i]) - (int32_t)lv_area_get_size(&areas[j]);
+                if (growth < best_growth)
+                {
+                    best_growth = growth;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+
+        if (best_growth > (int32_t)DISP_PARTIAL_RECT_COST_PX && rect_cnt <= DISP_PARTIAL_MAX_RECTS)
+        {
+            break;
+        }
+
+        _lv_area_join(&areas[best_i], &areas[best_i], &areas[best_j]);
+        areas[best_j] = areas[--rect_cnt];
+    }
+
+    /* Mostly dirty: one full screen window is cheaper than several large ones */
+    uint32_t dirty_px = 0;
+    for (i = 0; i < rect_cnt; i++)
+    {
+        dirty_px += lv_area_get_size(&areas[i]);
+    }
+    if (rect_cnt > 1 && dirty_px * 100u > (uint32_t)disp_drv->hor_res * disp_drv->ver_res * DISP_PARTIAL_FULL_PERCENT)
+    {
+        lv_area_set(&areas[0], 0, 0, disp_drv->hor_res - 1, disp_drv->ver_res - 1);
+        rect_cnt = 1;
+    }
+
+    /* Top-down order keeps the panel writes ahead of the TE scan line */
+    for (i = 1; i < rect_cnt; i++)
+    {
+        lv_area_t tmp = areas[i];
+        for (j = i; j > 0 && areas[j - 1].y1 > tmp.y1; j--)
+        {
+            areas[j] = areas[j - 1];
+        }
+        areas[j] = tmp;
+    }
+
+    for (i = 0; i < area_cnt; i++)
+    {
+        joined[i] = (i < rect_cnt) ? 0 : 1;
+    }
 }
+#endif // DISP_PARTIAL_REFRESH && LV_GDX_PATCH_JOIN_AREA_CB
+
+#if DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
+static void disp_round_init(void)
+{
+    /* Pixel centers in half pixel units, (2x + 1 - W)^2 + (2y + 1 - H)^2 <= D^2 is visible */
+    const int32_t w = DISP_HOR_RES;
+    const int32_t h = DISP_VER_RES;
+    const int32_t d = DISP_ROUND_DIAMETER;
+    int32_t x, y;
+
+    for (y = 0; y < h; y++)
+    {
+        int32_t dy = 2 * y + 1 - h;
+        for (x = 0; x < w / 2; x++)
+        {
+            int32_t dx = 2 * x + 1 - w;
+            if (dx * dx + dy * dy <= d * d)
+            {
+                break;
+            }
+        }
+        s_round_inset[y] = (lv_coord_t)x;
+    }
+}
+
+/* Narrow an (even aligned) area to the visible columns of its rows, false if nothing of it is visible */
+static bool disp_round_trim(lv_area_t * area)
+{
+    /* The row closest to the center line is the widest */
+    lv_coord_t row = LV_CLAMP(area->y1, (lv_coord_t)(DISP_VER_RES - 1) / 2, area->y2);
+    lv_coord_t inset = s_round_inset[row];
+    lv_coord_t x1 = LV_MAX(area->x1, inset & ~1);
+    lv_coord_t x2 = LV_MIN(area->x2, (lv_coord_t)(DISP_HOR_RES - 1) - inset);
+
+    if (x1 > x2)
+    {
+        return false;
+    }
+    if ((x2 - x1 + 1) & 1)
+    {
+        x2++;
+    }
+    area->x1 = x1;
+    area->x2 = x2;
+    return true;
+}
+
+/* A band narrower than its area needs its own panel window, which pays off for the top and bottom bands */
+static void disp_band_area(lv_disp_drv_t * disp_drv, lv_area_t * band)
+{
+    lv_area_t trimmed = *band;
+
+    if (disp_round_trim(&trimmed) &&
+        (uint32_t)(lv_area_get_width(band) - lv_area_get_width(&trimmed)) * lv_area_get_height(band) > DISP_PARTIAL_RECT_COST_PX)
+    {
+        *band = trimmed;
+    }
+}
+#endif // DISP_ROUND_CLIP && LV_GDX_PATCH_ROUND_DISP
 
 #if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
 static void disp_set_clip_area(struct _lv_disp_drv_t * disp_drv, const lv_area_t * clip_area)
@@ -176,5 +538,12 @@ static void disp_start_render(struct _lv_disp_drv_t * disp_drv)
 }
 #endif // (SCREEN_TYPE == 1) && TE_SIGNAL_ENABLED
 
+#if DISP_FLUSH_PIPELINED
+static void disp_wait(struct _lv_disp_drv_t * disp_drv)
+{
+    disp_crtl_wait();
+}
+#endif // DISP_FLUSH_PIPELINED
+
 /* This dummy typedef exists purely to silence -Wpedantic. */
 typedef int keep_pedantic_happy;
@@ -16,6 +16,8 @@ void lv_refresh_enable_set(bool enable);
 
 bool lv_refresh_enable_get(void);
 
+/* Enabling the display again also forgets the bands already sent: disable it while the panel
+ * sleeps or is written outside LVGL */
 void lv_display_enable_set(bool enable);
 
 bool lv_display_enable_get(void);
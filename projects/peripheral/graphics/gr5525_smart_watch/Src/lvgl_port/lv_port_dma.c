@@ -1,3 +1,4 @@
+#include <string.h>
 #include "lv_conf.h"
 #include "lv_port_dma.h"
 #include "FreeRTOS.h"
@@ -5,12 +6,35 @@
 
 
 #define DMA_SYNC_MODE                   1       // 0 : CPU Wait ; 1 : Semhr Wait
-#define DMA_LLP_NODE_DYNAMIC_ALLOC      1u
 
-#if DMA_LLP_NODE_DYNAMIC_ALLOC == 0u
-dma_block_config_t s_dma_llp_block[DISP_VER_RES + 1];
+/*
+ * LLP descriptors come from a fixed pool owned by this port, one chain at a time
+ * since every transfer waits for completion. One node per line of a draw band
+ * plus the remainder block; longer chains fall back to the CPU.
+ */
+#if APP_DRIVER_CHIP_TYPE == APP_DRIVER_GR5525X
+    #define DMA_LLP_POOL_SIZE           (VER_BUFF_LINE + 1u)
+#else
+    #define DMA_LLP_POOL_SIZE           (DISP_VER_RES + 1u)
 #endif
 
+/* Geometry of the chain built in the pool: block_count nodes of block_beat beats,
+ * then one node of tail_beat beats when tail_beat is not 0 */
+typedef struct {
+    uint32_t src_addr;
+    uint32_t src_step;
+    uint32_t dst_addr;
+    uint32_t dst_step;
+    uint32_t ctl_l;
+    uint32_t block_beat;
+    uint32_t block_count;
+    uint32_t tail_beat;
+} dma_llp_chain_t;
+
+static dma_block_config_t s_dma_llp_pool[DMA_LLP_POOL_SIZE];
+static dma_llp_chain_t    s_dma_llp_chain;
+static bool               s_dma_llp_chain_valid = false;
+
 static app_dma_params_t s_dma_param;
 static dma_id_t         s_dma_id;
 //static volatile bool is_dma_xfer_done = false;
@@ -82,8 +106,75 @@ static void _reconfig_dma(uint32_t src_inc, uint32_t dst_inc, uint32_t src_width
 }
 #endif
 
+/*
+ * Return the head of the chain described by p_chain, or NULL when it does not fit
+ * in the pool. A chain with the same geometry as the previous call (e.g. the
+ * 360x40 band clear) is only re-armed: the controller writes CTL back into every
+ * LLI at the end of its block, so CTL_H is restored but nothing is relinked.
+ */
+__attribute__((section("RAM_CODE"))) static dma_block_config_t * _dma_llp_chain_get(const dma_llp_chain_t * p_chain) {
+    uint32_t node_count = p_chain->block_count + (p_chain->tail_beat ? 1 : 0);
+    uint32_t i;
+
+    if(node_count == 0 || node_count > DMA_LLP_POOL_SIZE) {
+        return NULL;
+    }
+
+    if(s_dma_llp_chain_valid && memcmp(&s_dma_llp_chain, p_chain, sizeof(dma_llp_chain_t)) == 0) {
+        for(i = 0; i < node_count; i++) {
+            s_dma_llp_pool[i].CTL_L      = p_chain->ctl_l;
+            s_dma_llp_pool[i].CTL_H      = (i < p_chain->block_count) ? p_chain->block_beat : p_chain->tail_beat;
+            s_dma_llp_pool[i].src_status = 0x00;
+            s_dma_llp_pool[i].dst_status = 0x00;
+        }
+        return &s_dma_llp_pool[0];
+    }
+
+    uint32_t src_addr = p_chain->src_addr;
+    uint32_t dst_addr = p_chain->dst_addr;
+    for(i = 0; i < node_count; i++) {
+        dma_block_config_t * p_llp_block = &s_dma_llp_pool[i];
+        p_llp_block->src_address = src_addr;
+        p_llp_block->dst_address = dst_addr;
+        p_llp_block->src_status  = 0x00;
+        p_llp_block->dst_status  = 0x00;
+        p_llp_block->CTL_L       = p_chain->ctl_l;
+        p_llp_block->CTL_H       = (i < p_chain->block_count) ? p_chain->block_beat : p_chain->tail_beat;
+        p_llp_block->p_lli       = (i + 1 < node_count) ? &s_dma_llp_pool[i + 1] : NULL;
+
+        src_addr += p_chain->src_step;
+        dst_addr += p_chain->dst_step;
+    }
+
+    s_dma_llp_chain       = *p_chain;
+    s_dma_llp_chain_valid = true;
+
+    return &s_dma_llp_pool[0];
+}
+
 #define DMA_LLP_BLOCK_CTL_CONST_FLAGS (DMA_CTLL_INI_EN | DMA_SRC_INCREMENT | DMA_SRC_GATHER_ENABLE | DMA_DST_SCATTER_ENABLE | DMA_LLP_SRC_ENABLE | DMA_LLP_DST_ENABLE | DMA_MEMORY_TO_MEMORY)
 
+__attribute__((section("RAM_CODE"))) static void _cpu_fill_color(uint32_t dst_addr, uint32_t row_pixel, uint32_t stride_pixel, uint32_t col_pixel, uint32_t color) {
+    lv_color_t  c ;
+
+    c.full = color;
+    for(int y = 0; y < col_pixel; y++) {
+        lv_color_fill((lv_color_t*)dst_addr, c, row_pixel);
+        dst_addr += stride_pixel*sizeof(lv_color_t);
+    }
+}
+
+__attribute__((section("RAM_CODE"))) static void _cpu_memset(uint32_t dst_addr, uint32_t row_pixel, uint32_t stride_pixel, uint32_t col_pixel) {
+    if(row_pixel == stride_pixel) {
+        memset((void*)dst_addr, 0x00, DISP_PIXEL_DEPTH * row_pixel * col_pixel);
+    } else {
+        for(int y = 0; y < col_pixel; y++) {
+            memset((void*)dst_addr, 0x00, DISP_PIXEL_DEPTH * row_pixel);
+            dst_addr += stride_pixel*DISP_PIXEL_DEPTH;
+        }
+    }
+}
+
 /*
  * dst_addr
  * row_pixel    : unit in pixel
@@ -99,21 +190,11 @@ __attribute__((section("RAM_CODE"))) void lv_dma_fill_color(uint32_t dst_addr, u
     src_color                  = color;
     uint32_t p_src_addr        = (uint32_t) &src_color;
     uint32_t p_dst_addr        = (uint32_t) dst_addr;
-    uint32_t i                 = 0;
-
-    dma_block_config_t * p_llp_block      = NULL;
-    dma_block_config_t * p_llp_block_prev = NULL;
-    lv_color_t  c ;
 
     uint32_t total_pixel = row_pixel * col_pixel;
 
-    c.full = color;
     if(total_pixel <= 60*60) {
-        for(int y = 0; y < col_pixel; y++) {
-            lv_color_fill((lv_color_t*)dst_addr, c, row_pixel);
-            dst_addr += stride_pixel*color_bytes;
-        }
-
+        _cpu_fill_color(dst_addr, row_pixel, stride_pixel, col_pixel, color);
         return;
     }
 
@@ -142,6 +223,32 @@ __attribute__((section("RAM_CODE"))) void lv_dma_fill_color(uint32_t dst_addr, u
         xfer_width = DMA_SDATAALIGN_HALFWORD | DMA_DDATAALIGN_HALFWORD ;
     }
 
+    dma_llp_chain_t chain = {
+        .src_addr    = p_src_addr,
+        .src_step    = 0,
+        .dst_addr    = p_dst_addr,
+        .dst_step    = block_stride * color_bytes,
+        .ctl_l       = DMA_CTLL_INI_EN
+                        | DMA_SRC_NO_CHANGE
+                        | DMA_DST_INCREMENT
+                        | DMA_SRC_GATHER_DISABLE
+                        | DMA_DST_SCATTER_ENABLE
+                        | DMA_LLP_SRC_DISABLE
+                        | DMA_LLP_DST_ENABLE
+                        | DMA_MEMORY_TO_MEMORY
+                        | xfer_width,
+        .block_beat  = block_pixel,
+        .block_count = block_count,
+        .tail_beat   = block_left,
+    };
+
+    dma_block_config_t * p_head = _dma_llp_chain_get(&chain);
+    if(p_head == NULL) {
+        // More blocks than the LLP pool holds
+        _cpu_fill_color(dst_addr, row_pixel, stride_pixel, col_pixel, color);
+        return;
+    }
+
     // SG LLP Config
     dma_sg_llp_config_t sg_llp_config = {
         .gather_config = {
@@ -155,72 +262,10 @@ __attribute__((section("RAM_CODE"))) void lv_dma_fill_color(uint32_t dst_addr, u
         .llp_config = {
             .llp_src_en = DMA_LLP_SRC_DISABLE,
             .llp_dst_en = DMA_LLP_DST_ENABLE,
-            .head_lli = NULL,
+            .head_lli = p_head,
         },
     };
 
-    for(i = 0; i < block_count; i++) {
-#if DMA_LLP_NODE_DYNAMIC_ALLOC > 0u
-        p_llp_block = pvPortMalloc(sizeof(dma_block_config_t));
-#else
-        p_llp_block = &s_dma_llp_block[i];
-#endif
-        p_llp_block->src_address = p_src_addr;
-        p_llp_block->dst_address = p_dst_addr;
-        p_llp_block->src_status  = 0x00;
-        p_llp_block->dst_status  = 0x00;
-        p_llp_block->CTL_L       = DMA_CTLL_INI_EN
-                                    | DMA_SRC_NO_CHANGE
-                                    | DMA_DST_INCREMENT
-                                    | DMA_SRC_GATHER_DISABLE
-                                    | DMA_DST_SCATTER_ENABLE
-                                    | DMA_LLP_SRC_DISABLE
-                                    | DMA_LLP_DST_ENABLE
-                                    | DMA_MEMORY_TO_MEMORY
-                                    | xfer_width;
-        p_llp_block->CTL_H       = block_pixel;
-        p_llp_block->p_lli       = NULL;
-
-        if(p_llp_block_prev == NULL) {
-            sg_llp_config.llp_config.head_lli = p_llp_block;
-        } else {
-            p_llp_block_prev->p_lli = p_llp_block;
-        }
-        p_llp_block_prev = p_llp_block;
-
-        p_dst_addr += block_stride * color_bytes;
-    }
-
-    if(block_left > 0) {
-#if DMA_LLP_NODE_DYNAMIC_ALLOC > 0u
-        p_llp_block = pvPortMalloc(sizeof(dma_block_config_t));
-#else
-        p_llp_block = &s_dma_llp_block[i];
-#endif
-        p_llp_block->src_address = p_src_addr;
-        p_llp_block->dst_address = p_dst_addr;
-        p_llp_block->src_status  = 0x00;
-        p_llp_block->dst_status  = 0x00;
-        p_llp_block->CTL_L       = DMA_CTLL_INI_EN
-                                    | DMA_SRC_NO_CHANGE
-                                    | DMA_DST_INCREMENT
-                                    | DMA_SRC_GATHER_DISABLE
-                                    | DMA_DST_SCATTER_ENABLE
-                                    | DMA_LLP_SRC_DISABLE
-                                    | DMA_LLP_DST_ENABLE
-                                    | DMA_MEMORY_TO_MEMORY
-                                    | xfer_width;
-        p_llp_block->CTL_H       = block_left;
-        p_llp_block->p_lli       = NULL;
-
-        if(p_llp_block_prev == NULL) {
-            sg_llp_config.llp_config.head_lli = p_llp_block;
-        } else {
-            p_llp_block_prev->p_lli = p_llp_block;
-        }
-        p_llp_block_prev = p_llp_block;
-    }
-
     s_dma_xfer_flag  = 0x00;
     s_dma_over_flag  = _DMA_FLAG_XFER_DONE | _DMA_FLAG_BLK_DONE;
 
@@ -235,23 +280,6 @@ __attribute__((section("RAM_CODE"))) void lv_dma_fill_color(uint32_t dst_addr, u
         printf("dma xfer err :%d!\r\n", status);
     }
 
-#if DMA_LLP_NODE_DYNAMIC_ALLOC > 0u
-    // Free LLP nodes
-    if (sg_llp_config.llp_config.head_lli)
-    {
-        dma_block_config_t * p = sg_llp_config.llp_config.head_lli;
-        dma_block_config_t * q = NULL;
-        while (p)
-        {
-            q = p->p_lli;
-            vPortFree(p);
-            p = q;
-        }
-    }
-#else
-    memset(&s_dma_llp_block[0], 0, (DISP_VER_RES + 1)*sizeof(dma_block_config_t));
-#endif
-
     return;
 }
 
@@ -263,26 +291,13 @@ __attribute__((section("RAM_CODE"))) void lv_dma_memset(uint32_t dst_addr, uint3
     uint32_t p_src_addr        = (uint32_t) &color;
     uint32_t p_dst_addr        = (uint32_t) dst_addr;
 
-    dma_block_config_t * p_llp_block      = NULL;
-    dma_block_config_t * p_llp_block_prev = NULL;
-
     uint32_t row_bytes = row_pixel * color_bytes;
     bool is_word_xfer  = false; //(row_bytes % 4 != 0) ? false : true;
 
     uint32_t total_bytes = row_bytes * col_pixel;
 
-    if(row_pixel*col_pixel <= 60*60)
-    {
-        if(row_pixel == stride_pixel) {
-            memset((void*)dst_addr, 0x00, color_bytes * row_pixel * col_pixel);
-            dst_addr += col_pixel*stride_pixel*color_bytes;
-        } else {
-            for(int y = 0; y < col_pixel; y++) {
-                memset((void*)dst_addr, 0x00, color_bytes * row_pixel);
-                dst_addr += stride_pixel*color_bytes;
-            }
-        }
-
+    if(row_pixel*col_pixel <= 60*60) {
+        _cpu_memset(dst_addr, row_pixel, stride_pixel, col_pixel);
         return;
     }
 
@@ -292,7 +307,6 @@ __attribute__((section("RAM_CODE"))) void lv_dma_memset(uint32_t dst_addr, uint3
     uint32_t stride_size = 0;
     uint32_t block_beat  = 0;
     uint32_t xfer_width  = 0;
-    int i = 0;
 
     if(is_word_xfer) {
         xfer_width = DMA_SDATAALIGN_WORD     | DMA_DDATAALIGN_WORD ;
@@ -325,6 +339,33 @@ __attribute__((section("RAM_CODE"))) void lv_dma_memset(uint32_t dst_addr, uint3
         stride_size = stride_pixel * color_bytes;
     }
 
+    /* memset in word mode */
+    dma_llp_chain_t chain = {
+        .src_addr    = p_src_addr,
+        .src_step    = 0,
+        .dst_addr    = p_dst_addr,
+        .dst_step    = stride_size,
+        .ctl_l       = DMA_CTLL_INI_EN
+                        | DMA_SRC_NO_CHANGE
+                        | DMA_DST_INCREMENT
+                        | DMA_SRC_GATHER_DISABLE
+                        | DMA_DST_SCATTER_ENABLE
+                        | DMA_LLP_SRC_DISABLE
+                        | DMA_LLP_DST_ENABLE
+                        | DMA_MEMORY_TO_MEMORY
+                        | xfer_width,
+        .block_beat  = block_beat,
+        .block_count = block_count,
+        .tail_beat   = is_word_xfer ? (block_left >> 2) : (block_left >> 1),
+    };
+
+    dma_block_config_t * p_head = _dma_llp_chain_get(&chain);
+    if(p_head == NULL) {
+        // More blocks than the LLP pool holds
+        _cpu_memset(dst_addr, row_pixel, stride_pixel, col_pixel);
+        return;
+    }
+
     // SG LLP Config
     dma_sg_llp_config_t sg_llp_config = {
         .gather_config = {
@@ -338,75 +379,10 @@ __attribute__((section("RAM_CODE"))) void lv_dma_memset(uint32_t dst_addr, uint3
         .llp_config = {
             .llp_src_en = DMA_LLP_SRC_DISABLE,
             .llp_dst_en = DMA_LLP_DST_ENABLE,
-            .head_lli = NULL,
+            .head_lli = p_head,
         },
     };
 
-    for(i = 0; i < block_count; i++) {
-#if DMA_LLP_NODE_DYNAMIC_ALLOC > 0u
-        p_llp_block = pvPortMalloc(sizeof(dma_block_config_t));
-#else
-        p_llp_block = &s_dma_llp_block[i];
-#endif
-        p_llp_block->src_address = p_src_addr;
-        p_llp_block->dst_address = p_dst_addr;
-        p_llp_block->src_status  = 0x00;
-        p_llp_block->dst_status  = 0x00;
-
-        /* memset in word mode */
-        p_llp_block->CTL_L       = DMA_CTLL_INI_EN
-                                    | DMA_SRC_NO_CHANGE
-                                    | DMA_DST_INCREMENT
-                                    | DMA_SRC_GATHER_DISABLE
-                                    | DMA_DST_SCATTER_ENABLE
-                                    | DMA_LLP_SRC_DISABLE
-                                    | DMA_LLP_DST_ENABLE
-                                    | DMA_MEMORY_TO_MEMORY
-                                    | xfer_width;
-
-        p_llp_block->CTL_H       = block_beat;
-        p_llp_block->p_lli       = NULL;
-
-        if(p_llp_block_prev == NULL) {
-            sg_llp_config.llp_config.head_lli = p_llp_block;
-        } else {
-            p_llp_block_prev->p_lli = p_llp_block;
-        }
-        p_llp_block_prev = p_llp_block;
-
-        p_dst_addr += stride_size;
-    }
-
-    if(block_left > 0) {
-#if DMA_LLP_NODE_DYNAMIC_ALLOC > 0u
-        p_llp_block = pvPortMalloc(sizeof(dma_block_config_t));
-#else
-        p_llp_block = &s_dma_llp_block[i];
-#endif
-        p_llp_block->src_address = p_src_addr;
-        p_llp_block->dst_address = p_dst_addr;
-        p_llp_block->src_status  = 0x00;
-        p_llp_block->dst_status  = 0x00;
-        p_llp_block->CTL_L       = DMA_CTLL_INI_EN
-                                   | DMA_SRC_NO_CHANGE
-                                   | DMA_DST_INCREMENT
-                                   | DMA_SRC_GATHER_DISABLE
-                                   | DMA_DST_SCATTER_ENABLE
-                                   | DMA_LLP_SRC_DISABLE
-                                   | DMA_LLP_DST_ENABLE
-                                   | DMA_MEMORY_TO_MEMORY
-                                   | xfer_width;
-        p_llp_block->CTL_H       = is_word_xfer ? (block_left >> 2) : (block_left >> 1);
-        p_llp_block->p_lli       = NULL;
-
-        if(p_llp_block_prev == NULL) {
-            sg_llp_config.llp_config.head_lli = p_llp_block;
-        } else {
-            p_llp_block_prev->p_lli = p_llp_block;
-        }
-        p_llp_block_prev = p_llp_block;
-    }
-
     s_dma_xfer_flag  = 0x00;
     s_dma_over_flag  = _DMA_FLAG_XFER_DONE | _DMA_FLAG_BLK_DONE;
     status = app_dma_start_sg_llp(s_dma_id, p_src_addr, p_dst_addr, block_beat, &sg_llp_config);
@@ -419,23 +395,6 @@ __attribute__((section("RAM_CODE"))) void lv_dma_memset(uint32_t dst_addr, uint3
     } else {
         printf("dma xfer err :%d!\r\n", status);
     }
-
-#if DMA_LLP_NODE_DYNAMIC_ALLOC > 0u
-    // Free LLP nodes
-    if (sg_llp_config.llp_config.head_lli)
-    {
-        dma_block_config_t * p = sg_llp_config.llp_config.head_lli;
-        dma_block_config_t * q = NULL;
-        while (p)
-        {
-            q = p->p_lli;
-            vPortFree(p);
-            p = q;
-        }
-    }
-#else
-    memset(&s_dma_llp_block[0], 0, (DISP_VER_RES + 1)*sizeof(dma_block_config_t));
-#endif
     return;
 }
 
@@ -518,8 +477,6 @@ __attribute__((section("RAM_CODE")))  bool lv_dma_fill_rect_rgb565_image(_dma_fi
         //by DMA LLP way
         uint32_t p_src_addr        = (uint32_t) src_start_address;
         uint32_t p_dst_addr        = (uint32_t) dst_start_address;
-        dma_block_config_t * p_llp_block      = NULL;
-        dma_block_config_t * p_llp_block_prev = NULL;
         uint32_t xfer_width = 0;
         uint32_t xfer_beat = 0;
 
@@ -531,40 +488,35 @@ __attribute__((section("RAM_CODE")))  bool lv_dma_fill_rect_rgb565_image(_dma_fi
             xfer_beat  = img_fill_cfg->src_img_x_delta;
         }
 
-        for(int i = 0; i < total_lines; i++) {
-#if DMA_LLP_NODE_DYNAMIC_ALLOC > 0u
-            p_llp_block = pvPortMalloc(sizeof(dma_block_config_t));
-#else
-            p_llp_block = &s_dma_llp_block[i];
-#endif
-            p_llp_block->src_address = p_src_addr;
-            p_llp_block->dst_address = p_dst_addr;
-            p_llp_block->src_status  = 0x00;
-            p_llp_block->dst_status  = 0x00;
-
-            /* memset in word mode */
-            p_llp_block->CTL_L       = DMA_CTLL_INI_EN
-                                        | DMA_SRC_INCREMENT
-                                        | DMA_DST_INCREMENT
-                                        | DMA_SRC_GATHER_DISABLE
-                                        | DMA_DST_SCATTER_DISABLE
-                                        | DMA_LLP_SRC_ENABLE
-                                        | DMA_LLP_DST_ENABLE
-                                        | DMA_MEMORY_TO_MEMORY
-                                        | xfer_width;
-
-            p_llp_block->CTL_H       = xfer_beat;
-            p_llp_block->p_lli       = NULL;
-
-            if(p_llp_block_prev == NULL) {
-                sg_llp_config.llp_config.head_lli = p_llp_block;
-            } else {
-                p_llp_block_prev->p_lli = p_llp_block;
+        /* memset in word mode */
+        dma_llp_chain_t chain = {
+            .src_addr    = p_src_addr,
+            .src_step    = img_fill_cfg->src_img_w*img_fill_cfg->pixel_depth,
+            .dst_addr    = p_dst_addr,
+            .dst_step    = img_fill_cfg->dst_buff_width*img_fill_cfg->pixel_depth,
+            .ctl_l       = DMA_CTLL_INI_EN
+                            | DMA_SRC_INCREMENT
+                            | DMA_DST_INCREMENT
+                            | DMA_SRC_GATHER_DISABLE
+                            | DMA_DST_SCATTER_DISABLE
+                            | DMA_LLP_SRC_ENABLE
+                            | DMA_LLP_DST_ENABLE
+                            | DMA_MEMORY_TO_MEMORY
+                            | xfer_width,
+            .block_beat  = xfer_beat,
+            .block_count = total_lines,
+            .tail_beat   = 0,
+        };
+
+        sg_llp_config.llp_config.head_lli = _dma_llp_chain_get(&chain);
+        if(sg_llp_config.llp_config.head_lli == NULL) {
+            // More lines than the LLP pool holds: copy by CPU
+            for(uint32_t i = 0; i < total_lines; i++) {
+                memcpy((void *)p_dst_addr, (void *)p_src_addr, img_fill_cfg->src_img_x_delta*img_fill_cfg->pixel_depth);
+                p_src_addr += chain.src_step;
+                p_dst_addr += chain.dst_step;
             }
-            p_llp_block_prev = p_llp_block;
-
-            p_src_addr += img_fill_cfg->src_img_w*img_fill_cfg->pixel_depth;
-            p_dst_addr += img_fill_cfg->dst_buff_width*img_fill_cfg->pixel_depth;;
+            return true;
         }
 
         s_dma_xfer_flag  = 0x00;
@@ -584,22 +536,6 @@ __attribute__((section("RAM_CODE")))  bool lv_dma_fill_rect_rgb565_image(_dma_fi
             ret = false;
         }
 
-#if DMA_LLP_NODE_DYNAMIC_ALLOC > 0u
-        // Free LLP nodes
-        if (sg_llp_config.llp_config.head_lli)
-        {
-            dma_block_config_t * p = sg_llp_config.llp_config.head_lli;
-            dma_block_config_t * q = NULL;
-            while (p)
-            {
-                q = p->p_lli;
-                vPortFree(p);
-                p = q;
-            }
-        }
-#else
-        memset(&s_dma_llp_block[0], 0, (DISP_VER_RES + 1)*sizeof(dma_block_config_t));
-#endif
         return ret;
     }
 }
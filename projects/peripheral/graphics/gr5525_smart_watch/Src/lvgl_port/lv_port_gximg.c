@@ -31,16 +31,315 @@ typedef struct
     gximg_segment_t *p_segment;
 } gximg_draw_ctx_t;
 
+/*
+ * Where the previous band stopped decoding an image. The next band of the same
+ * frame starts exactly at this line, so it can resume without any lookup.
+ * One entry per image drawn in a band (hour/minute/second hands + spare).
+ */
+#define GXIMG_CURSOR_CACHE_NB   (4u)
+
+typedef struct
+{
+    const lv_gximg_dsc_t *dsc;
+    const uint8_t *data;
+    gximg_segment_t *p_segment;
+    uint32_t used_size;
+    uint16_t y;
+} gximg_cursor_t;
+
 static void gximg_draw_ctx_init(gximg_draw_ctx_t *ctx, const lv_gximg_dsc_t *dsc);
 static const gximg_segment_t *gximg_seek_first_segment(gximg_draw_ctx_t *ctx);
 static const gximg_segment_t *gximg_seek_next_segment(gximg_draw_ctx_t *ctx);
 static const gximg_segment_t *gximg_jump_to_line(gximg_draw_ctx_t *ctx, uint16_t line);
+static void gximg_cursor_save(const gximg_draw_ctx_t *ctx, uint16_t line);
+static const gximg_segment_t *gximg_cursor_resume(gximg_draw_ctx_t *ctx, uint16_t line);
 static uint32_t gximg_calc_segment_data_size(gximg_segment_t *p_segment);
 
 static lv_res_t gximg_decoder_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header);
 static lv_res_t gximg_decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc);
 
 static bool s_gximg_initialized = false;
+static gximg_cursor_t s_gximg_cursor[GXIMG_CURSOR_CACHE_NB];
+static uint8_t s_gximg_cursor_next = 0;
+
+/*
+ * Run kernels. A run is the part of one segment inside the clip area, the
+ * destination is always a line of the RGB565 draw buffer (4-byte aligned rows).
+ */
+#define GXIMG_DMA_MIN_RUN_PX    (128u)
+
+/* Same result as lv_color_mix() with LV_COLOR_MIX_ROUND_OFS == 128: R and B are
+ * processed together in two 16-bit lanes and x/255 is computed exactly (x < 65535)
+ * with shifts, so only 4 multiplications are left per pixel. */
+static inline uint16_t gximg_mix_rgb565(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+    uint32_t inv = 255 - alpha;
+    uint32_t rb = (((fg & 0xF800u) << 5) | (fg & 0x001Fu)) * alpha +
+                  (((bg & 0xF800u) << 5) | (bg & 0x001Fu)) * inv + 0x00800080u;
+    uint32_t g = ((fg >> 5) & 0x3Fu) * alpha + ((bg >> 5) & 0x3Fu) * inv + 0x80u;
+
+    rb = ((rb + ((rb >> 8) & 0x00FF00FFu) + 0x00010001u) >> 8) & 0x00FF00FFu;
+    g = (g + (g >> 8) + 1) >> 8;
+
+    return (uint16_t)(((rb >> 5) & 0xF800u) | (g << 5) | (rb & 0x001Fu));
+}
+
+static inline void gximg_blend_pixel(uint16_t *p_dst, uint16_t pixel, uint8_t alpha)
+{
+    if (alpha == 255)
+    {
+        *p_dst = pixel;
+    }
+    else if (alpha)
+    {
+        *p_dst = gximg_mix_rgb565(pixel, *p_dst, alpha);
+    }
+}
+
+/* dst[i] = src[i] */
+static inline void gximg_copy_run(uint16_t *dst, const uint16_t *src, uint32_t count)
+{
+#if LV_GDX_PATCH_DMA_OPTIM
+    if (count >= GXIMG_DMA_MIN_RUN_PX)
+    {
+        lv_dma_memcpy(dst, (void *)src, count * 2);
+        return;
+    }
+#endif // LV_GDX_PATCH_DMA_OPTIM
+
+    if (((uintptr_t)dst & 2) && count)
+    {
+        *dst++ = *src++;
+        count--;
+    }
+
+    uint32_t *dst32 = (uint32_t *)dst;
+    if (((uintptr_t)src & 2) == 0)
+    {
+        const uint32_t *src32 = (const uint32_t *)src;
+        while (count >= 4)
+        {
+            dst32[0] = src32[0];
+            dst32[1] = src32[1];
+            dst32 += 2;
+            src32 += 2;
+            count -= 4;
+        }
+        if (count >= 2)
+        {
+            *dst32++ = *src32++;
+            count -= 2;
+        }
+        src = (const uint16_t *)src32;
+    }
+    else
+    {
+        // Source is one pixel off: build every word from two aligned loads
+        const uint32_t *src32 = (const uint32_t *)(src - 1);
+        uint32_t cur = *src32++;
+        while (count >= 2)
+        {
+            uint32_t next = *src32++;
+            *dst32++ = (cur >> 16) | (next << 16);
+            cur = next;
+            count -= 2;
+        }
+        src = (const uint16_t *)src32 - 1;
+    }
+
+    if (count)
+    {
+        *(uint16_t *)dst32 = *src;
+    }
+}
+
+/* dst[i] = src[count - 1 - i] */
+static inline void gximg_copy_run_reversed(uint16_t *dst, const uint16_t *src, uint32_t count)
+{
+    const uint16_t *p_src = src + count - 1;
+
+    if (((uintptr_t)dst & 2) && count)
+    {
+        *dst++ = *p_src--;
+        count--;
+    }
+
+    uint32_t *dst32 = (uint32_t *)dst;
+    if (((uintptr_t)(p_src - 1) & 2) == 0)
+    {
+        // Both source pixels in one aligned word, swap the half-words
+        while (count >= 2)
+        {
+            uint32_t w = *(const uint32_t *)(p_src - 1);
+            *dst32++ = (w >> 16) | (w << 16);
+            p_src -= 2;
+            count -= 2;
+        }
+    }
+    else
+    {
+        while (count >= 2)
+        {
+            *dst32++ = p_src[0] | ((uint32_t)p_src[-1] << 16);
+            p_src -= 2;
+            count -= 2;
+        }
+    }
+
+    if (count)
+    {
+        *(uint16_t *)dst32 = *p_src;
+    }
+}
+
+/* dst[i] = mix(src[i], dst[i], alpha[i]), 2 pixels per iteration */
+static inline void gximg_blend_run(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t count)
+{
+    if (((uintptr_t)dst & 2) && count)
+    {
+        gximg_blend_pixel(dst++, *src++, *alpha++);
+        count--;
+    }
+
+    uint32_t *dst32 = (uint32_t *)dst;
+    while (count >= 2)
+    {
+        uint8_t a0 = alpha[0];
+        uint8_t a1 = alpha[1];
+        if ((a0 & a1) == 255)
+        {
+            *dst32 = src[0] | ((uint32_t)src[1] << 16);
+        }
+        else if (a0 | a1)
+        {
+            uint32_t bg = *dst32;
+            *dst32 = gximg_mix_rgb565(src[0], (uint16_t)bg, a0) |
+                     ((uint32_t)gximg_mix_rgb565(src[1], (uint16_t)(bg >> 16), a1) << 16);
+        }
+        dst32++;
+        src += 2;
+        alpha += 2;
+        count -= 2;
+    }
+
+    if (count)
+    {
+        gximg_blend_pixel((uint16_t *)dst32, *src, *alpha);
+    }
+}
+
+/* dst[i] = mix(src[count - 1 - i], dst[i], alpha[count - 1 - i]), 2 pixels per iteration */
+static inline void gximg_blend_run_reversed(uint16_t *dst, const uint16_t *src, const uint8_t *alpha, uint32_t count)
+{
+    const uint16_t *p_src = src + count - 1;
+    const uint8_t *p_alpha = alpha + count - 1;
+
+    if (((uintptr_t)dst & 2) && count)
+    {
+        gximg_blend_pixel(dst++, *p_src--, *p_alpha--);
+        count--;
+    }
+
+    uint32_t *dst32 = (uint32_t *)dst;
+    while (count >= 2)
+    {
+        uint8_t a0 = p_alpha[0];
+        uint8_t a1 = p_alpha[-1];
+        if ((a0 & a1) == 255)
+        {
+            *dst32 = p_src[0] | ((uint32_t)p_src[-1] << 16);
+        }
+        else if (a0 | a1)
+        {
+            uint32_t bg = *dst32;
+            *dst32 = gximg_mix_rgb565(p_src[0], (uint16_t)bg, a0) |
+                     ((uint32_t)gximg_mix_rgb565(p_src[-1], (uint16_t)(bg >> 16), a1) << 16);
+        }
+        dst32++;
+        p_src -= 2;
+        p_alpha -= 2;
+        count -= 2;
+    }
+
+    if (count)
+    {
+        gximg_blend_pixel((uint16_t *)dst32, *p_src, *p_alpha);
+    }
+}
+
+/* dst[i] = color */
+static inline void gximg_fill_run(uint16_t *dst, uint16_t color, uint32_t count)
+{
+    if (((uintptr_t)dst & 2) && count)
+    {
+        *dst++ = color;
+        count--;
+    }
+
+    uint32_t *dst32 = (uint32_t *)dst;
+    uint32_t color32 = color | ((uint32_t)color << 16);
+    while (count >= 2)
+    {
+        *dst32++ = color32;
+        count -= 2;
+    }
+
+    if (count)
+    {
+        *(uint16_t *)dst32 = color;
+    }
+}
+
+/* dst[i] = mix(src[i * step], dst[i], opa), step is 0 for a repeated pixel */
+static inline void gximg_mix_run(uint16_t *dst, const uint16_t *src, uint32_t step, lv_opa_t opa, uint32_t count)
+{
+    while (count--)
+    {
+        *dst = gximg_mix_rgb565(*src, *dst, opa);
+        dst++;
+        src += step;
+    }
+}
+
+/* Decode source pixels [x_min, x_max] of one RLE row to dst[0 .. x_max - x_min] */
+static inline void gximg_rle_decode_row(uint16_t *dst, const uint16_t *p_packet, int32_t x_min, int32_t x_max, lv_opa_t opa)
+{
+    int32_t x = 0;
+
+    while (x <= x_max)
+    {
+        uint16_t packet = *p_packet++;
+        int32_t count = packet & LV_GXIMG_RLE_COUNT_MASK;
+        bool is_run = (packet & LV_GXIMG_RLE_RUN_FLAG) != 0;
+
+        if (x + count > x_min)
+        {
+            int32_t i_first = LV_MAX(x_min - x, 0);
+            int32_t i_last = LV_MIN(x_max - x, count - 1);
+            uint16_t *p_dst = dst + (x + i_first - x_min);
+            uint32_t n = i_last - i_first + 1;
+
+            if (opa >= LV_OPA_MAX)
+            {
+                if (is_run)
+                {
+                    gximg_fill_run(p_dst, *p_packet, n);
+                }
+                else
+                {
+                    gximg_copy_run(p_dst, p_packet + i_first, n);
+                }
+            }
+            else
+            {
+                gximg_mix_run(p_dst, is_run ? p_packet : p_packet + i_first, is_run ? 0 : 1, opa, n);
+            }
+        }
+
+        p_packet += is_run ? 1 : count;
+        x += count;
+    }
+}
 
 void lv_gximg_init(void)
 {
@@ -115,6 +414,7 @@ void lv_port_gximg_draw(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_d
             // if dy is smaller than y_min, means we no longer need draw anymore
             if (dy < y_min)
             {
+                gximg_cursor_save(&ctx, y);
                 break;
             }
 
@@ -138,6 +438,7 @@ void lv_port_gximg_draw(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_d
             // if dy is beyond limitation, end draw
             if (y > y_max)
             {
+                gximg_cursor_save(&ctx, y);
                 break;
             }
 
@@ -145,92 +446,50 @@ void lv_port_gximg_draw(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_d
             dy = y - y_min;
         }
 
-        int16_t start_x = p_seg->start_x;
         uint16_t *p_linestart = (uint16_t *)(dst_addr + (dy * dst_w) * pixelsize);
-        if (p_seg->has_alpha)
+        const uint8_t *alpha_data = p_seg->has_alpha ? (const uint8_t *)(p_seg->seg_data + p_seg->width) : NULL;
+
+        // Intersect the segment with [x_min, x_max] once, then copy the whole run
+        int32_t i_first, i_last;
+        if (flip_x)
         {
-            // This segment has alpha info
-            uint8_t *alpha_data = (uint8_t *)(p_seg->seg_data + p_seg->width);
-            for (uint16_t i = 0; i < p_seg->width; i++)
+            // source pixel i lands on x = w - start_x - i
+            int32_t x_base = gximg_dsc->header.w - p_seg->start_x;
+            i_first = LV_MAX(x_base - (int32_t)x_max, 0);
+            i_last = LV_MIN(x_base - (int32_t)x_min, (int32_t)p_seg->width - 1);
+            if (i_first <= i_last)
             {
-                int16_t dst_x = start_x + i;
-
-                if (flip_x)
+                // Run is stored right to left: its leftmost destination pixel is source i_last
+                uint16_t *p_dst = p_linestart + (x_base - i_last - x_min);
+                uint32_t count = i_last - i_first + 1;
+                if (alpha_data)
                 {
-                    dst_x = gximg_dsc->header.w - dst_x;
-                    if (dst_x > x_max)
-                    {
-                        continue;
-                    }
-                    else if (dst_x < x_min)
-                    {
-                        break;
-                    }
+                    gximg_blend_run_reversed(p_dst, p_seg->seg_data + i_first, alpha_data + i_first, count);
                 }
                 else
                 {
-                    if (dst_x < x_min)
-                    {
-                        continue;
-                    }
-                    else if (dst_x > x_max)
-                    {
-                        break;
-                    }
-                }
-
-                dst_x -= x_min;
-
-                uint16_t pixel = p_seg->seg_data[i];
-                uint8_t alpha = alpha_data[i];
-
-                if (alpha == 255)
-                {
-                    // Opaque, simple copy
-                    p_linestart[dst_x] = pixel;
-                }
-                else
-                {
-                    // Translucent, do alpha blending
-                    lv_color_t src1 = {.full = pixel};
-                    lv_color_t src2 = {.full = p_linestart[dst_x]};
-                    lv_color_t dst = lv_color_mix(src1, src2, alpha);
-                    p_linestart[dst_x] = dst.full;
+                    gximg_copy_run_reversed(p_dst, p_seg->seg_data + i_first, count);
                 }
             }
         }
         else
         {
-            for (uint16_t i = 0; i < p_seg->width; i++)
+            // source pixel i lands on x = start_x + i
+            int32_t x_base = p_seg->start_x;
+            i_first = LV_MAX((int32_t)x_min - x_base, 0);
+            i_last = LV_MIN((int32_t)x_max - x_base, (int32_t)p_seg->width - 1);
+            if (i_first <= i_last)
             {
-                uint16_t dst_x = start_x + i;
-                if (flip_x)
+                uint16_t *p_dst = p_linestart + (x_base + i_first - x_min);
+                uint32_t count = i_last - i_first + 1;
+                if (alpha_data)
                 {
-                    dst_x = gximg_dsc->header.w - dst_x;
-                    if (dst_x > x_max)
-                    {
-                        continue;
-                    }
-                    else if (dst_x < x_min)
-                    {
-                        break;
-                    }
+                    gximg_blend_run(p_dst, p_seg->seg_data + i_first, alpha_data + i_first, count);
                 }
                 else
                 {
-                    if (dst_x < x_min)
-                    {
-                        continue;
-                    }
-                    else if (dst_x > x_max)
-                    {
-                        break;
-                    }
+                    gximg_copy_run(p_dst, p_seg->seg_data + i_first, count);
                 }
-
-                dst_x -= x_min;
-                uint16_t pixel = p_seg->seg_data[i];
-                p_linestart[dst_x] = pixel;
             }
         }
         p_seg = gximg_seek_next_segment(&ctx);
@@ -313,6 +572,58 @@ void lv_port_gximg_draw_bundle(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t
     lv_port_gximg_draw(draw_ctx, draw_dsc, &coords_temp, p_rsc, flip_x, flip_y);
 }
 
+__attribute__((section("RAM_CODE")))
+void lv_port_gximg_draw_rle(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_dsc, const lv_area_t *coords, const void *src)
+{
+    const lv_img_dsc_t *img_dsc = (const lv_img_dsc_t *)src;
+    const uint32_t *row_offset = (const uint32_t *)img_dsc->data;
+    lv_opa_t opa = draw_dsc ? draw_dsc->opa : LV_OPA_COVER;
+    lv_area_t clip;
+
+    if (opa <= LV_OPA_MIN || !_lv_area_intersect(&clip, draw_ctx->clip_area, coords))
+    {
+        return;
+    }
+
+    int32_t x_min = clip.x1 - coords->x1;
+    int32_t x_max = clip.x2 - coords->x1;
+    bool direct = true;
+#if LV_DRAW_COMPLEX
+    direct = !lv_draw_mask_is_any(&clip);
+#endif
+    if (draw_dsc && (draw_dsc->recolor_opa > LV_OPA_MIN || draw_dsc->blend_mode != LV_BLEND_MODE_NORMAL))
+    {
+        direct = false;
+    }
+
+    if (direct)
+    {
+        // Only the rows of this band are decoded, straight into the draw buffer
+        uint16_t dst_w = lv_area_get_width(draw_ctx->buf_area);
+        uint16_t *p_dst = (uint16_t *)draw_ctx->buf + (clip.y1 - draw_ctx->buf_area->y1) * dst_w + (clip.x1 - draw_ctx->buf_area->x1);
+        for (int32_t y = clip.y1; y <= clip.y2; y++)
+        {
+            gximg_rle_decode_row(p_dst, (const uint16_t *)(img_dsc->data + row_offset[y - coords->y1]), x_min, x_max, opa);
+            p_dst += dst_w;
+        }
+        return;
+    }
+
+    // Masked or recolored: decode one row at a time and let the sw renderer blend it
+    uint16_t *p_line = lv_mem_buf_get((x_max - x_min + 1) * sizeof(uint16_t));
+    if (!p_line)
+    {
+        return;
+    }
+    for (int32_t y = clip.y1; y <= clip.y2; y++)
+    {
+        lv_area_t line_area = {clip.x1, y, clip.x2, y};
+        gximg_rle_decode_row(p_line, (const uint16_t *)(img_dsc->data + row_offset[y - coords->y1]), x_min, x_max, LV_OPA_COVER);
+        lv_draw_img_decoded(draw_ctx, draw_dsc, &line_area, (const uint8_t *)p_line, LV_IMG_CF_TRUE_COLOR);
+    }
+    lv_mem_buf_release(p_line);
+}
+
 void lv_port_gximg_set_img_pos(lv_obj_t *img, lv_coord_t center_x, lv_coord_t center_y)
 {
     lv_gximg_bundle_dsc_t *bundle = (lv_gximg_bundle_dsc_t *)lv_img_get_src(img);
@@ -381,19 +692,94 @@ static const gximg_segment_t *gximg_seek_next_segment(gximg_draw_ctx_t *ctx)
 
 static const gximg_segment_t *gximg_jump_to_line(gximg_draw_ctx_t *ctx, uint16_t line)
 {
-    // TODO: mimic one without line table
-    if (ctx->line_table)
+    // Band N+1 usually starts where band N stopped
+    const gximg_segment_t *p_seg = gximg_cursor_resume(ctx, line);
+    if (p_seg)
+    {
+        return p_seg;
+    }
+
+    if (!ctx->line_table)
     {
-        uint8_t *p_data = (uint8_t *)(ctx->line_table + ctx->table_size);
-        for (uint16_t i = 0; i < ctx->table_size; i++)
+        // No line table, walk the segments from the first line
+        uint16_t y = ctx->dsc->start_y;
+        p_seg = gximg_seek_first_segment(ctx);
+        while (p_seg && y < line)
         {
-            if (ctx->line_table[i].y == line)
+            p_seg = gximg_seek_next_segment(ctx);
+            if (p_seg && !p_seg->keep_inline)
             {
-                ctx->p_segment = (gximg_segment_t *)(p_data + ctx->line_table[i].offset);
-                ctx->used_size = ctx->table_size * sizeof(gximg_line_info_t) + ctx->line_table[i].offset + sizeof(gximg_segment_t) + gximg_calc_segment_data_size(ctx->p_segment);
-                return ctx->p_segment;
+                y++;
             }
         }
+        return (p_seg && y == line) ? p_seg : NULL;
+    }
+    else
+    {
+        // y is monotonic in the line table, search the first entry >= line
+        uint32_t lo = 0;
+        uint32_t hi = ctx->table_size;
+        while (lo < hi)
+        {
+            uint32_t mid = (lo + hi) >> 1;
+            if (ctx->line_table[mid].y < line)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        if (lo < ctx->table_size && ctx->line_table[lo].y == line)
+        {
+            uint8_t *p_data = (uint8_t *)(ctx->line_table + ctx->table_size);
+            ctx->p_segment = (gximg_segment_t *)(p_data + ctx->line_table[lo].offset);
+            ctx->used_size = ctx->table_size * sizeof(gximg_line_info_t) + ctx->line_table[lo].offset + sizeof(gximg_segment_t) + gximg_calc_segment_data_size(ctx->p_segment);
+            return ctx->p_segment;
+        }
+    }
+    return NULL;
+}
+
+static void gximg_cursor_save(const gximg_draw_ctx_t *ctx, uint16_t line)
+{
+    gximg_cursor_t *p_cursor = NULL;
+
+    for (uint8_t i = 0; i < GXIMG_CURSOR_CACHE_NB; i++)
+    {
+        if (s_gximg_cursor[i].dsc == ctx->dsc)
+        {
+            p_cursor = &s_gximg_cursor[i];
+            break;
+        }
+    }
+
+    if (!p_cursor)
+    {
+        p_cursor = &s_gximg_cursor[s_gximg_cursor_next];
+        s_gximg_cursor_next = (s_gximg_cursor_next + 1) % GXIMG_CURSOR_CACHE_NB;
+    }
+
+    p_cursor->dsc = ctx->dsc;
+    p_cursor->data = ctx->dsc->data;
+    p_cursor->p_segment = ctx->p_segment;
+    p_cursor->used_size = ctx->used_size;
+    p_cursor->y = line;
+}
+
+static const gximg_segment_t *gximg_cursor_resume(gximg_draw_ctx_t *ctx, uint16_t line)
+{
+    for (uint8_t i = 0; i < GXIMG_CURSOR_CACHE_NB; i++)
+    {
+        gximg_cursor_t *p_cursor = &s_gximg_cursor[i];
+        if (p_cursor->dsc == ctx->dsc && p_cursor->data == ctx->dsc->data && p_cursor->y == line)
+        {
+            ctx->p_segment = p_cursor->p_segment;
+            ctx->used_size = p_cursor->used_size;
+            return ctx->p_segment;
+        }
     }
     return NULL;
 }
@@ -418,6 +804,11 @@ static lv_res_t gximg_decoder_info(lv_img_decoder_t *decoder, const void *src, l
         header->cf = LV_IMG_CF_GDX_GXIMG_BUNDLE;
         return LV_RES_OK;
     }
+    else if (dsc->header.cf == LV_IMG_CF_GDX_RLE_RGB565)
+    {
+        *header = dsc->header;
+        return LV_RES_OK;
+    }
 #endif
     return LV_RES_INV;
 }
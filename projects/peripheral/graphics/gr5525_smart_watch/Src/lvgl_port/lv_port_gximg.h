@@ -25,19 +25,33 @@ typedef struct
     const lv_gximg_dsc_t* group[16];
 } lv_gximg_bundle_dsc_t;
 
+/*
+ * LV_IMG_CF_GDX_RLE_RGB565 uses a plain lv_img_dsc_t, data points to:
+ *      uint32_t row_offset[h]      byte offset of every row from data
+ *      rows of uint16_t packets    bit15 set  : the next pixel is repeated (packet & 0x7FFF) times
+ *                                  bit15 clear: (packet & 0x7FFF) pixels follow
+ * Every row covers exactly w pixels, data_size counts the table and the rows.
+ */
+#define LV_GXIMG_RLE_RUN_FLAG       0x8000u
+#define LV_GXIMG_RLE_COUNT_MASK     0x7FFFu
+
 
 #if LV_GDX_PATCH_GX_IMG
 void lv_gximg_init(void);
 void lv_port_gximg_set_img_pos(lv_obj_t *img, lv_coord_t center_x, lv_coord_t center_y);
 void lv_port_gximg_draw(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_dsc, const lv_area_t *coords, const void *src, bool flip_x, bool flip_y);
 void lv_port_gximg_draw_bundle(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_dsc, const lv_area_t *coords, const void *src);
+void lv_port_gximg_draw_rle(lv_draw_ctx_t *draw_ctx, const lv_draw_img_dsc_t *draw_dsc, const lv_area_t *coords, const void *src);
 #else
 #define LV_IMG_CF_GDX_GXIMG         22
 #define LV_IMG_CF_GDX_GXIMG_BUNDLE  23
+// binary_resources.bin is packed by res_pack.py as LV_IMG_CF_GDX_RLE_RGB565, only decoded with the patch
+#error "LV_IMG_CF_GDX_RLE_RGB565 resources need LV_GDX_PATCH_GX_IMG"
 #define lv_gximg_init(void)
 #define lv_port_gximg_set_img_pos(img, center_x, center_y)
 #define lv_port_gximg_draw(draw_ctx, draw_dsc, coords, src, flip_x, flip_y)
 #define lv_port_gximg_draw_bundle(draw_ctx, draw_dsc, coords, src)
+#define lv_port_gximg_draw_rle(draw_ctx, draw_dsc, coords, src)
 #endif // LV_GDX_PATCH_GX_IMG
 
 #endif // __LV_PORT_GXIMG_H__
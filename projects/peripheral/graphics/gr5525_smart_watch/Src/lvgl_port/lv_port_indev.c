@@ -9,10 +9,22 @@
 /*********************
  *      DEFINES
  *********************/
-/* 
- * TP read point cache number(most for 300ms TP points cache)
-*/
-#define TP_CACHE_NB   (20)
+/*
+ * TP point ring size, power of 2 (most for 570ms TP points cache).
+ * Written by the TP report interrupt only (or lv_indev_read_task() when polling), read by the LVGL indev timer only,
+ * so no lock is needed.
+ */
+#define TP_RING_NB              (32)
+#define TP_RING_MASK            (TP_RING_NB - 1)
+
+/* The point given to LVGL is resampled for the time the frame reaches the panel: read time + lead */
+#define TP_RESAMPLE_LEAD_MS     (8)
+/* Extrapolate at most this long after the newest TP point, the finger may be stopping */
+#define TP_PREDICT_MAX_MS       (LV_INDEV_DEF_READ_PERIOD)
+/* The velocity is measured over the TP points of this last period */
+#define TP_VELOCITY_WINDOW_MS   (60)
+/* Newest pressed TP points kept by the reader for the resampling */
+#define TP_HISTORY_NB           (4)
 
 /**********************
  *      TYPEDEFS
@@ -20,10 +32,18 @@
 
 typedef struct
 {
-    uint32_t x : 12;
-    uint32_t y : 12;
-    uint32_t state : 8;
-} compact_touchpad_data_t;
+    int16_t x;
+    int16_t y;
+    uint32_t timestamp;     // lv_tick_get() when the point was read from the TP
+    uint8_t state;
+} touchpad_sample_t;
+
+typedef struct
+{
+    uint32_t dropped;       // ring full, the LVGL engine not fast enough with the indev speed
+    uint32_t coalesced;     // merged into the resampled point instead of being processed one by one
+    uint32_t max_depth;     // most points waiting in the ring
+} touchpad_stat_t;
 
 /**********************
  *      DECLARATIONS
@@ -37,13 +57,14 @@ static void touchpad_init(void);
 static void touchpad_cache_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data);
 
 lv_indev_t * indev_touchpad;
-static compact_touchpad_data_t s_touchpad_data[TP_CACHE_NB] = {0};
-/* For TP cache points number measurement */
-static volatile int8_t s_touchpad_max_idx = 0;
-static volatile int8_t s_touchpad_save_idx = 0;
-static volatile int8_t s_touchpad_read_idx = 0;
-static lv_coord_t s_latest_x = 0;
-static lv_coord_t s_latest_y = 0;
+static touchpad_sample_t s_touchpad_ring[TP_RING_NB];
+static volatile uint8_t s_touchpad_head = 0;   // written by the producer only
+static volatile uint8_t s_touchpad_tail = 0;   // written by the consumer only
+static touchpad_stat_t s_touchpad_stat = {0};
+/* Reader side */
+static touchpad_sample_t s_touchpad_history[TP_HISTORY_NB];
+static uint8_t s_touchpad_history_idx = 0;
+static uint8_t s_touchpad_history_cnt = 0;
 static lv_indev_state_t s_latest_state = LV_INDEV_STATE_RELEASED;
 
 /**********************
@@ -68,6 +89,26 @@ void lv_port_indev_init(void)
     indev_touchpad = lv_indev_drv_register(&indev_drv);
 }
 
+void lv_port_indev_dump_stats(int (*p_printf)(const char *, ...))
+{
+    if (p_printf == NULL) {
+        p_printf = printf;
+    }
+    p_printf("touchpad: dropped %u, coalesced %u, max depth %u/%u\n",
+             (unsigned)s_touchpad_stat.dropped, (unsigned)s_touchpad_stat.coalesced,
+             (unsigned)s_touchpad_stat.max_depth, (unsigned)TP_RING_NB);
+}
+
+void lv_port_indev_wakeup(void)
+{
+    lv_timer_t * timer = indev_touchpad->driver->read_timer;
+
+    if (timer->paused && s_touchpad_tail != s_touchpad_head) {
+        lv_timer_resume(timer);
+        lv_timer_ready(timer);
+    }
+}
+
 /*------------------
  * Touchpad
  * -----------------*/
@@ -78,63 +119,211 @@ static void touchpad_init(void)
     tp_init();
 }
 
-/*Will be called by the indev task to save the touchpad data*/
-void touchpad_indev_cache(void)
+/*Will be called by the TP report interrupt (or the indev task) to save the touchpad data*/
+void touchpad_indev_push(bool pressed, int16_t x, int16_t y)
 {
-    s_touchpad_max_idx = LV_MAX(s_touchpad_save_idx, s_touchpad_max_idx);
-    if(s_touchpad_save_idx >= (int)TP_CACHE_NB){
+    uint8_t head = s_touchpad_head;
+    uint8_t depth = (uint8_t)(head - s_touchpad_tail);
+
+    s_touchpad_stat.max_depth = LV_MAX(depth, s_touchpad_stat.max_depth);
+    if(depth >= TP_RING_NB){
         /* Discard the point because the LVGL engine not fast enough with the indev speed */
-        // printf("OF. ");
+        s_touchpad_stat.dropped++;
         return;
     }
 
-    lv_coord_t x_point, y_point;
+    touchpad_sample_t * p_sample = &s_touchpad_ring[head & TP_RING_MASK];
     /*Save the pressed coordinates and the state*/
-    if(tp_get_data(&x_point, &y_point)) {
-        s_latest_x = x_point & 0xfffe;
-        s_latest_y = y_point;
-        s_latest_state = LV_INDEV_STATE_PRESSED;
+    if(pressed) {
+        p_sample->x = x & 0xfffe;
+        p_sample->y = y;
+        p_sample->state = LV_INDEV_STATE_PRESSED;
     } else {
-        s_latest_state = LV_INDEV_STATE_RELEASED;
-    }
-
-    /*Set the last pressed coordinates*/
-    // s_touchpad_data[s_touchpad_save_idx].state = s_latest_state;
-    // s_touchpad_data[s_touchpad_save_idx].point.x = s_latest_x;
-    // s_touchpad_data[s_touchpad_save_idx].point.y = s_latest_y;
-    s_touchpad_data[s_touchpad_save_idx].state = s_latest_state;
-    s_touchpad_data[s_touchpad_save_idx].x = s_latest_x;
-    s_touchpad_data[s_touchpad_save_idx].y = s_latest_y;
-    s_touchpad_save_idx++;
-    // printf("idx: %d, [%d.%d] \r\n", s_touchpad_save_idx, s_latest_x, s_latest_y);
+        p_sample->x = 0;
+        p_sample->y = 0;
+        p_sample->state = LV_INDEV_STATE_RELEASED;
+    }
+    p_sample->timestamp = lv_tick_get();
+
+    /* Publish the point only after it is written */
+    __DMB();
+    s_touchpad_head = head + 1;
 }
 
-/*Will be called by the LVGL indev timer to read the touchpad*/
-static void touchpad_cache_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
+/*Will be called by the indev task to poll the touchpad*/
+void touchpad_indev_cache(void)
+{
+    lv_coord_t x_point = 0, y_point = 0;
+    bool pressed = tp_get_data(&x_point, &y_point);
+
+    touchpad_indev_push(pressed, x_point, y_point);
+}
+
+static bool _touchpad_ring_peek(touchpad_sample_t * p_sample)
+{
+    uint8_t tail = s_touchpad_tail;
+    if (tail == s_touchpad_head) {
+        return false;
+    }
+    __DMB();
+    *p_sample = s_touchpad_ring[tail & TP_RING_MASK];
+    return true;
+}
+
+static void _touchpad_ring_pop(void)
+{
+    /* Give the slot back only after it is read */
+    __DMB();
+    s_touchpad_tail = s_touchpad_tail + 1;
+}
+
+static void _touchpad_history_reset(void)
+{
+    s_touchpad_history_idx = 0;
+    s_touchpad_history_cnt = 0;
+}
+
+static void _touchpad_history_push(const touchpad_sample_t * p_sample)
+{
+    s_touchpad_history[s_touchpad_history_idx] = *p_sample;
+    s_touchpad_history_idx = (s_touchpad_history_idx + 1) % TP_HISTORY_NB;
+    if (s_touchpad_history_cnt < TP_HISTORY_NB) {
+        s_touchpad_history_cnt++;
+    }
+}
+
+/* i = 0 is the newest point */
+static const touchpad_sample_t * _touchpad_history_get(uint32_t i)
+{
+    return &s_touchpad_history[(s_touchpad_history_idx + TP_HISTORY_NB - 1 - i) % TP_HISTORY_NB];
+}
+
+/* Velocity of the finger in 1/256 px per ms, false if the stroke is too short to tell */
+static bool _touchpad_velocity(int32_t * p_vx, int32_t * p_vy)
 {
-    /* Use the latest point when there is no cache point */
-    if(s_touchpad_save_idx == 0){
-        data->continue_reading = false;
-        data->state = s_latest_state;
-        data->point.x = s_latest_x;
-        data->point.y = s_latest_y;
+    if (s_touchpad_history_cnt < 2) {
+        return false;
+    }
+    const touchpad_sample_t * p_new = _touchpad_history_get(0);
+    const touchpad_sample_t * p_ref = NULL;
+    for (uint32_t i = 1; i < s_touchpad_history_cnt; i++) {
+        p_ref = _touchpad_history_get(i);
+        if (p_new->timestamp - p_ref->timestamp >= TP_VELOCITY_WINDOW_MS) {
+            break;
+        }
+    }
+    int32_t dt = (int32_t)(p_new->timestamp - p_ref->timestamp);
+    if (dt <= 0) {
+        return false;
+    }
+    *p_vx = ((int32_t)(p_new->x - p_ref->x) * 256) / dt;
+    *p_vy = ((int32_t)(p_new->y - p_ref->y) * 256) / dt;
+    return true;
+}
+
+/* Position of the finger at time t: between 2 points of the history, or extrapolated after the newest one */
+static void _touchpad_resample(uint32_t t, lv_point_t * p_point)
+{
+    const touchpad_sample_t * p_new = _touchpad_history_get(0);
+    int32_t dt = (int32_t)(t - p_new->timestamp);
+
+    p_point->x = p_new->x;
+    p_point->y = p_new->y;
+    if (dt < 0) {
+        for (uint32_t i = 1; i < s_touchpad_history_cnt; i++) {
+            const touchpad_sample_t * p_old = _touchpad_history_get(i);
+            int32_t span = (int32_t)(p_new->timestamp - p_old->timestamp);
+            int32_t pos = (int32_t)(t - p_old->timestamp);
+            if (pos >= 0 && span > 0) {
+                p_point->x = p_old->x + (int32_t)(p_new->x - p_old->x) * pos / span;
+                p_point->y = p_old->y + (int32_t)(p_new->y - p_old->y) * pos / span;
+                return;
+            }
+            p_new = p_old;
+            p_point->x = p_new->x;
+            p_point->y = p_new->y;
+        }
         return;
     }
-    /* Set the last pressed coordinates */
-    // memcpy(data, &s_touchpad_data[s_touchpad_read_idx], sizeof(lv_indev_data_t));
-    data->point.x = s_touchpad_data[s_touchpad_read_idx].x;
-    data->point.y = s_touchpad_data[s_touchpad_read_idx].y;
-    data->state = (lv_indev_state_t)s_touchpad_data[s_touchpad_read_idx].state;
-    s_touchpad_read_idx++;
-    GLOBAL_EXCEPTION_DISABLE();
-    if(s_touchpad_read_idx < s_touchpad_save_idx){
-        data->continue_reading = true;
-    }else{
-        data->continue_reading = false;
-        s_touchpad_save_idx = 0;
-        s_touchpad_read_idx = 0;
-    }
-    GLOBAL_EXCEPTION_ENABLE();
+
+    int32_t vx, vy;
+    if (dt > 0 && _touchpad_velocity(&vx, &vy)) {
+        dt = LV_MIN(dt, TP_PREDICT_MAX_MS);
+        p_point->x += (lv_coord_t)(vx * dt / 256);
+        p_point->y += (lv_coord_t)(vy * dt / 256);
+    }
+}
+
+/*
+ * Will be called by the LVGL indev timer to read the touchpad.
+ * The press and the release are given to LVGL exactly as they were read. The points in between are merged into one,
+ * resampled for the time the frame is shown, so the scroll follows the finger with one step per read.
+ */
+static void touchpad_cache_read(lv_indev_drv_t * indev_drv, lv_indev_data_t * data)
+{
+    touchpad_sample_t sample;
+    uint32_t merged = 0;
+    bool is_transition = false;
+
+    data->continue_reading = false;
+    while (_touchpad_ring_peek(&sample)) {
+        if (sample.state != s_latest_state) {
+            is_transition = true;
+            if (merged > 0) {
+                break;
+            }
+            /* Press or release on its own, exactly where it happened */
+            _touchpad_ring_pop();
+            s_latest_state = (lv_indev_state_t)sample.state;
+            if (s_latest_state == LV_INDEV_STATE_PRESSED) {
+                _touchpad_history_reset();
+                _touchpad_history_push(&sample);
+            }
+            merged = 1;
+            break;
+        }
+        _touchpad_ring_pop();
+        if (sample.state == LV_INDEV_STATE_PRESSED) {
+            _touchpad_history_push(&sample);
+        }
+        merged++;
+    }
+    if (merged > 1) {
+        s_touchpad_stat.coalesced += merged - 1;
+    }
+
+    data->state = s_latest_state;
+    if (s_latest_state == LV_INDEV_STATE_RELEASED && s_touchpad_tail == s_touchpad_head &&
+        indev_touchpad->proc.types.pointer.scroll_obj == NULL) {
+        /* Nothing to track until the next touch (not even a scroll throw), see lv_port_indev_wakeup() */
+        lv_timer_pause(indev_drv->read_timer);
+    }
+    if (s_touchpad_history_cnt == 0) {
+        return; /* never pressed yet */
+    }
+
+    const touchpad_sample_t * p_new = _touchpad_history_get(0);
+    if (s_latest_state == LV_INDEV_STATE_RELEASED || is_transition) {
+        data->point.x = p_new->x;
+        data->point.y = p_new->y;
+        data->continue_reading = is_transition && (s_touchpad_tail != s_touchpad_head);
+    }
+    else {
+        _touchpad_resample(lv_tick_get() + TP_RESAMPLE_LEAD_MS, &data->point);
+        data->point.x = LV_CLAMP(0, data->point.x, lv_disp_get_hor_res(indev_drv->disp) - 1);
+        data->point.y = LV_CLAMP(0, data->point.y, lv_disp_get_ver_res(indev_drv->disp) - 1);
+    }
+
+#if LV_GDX_PATCH_INDEV_THROW_VECT
+    int32_t vx, vy;
+    if (s_latest_state == LV_INDEV_STATE_PRESSED && _touchpad_velocity(&vx, &vy)) {
+        /* scroll_throw_vect is in px per indev read */
+        uint32_t period = indev_drv->read_timer ? indev_drv->read_timer->period : LV_INDEV_DEF_READ_PERIOD;
+        data->throw_vect.x = (lv_coord_t)(vx * (int32_t)period / 256);
+        data->throw_vect.y = (lv_coord_t)(vy * (int32_t)period / 256);
+        data->has_throw_vect = true;
+    }
+#endif
 }
 
 typedef int keep_pedantic_happy;
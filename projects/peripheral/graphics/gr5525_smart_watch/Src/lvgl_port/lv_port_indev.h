@@ -12,8 +12,18 @@ extern "C" {
 
 void lv_port_indev_init(void);
 
+/* Queue a touchpad point, may be called from an interrupt (single producer) */
+void touchpad_indev_push(bool pressed, int16_t x, int16_t y);
+
+/* Poll the touchpad and queue the point */
 void touchpad_indev_cache(void);
 
+/* The indev read timer sleeps while the touchpad is released, call it when the GUI task wakes up */
+void lv_port_indev_wakeup(void);
+
+/* Print the dropped and coalesced touchpad points, p_printf NULL for printf() */
+void lv_port_indev_dump_stats(int (*p_printf)(const char *, ...));
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,372 @@
+#include "render_profiler.h"
+
+#if RENDER_PROFILER_ENABLE
+#include "lvgl.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(LV_HOST_SIM) && LV_HOST_SIM
+#include <time.h>
+#define RP_TICKS_PER_US()               (1000u)
+#else
+#include "gr55xx.h"
+#define RP_TICKS_PER_US()               (SystemCoreClock / 1000000u)
+#endif
+
+#define RP_SUMMARY_CLASS_MAX_CNT        32
+#define RP_NAME_BUF_SIZE                20
+#define RP_TID_RENDER                   1   /* nested zones */
+#define RP_TID_COUNTER                  2   /* per frame sums, they overlap the zones they are part of */
+
+typedef struct
+{
+    uint32_t    ts;             /* start, ticks */
+    uint32_t    dur;            /* ticks */
+    const void *name;           /* lv_obj_class_t for the object zones */
+    uint16_t    zone;
+    uint16_t    arg;
+} rp_event_t;
+
+typedef struct
+{
+    const void *cls;
+    const char *name;
+} rp_class_name_t;
+
+static const char * const ZONE_NAMES[RP_ZONE_MAX] = {
+    "frame", "timers", "render", "layout", "obj", "obj_post", "flush_wait", "glyph", "img",
+};
+
+/* Classes every screen uses, the app_layout ones are resolved from the map file by rprof2trace.py */
+static const rp_class_name_t CLASS_NAMES[] = {
+    { &lv_obj_class,            "lv_obj"            },
+#if LV_USE_LABEL
+    { &lv_label_class,          "lv_label"          },
+#endif
+#if LV_USE_IMG
+    { &lv_img_class,            "lv_img"            },
+#endif
+#if LV_USE_BTN
+    { &lv_btn_class,            "lv_btn"            },
+#endif
+#if LV_GDX_PATCH_USE_FAST_TILEVIEW
+    { &lv_fast_tileview_class,  "lv_fast_tileview"  },
+#endif
+};
+
+static rp_event_t   s_events[RENDER_PROFILER_EVENT_MAX_CNT];
+static uint32_t     s_wr_idx = 0;
+static uint32_t     s_cnt = 0;
+
+/* Frame in progress, the ring position is restored if nothing was drawn */
+static uint32_t     s_frame_start = 0;
+static uint32_t     s_frame_wr_idx = 0;
+static uint32_t     s_frame_cnt = 0;
+static uint32_t     s_frame_objs = 0;
+static uint32_t     s_post_min_ticks = 0;
+static uint32_t     s_acc_ticks[RP_ZONE_MAX];
+static uint32_t     s_acc_cnt[RP_ZONE_MAX];
+
+static void _rp_push(rp_zone_t zone, const void *name, uint32_t ts, uint32_t dur, uint32_t arg)
+{
+    rp_event_t *p_evt = &s_events[s_wr_idx];
+
+    p_evt->ts   = ts;
+    p_evt->dur  = dur;
+    p_evt->name = name;
+    p_evt->zone = (uint16_t)zone;
+    p_evt->arg  = (uint16_t)LV_MIN(arg, 0xFFFFu);
+
+    if (++s_wr_idx == RENDER_PROFILER_EVENT_MAX_CNT)
+    {
+        s_wr_idx = 0;
+    }
+    if (s_cnt < RENDER_PROFILER_EVENT_MAX_CNT)
+    {
+        s_cnt++;
+    }
+}
+
+__attribute__((section("RAM_CODE"))) uint32_t render_profiler_ticks(void)
+{
+#if defined(LV_HOST_SIM) && LV_HOST_SIM
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+void _render_profiler_frame_begin(void)
+{
+#if !(defined(LV_HOST_SIM) && LV_HOST_SIM)
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0)
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+#endif
+
+    s_frame_wr_idx   = s_wr_idx;
+    s_frame_cnt      = s_cnt;
+    s_frame_objs     = 0;
+    s_post_min_ticks = RP_TICKS_PER_US();
+    memset(s_acc_ticks, 0, sizeof(s_acc_ticks));
+    memset(s_acc_cnt, 0, sizeof(s_acc_cnt));
+    s_frame_start    = render_profiler_ticks();
+}
+
+void _render_profiler_frame_end(void)
+{
+    uint32_t now = render_profiler_ticks();
+
+    if (s_frame_objs == 0)
+    {
+        /* Idle poll, forget its timer/layout events */
+        s_wr_idx = s_frame_wr_idx;
+        s_cnt    = s_frame_cnt;
+        return;
+    }
+
+    for (uint32_t zone = RP_ZONE_GLYPH; zone <= RP_ZONE_IMG; zone++)
+    {
+        if (s_acc_cnt[zone])
+        {
+            _rp_push((rp_zone_t)zone, NULL, s_frame_start, s_acc_ticks[zone], s_acc_cnt[zone]);
+        }
+    }
+    _rp_push(RP_ZONE_FRAME, NULL, s_frame_start, now - s_frame_start, s_frame_objs);
+}
+
+__attribute__((section("RAM_CODE"))) void _render_profiler_zone_end(rp_zone_t zone, const void *name, uint32_t start)
+{
+    uint32_t dur = render_profiler_ticks() - start;
+
+    if (zone == RP_ZONE_OBJ_DRAW)
+    {
+        s_frame_objs++;
+    }
+    else if (zone == RP_ZONE_OBJ_POST && dur < s_post_min_ticks)
+    {
+        /* Most classes have nothing to draw after the children, keep the ring for the real work */
+        return;
+    }
+    _rp_push(zone, name, start, dur, 0);
+}
+
+__attribute__((section("RAM_CODE"))) void _render_profiler_count_end(rp_zone_t zone, uint32_t start)
+{
+    s_acc_ticks[zone] += render_profiler_ticks() - start;
+    s_acc_cnt[zone]++;
+}
+
+void render_profiler_clear(void)
+{
+    s_wr_idx       = 0;
+    s_cnt          = 0;
+    s_frame_wr_idx = 0;
+    s_frame_cnt    = 0;
+}
+
+/*
+ * DUMP
+ *****************************************************************************************
+ */
+/* Name of a class, the address for the ones missing in CLASS_NAMES */
+static const char *_rp_class_name(const void *cls, char *buf, uint32_t size)
+{
+    for (uint32_t i = 0; i < sizeof(CLASS_NAMES) / sizeof(CLASS_NAMES[0]); i++)
+    {
+        if (CLASS_NAMES[i].cls == cls)
+        {
+            return CLASS_NAMES[i].name;
+        }
+    }
+    snprintf(buf, size, "cls@0x%08x", (unsigned int)(uintptr_t)cls);
+    return buf;
+}
+
+static const char *_rp_event_name(const rp_event_t *p_evt, char *buf, uint32_t size)
+{
+    if (p_evt->zone != RP_ZONE_OBJ_DRAW && p_evt->zone != RP_ZONE_OBJ_POST)
+    {
+        return ZONE_NAMES[p_evt->zone];
+    }
+    return _rp_class_name(p_evt->name, buf, size);
+}
+
+static const rp_event_t *_rp_event_at(uint32_t i)
+{
+    uint32_t first = (s_cnt < RENDER_PROFILER_EVENT_MAX_CNT) ? 0 : s_wr_idx;
+    return &s_events[(first + i) % RENDER_PROFILER_EVENT_MAX_CNT];
+}
+
+/* Events are stored in end order, a parent starts before its children: walk the signed deltas to unwrap */
+static int64_t _rp_origin(void)
+{
+    int64_t  t = 0;
+    int64_t  t_min = 0;
+    uint32_t last = 0;
+
+    for (uint32_t i = 0; i < s_cnt; i++)
+    {
+        const rp_event_t *p_evt = _rp_event_at(i);
+        t += (i == 0) ? 0 : (int32_t)(p_evt->ts - last);
+        last = p_evt->ts;
+        t_min = LV_MIN(t_min, t);
+    }
+    return t_min;
+}
+
+static void _rp_print_us(int (*p_printf)(const char *, ...), uint64_t ticks, uint32_t tpu)
+{
+    uint64_t us10 = ticks * 10u / tpu;
+    p_printf("%u.%u", (unsigned int)(us10 / 10u), (unsigned int)(us10 % 10u));
+}
+
+static void _rp_dump_raw(int (*p_printf)(const char *, ...), uint32_t tpu)
+{
+    char name[RP_NAME_BUF_SIZE];
+
+    p_printf("#rprof,1,%u,%u\r\n", (unsigned int)tpu, (unsigned int)s_cnt);
+    for (uint32_t i = 0; i < s_cnt; i++)
+    {
+        const rp_event_t *p_evt = _rp_event_at(i);
+        p_printf("%s,%u,%u,%s,%u\r\n", ZONE_NAMES[p_evt->zone], (unsigned int)p_evt->ts, (unsigned int)p_evt->dur,
+                 _rp_event_name(p_evt, name, sizeof(name)), (unsigned int)p_evt->arg);
+    }
+    p_printf("#rprof,end\r\n");
+}
+
+static void _rp_dump_trace(int (*p_printf)(const char *, ...), uint32_t tpu)
+{
+    char     name[RP_NAME_BUF_SIZE];
+    int64_t  t = -_rp_origin();
+    uint32_t last = 0;
+
+    p_printf("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\r\n");
+    p_printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"render\"}},\r\n", RP_TID_RENDER);
+    p_printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"per frame sums\"}}", RP_TID_COUNTER);
+    for (uint32_t i = 0; i < s_cnt; i++)
+    {
+        const rp_event_t *p_evt = _rp_event_at(i);
+        t += (i == 0) ? 0 : (int32_t)(p_evt->ts - last);
+        last = p_evt->ts;
+
+        p_printf(",\r\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":", _rp_event_name(p_evt, name, sizeof(name)), ZONE_NAMES[p_evt->zone],
+                 (p_evt->zone >= RP_ZONE_GLYPH) ? RP_TID_COUNTER : RP_TID_RENDER);
+        _rp_print_us(p_printf, (uint64_t)t, tpu);
+        p_printf(",\"dur\":");
+        _rp_print_us(p_printf, p_evt->dur, tpu);
+        p_printf(",\"args\":{\"n\":%u}}", (unsigned int)p_evt->arg);
+    }
+    p_printf("\r\n]}\r\n");
+}
+
+static void _rp_dump_summary(int (*p_printf)(const char *, ...), uint32_t tpu)
+{
+    uint64_t zone_ticks[RP_ZONE_MAX] = {0};
+    uint32_t zone_cnt[RP_ZONE_MAX] = {0};
+    uint32_t zone_arg[RP_ZONE_MAX] = {0};
+    struct
+    {
+        const void *cls;
+        uint64_t    ticks;
+        uint32_t    cnt;
+    } classes[RP_SUMMARY_CLASS_MAX_CNT];
+    uint32_t class_cnt = 0;
+    char     name[RP_NAME_BUF_SIZE];
+
+    for (uint32_t i = 0; i < s_cnt; i++)
+    {
+        const rp_event_t *p_evt = _rp_event_at(i);
+        zone_ticks[p_evt->zone] += p_evt->dur;
+        zone_cnt[p_evt->zone]++;
+        zone_arg[p_evt->zone] += p_evt->arg;
+
+        if (p_evt->zone != RP_ZONE_OBJ_DRAW && p_evt->zone != RP_ZONE_OBJ_POST)
+        {
+            continue;
+        }
+        uint32_t c = 0;
+        while (c < class_cnt && classes[c].cls != p_evt->name)
+        {
+            c++;
+        }
+        if (c == class_cnt)
+        {
+            if (class_cnt == RP_SUMMARY_CLASS_MAX_CNT)
+            {
+                continue;
+            }
+            classes[c].cls   = p_evt->name;
+            classes[c].ticks = 0;
+            classes[c].cnt   = 0;
+            class_cnt++;
+        }
+        classes[c].ticks += p_evt->dur;
+        classes[c].cnt   += (p_evt->zone == RP_ZONE_OBJ_DRAW) ? 1 : 0;
+    }
+
+    uint32_t frames = LV_MAX(zone_cnt[RP_ZONE_FRAME], 1);
+    p_printf("render profiler: %u frames, %u events\r\n", (unsigned int)zone_cnt[RP_ZONE_FRAME], (unsigned int)s_cnt);
+    p_printf("%-24s %8s %12s %12s\r\n", "zone", "count", "total_us", "per_frame_us");
+    for (uint32_t zone = 0; zone < RP_ZONE_MAX; zone++)
+    {
+        uint32_t cnt = (zone >= RP_ZONE_GLYPH) ? zone_arg[zone] : zone_cnt[zone];
+        p_printf("%-24s %8u %12u %12u\r\n", ZONE_NAMES[zone], (unsigned int)cnt,
+                 (unsigned int)(zone_ticks[zone] / tpu), (unsigned int)(zone_ticks[zone] / tpu / frames));
+    }
+
+    /* Most expensive class first */
+    for (uint32_t i = 1; i < class_cnt; i++)
+    {
+        for (uint32_t j = i; j > 0 && classes[j].ticks > classes[j - 1].ticks; j--)
+        {
+            const void *cls   = classes[j].cls;
+            uint64_t    ticks = classes[j].ticks;
+            uint32_t    cnt   = classes[j].cnt;
+            classes[j]        = classes[j - 1];
+            classes[j - 1].cls   = cls;
+            classes[j - 1].ticks = ticks;
+            classes[j - 1].cnt   = cnt;
+        }
+    }
+    p_printf("%-24s %8s %12s %12s\r\n", "class (main+post)", "count", "total_us", "per_frame_us");
+    for (uint32_t c = 0; c < class_cnt; c++)
+    {
+        p_printf("%-24s %8u %12u %12u\r\n", _rp_class_name(classes[c].cls, name, sizeof(name)),
+                 (unsigned int)classes[c].cnt, (unsigned int)(classes[c].ticks / tpu), (unsigned int)(classes[c].ticks / tpu / frames));
+    }
+}
+
+void render_profiler_dump(int (*p_printf)(const char *, ...), render_profiler_dump_t format)
+{
+    uint32_t tpu = LV_MAX(RP_TICKS_PER_US(), 1u);
+
+    if (p_printf == NULL)
+    {
+        p_printf = printf;
+    }
+
+    switch (format)
+    {
+        case RENDER_PROFILER_DUMP_RAW:
+            _rp_dump_raw(p_printf, tpu);
+            break;
+
+        case RENDER_PROFILER_DUMP_SUMMARY:
+            _rp_dump_summary(p_printf, tpu);
+            break;
+
+        case RENDER_PROFILER_DUMP_TRACE:
+            _rp_dump_trace(p_printf, tpu);
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif // RENDER_PROFILER_ENABLE
@@ -0,0 +1,96 @@
+/**
+ * @brief Frame render profiler.
+ *
+ * Records, for every frame that actually draws something, the time spent in the LVGL timers, the layout
+ * update, each object's draw events (attributed to its class), the glyph renderer, image drawing and the
+ * wait for the display bus. Events are kept in a fixed ring and can be dumped as raw records
+ * (host_sim/tools/rprof2trace.py converts them), a per-class summary or Chrome trace JSON
+ * (chrome://tracing, https://ui.perfetto.dev).
+ *
+ * @param RENDER_PROFILER_ENABLE        0 compiles every hook to nothing, the module has no code and no RAM.
+ * @param RENDER_PROFILER_EVENT_MAX_CNT ring size, the oldest events are overwritten.
+ */
+
+#ifndef __RENDER_PROFILER_H__
+#define __RENDER_PROFILER_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef RENDER_PROFILER_ENABLE
+#define RENDER_PROFILER_ENABLE          0
+#endif
+
+#ifndef RENDER_PROFILER_EVENT_MAX_CNT
+#define RENDER_PROFILER_EVENT_MAX_CNT   1024    /* 16 bytes each */
+#endif
+
+typedef enum
+{
+    RP_ZONE_FRAME = 0,      /* one lv_task_handler() call that drew something, arg = objects drawn */
+    RP_ZONE_TIMERS,         /* lv_timer_handler() */
+    RP_ZONE_RENDER,         /* _lv_disp_refr_timer() */
+    RP_ZONE_LAYOUT,         /* lv_obj_update_layout() of the screens and layers */
+    RP_ZONE_OBJ_DRAW,       /* DRAW_MAIN_BEGIN..DRAW_MAIN_END of one object, name = class */
+    RP_ZONE_OBJ_POST,       /* DRAW_POST_BEGIN..DRAW_POST_END of one object, name = class */
+    RP_ZONE_FLUSH_WAIT,     /* render side blocked on the display bus */
+    RP_ZONE_GLYPH,          /* per frame sum of lv_draw_letter(), arg = letters */
+    RP_ZONE_IMG,            /* per frame sum of lv_draw_img(), arg = images */
+    RP_ZONE_MAX,
+} rp_zone_t;
+
+typedef enum
+{
+    RENDER_PROFILER_DUMP_RAW = 0,   /* one CSV line per event, input of rprof2trace.py */
+    RENDER_PROFILER_DUMP_SUMMARY,   /* per zone and per object class totals */
+    RENDER_PROFILER_DUMP_TRACE,     /* Chrome trace event JSON */
+} render_profiler_dump_t;
+
+#if RENDER_PROFILER_ENABLE
+
+#define render_profiler_frame_begin()               _render_profiler_frame_begin()
+#define render_profiler_frame_end()                 _render_profiler_frame_end()
+#define render_profiler_zone_begin(ts)              uint32_t ts = render_profiler_ticks()
+#define render_profiler_zone_end(zone, name, ts)    _render_profiler_zone_end((zone), (name), (ts))
+#define render_profiler_count_end(zone, ts)         _render_profiler_count_end((zone), (ts))
+
+/**
+ * @brief Free running timestamp: CPU cycles on the device, nanoseconds on the host.
+ */
+uint32_t render_profiler_ticks(void);
+
+/**
+ * @brief Use the macros above, they vanish when RENDER_PROFILER_ENABLE is 0.
+ *        A frame that did not draw any object is dropped at frame end, so the idle polling of
+ *        lv_task_handler() does not fill the ring.
+ */
+void _render_profiler_frame_begin(void);
+void _render_profiler_frame_end(void);
+void _render_profiler_zone_end(rp_zone_t zone, const void *name, uint32_t start);
+void _render_profiler_count_end(rp_zone_t zone, uint32_t start);
+
+/**
+ * @brief Print the recorded frames.
+ * @param p_printf print function, NULL for printf()
+ * @param format   see render_profiler_dump_t
+ */
+void render_profiler_dump(int (*p_printf)(const char *, ...), render_profiler_dump_t format);
+
+/**
+ * @brief Drop every recorded event.
+ */
+void render_profiler_clear(void);
+
+#else
+
+#define render_profiler_frame_begin()
+#define render_profiler_frame_end()
+#define render_profiler_zone_begin(ts)
+#define render_profiler_zone_end(zone, name, ts)
+#define render_profiler_count_end(zone, ts)
+#define render_profiler_dump(p_printf, format)
+#define render_profiler_clear()
+
+#endif // RENDER_PROFILER_ENABLE
+
+#endif // __RENDER_PROFILER_H__
@@ -1,5 +1,13 @@
 #include "system_manager.h"
 #include "app_drv_config.h"
+#include "grx_hal.h"
+#include <stdio.h>
+
+#if defined(LV_HOST_SIM) && LV_HOST_SIM
+#include <time.h>
+#else
+#include "gr55xx.h"
+#endif
 
 #if (APP_DRIVER_CHIP_TYPE == APP_DRIVER_GR5526X) 
 typedef struct
@@ -29,7 +37,6 @@ sys_task_handle_t g_task_handle = {
 };
 
 sys_semphr_handle_t      g_semphr = {
-    .gui_refresh_sem      = NULL,
     .display_sync_sem     = NULL,
     .dma_mem_xfer_sem     = NULL,
 };
@@ -68,8 +75,105 @@ void sys_sem_give(SemaphoreHandle_t sem) {
         if (__get_IPSR())
         {
             xSemaphoreGiveFromISR(sem, &xHigherPriorityTaskWoken);
+            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
         } else {
             xSemaphoreGive(sem);
         }
     }
 }
+
+#define SYS_GUI_CALL_NB     (16)    /* power of 2 */
+
+typedef struct {
+    sys_gui_call_cb_t cb;
+    void *p_arg;
+} sys_gui_call_t;
+
+static sys_gui_call_t s_gui_calls[SYS_GUI_CALL_NB];
+static volatile uint8_t s_gui_call_head = 0;
+static volatile uint8_t s_gui_call_tail = 0;
+static volatile uint32_t s_gui_call_dropped = 0;   /* reported by the GUI task, sys_gui_call() may run in an interrupt */
+
+void sys_gui_wakeup(void) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    if(g_task_handle.gui_handle != NULL) {
+        if (__get_IPSR())
+        {
+            vTaskNotifyGiveFromISR(g_task_handle.gui_handle, &xHigherPriorityTaskWoken);
+            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+        } else {
+            xTaskNotifyGive(g_task_handle.gui_handle);
+        }
+    }
+}
+
+bool sys_gui_call(sys_gui_call_cb_t cb, void *p_arg) {
+    bool full;
+
+    // several producers (BT task, interrupts), one consumer (GUI task)
+    GLOBAL_EXCEPTION_DISABLE();
+    uint8_t head = s_gui_call_head;
+    full = (uint8_t)(head - s_gui_call_tail) >= SYS_GUI_CALL_NB;
+    if(full) {
+        s_gui_call_dropped++;
+    } else {
+        s_gui_calls[head & (SYS_GUI_CALL_NB - 1)].cb = cb;
+        s_gui_calls[head & (SYS_GUI_CALL_NB - 1)].p_arg = p_arg;
+        s_gui_call_head = head + 1;
+    }
+    GLOBAL_EXCEPTION_ENABLE();
+
+    if(full) {
+        return false;
+    }
+    sys_gui_wakeup();
+    return true;
+}
+
+void sys_gui_run_calls(void) {
+    static uint32_t s_dropped_reported = 0;
+    uint32_t dropped = s_gui_call_dropped;
+
+    if(dropped != s_dropped_reported) {
+        printf("sys_gui_call: queue full, %u calls dropped\r\n", (unsigned int)(dropped - s_dropped_reported));
+        s_dropped_reported = dropped;
+    }
+
+    while(s_gui_call_tail != s_gui_call_head) {
+        sys_gui_call_t call;
+
+        GLOBAL_EXCEPTION_DISABLE();
+        call = s_gui_calls[s_gui_call_tail & (SYS_GUI_CALL_NB - 1)];
+        s_gui_call_tail = s_gui_call_tail + 1;
+        GLOBAL_EXCEPTION_ENABLE();
+
+        call.cb(call.p_arg);
+    }
+}
+
+uint32_t sys_timestamp_us(void) {
+#if defined(LV_HOST_SIM) && LV_HOST_SIM
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000u + (uint64_t)now.tv_nsec / 1000u);
+#else
+    static uint32_t s_last_cycles = 0;
+    static uint32_t s_rem_cycles = 0;
+    static uint32_t s_us = 0;
+
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0)
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    // accumulate, the cycle counter alone wraps after ~44 s at 96 MHz and is not a multiple of 1 us
+    uint32_t cycles_per_us = SystemCoreClock / 1000000u;
+    uint32_t now = DWT->CYCCNT;
+    uint32_t cycles = (now - s_last_cycles) + s_rem_cycles;
+    s_last_cycles = now;
+    s_us += cycles / cycles_per_us;
+    s_rem_cycles = cycles % cycles_per_us;
+    return s_us;
+#endif
+}
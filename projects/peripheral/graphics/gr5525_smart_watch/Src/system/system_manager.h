@@ -19,7 +19,6 @@ typedef struct {
 
 
 typedef struct {
-    SemaphoreHandle_t gui_refresh_sem;
     SemaphoreHandle_t display_sync_sem ;    /* used to sync the display-refresh */
     SemaphoreHandle_t dma_mem_xfer_sem;
 } sys_semphr_handle_t;
@@ -46,4 +45,32 @@ void sys_sem_init(SemaphoreHandle_t * sem);
 void sys_sem_take(SemaphoreHandle_t sem, TickType_t xTicksToWait);
 void sys_sem_give(SemaphoreHandle_t sem);
 
+typedef void (*sys_gui_call_cb_t)(void *p_arg);
+
+/**
+ * @brief Wake the GUI task before its next LVGL timer is due (new input, new data to show).
+ *        From a task or an interrupt.
+ */
+void sys_gui_wakeup(void);
+
+/**
+ * @brief Run cb(p_arg) in the GUI task before its next lv_task_handler() and wake it, like lv_async_call()
+ *        but safe from another task or an interrupt.
+ * @return false if the queue is full, cb will not be called. The drops are counted and reported by
+ *         sys_gui_run_calls(), nothing is printed from the caller's context.
+ */
+bool sys_gui_call(sys_gui_call_cb_t cb, void *p_arg);
+
+/**
+ * @brief Run the calls queued by sys_gui_call(), GUI task only. Prints how many calls were dropped
+ *        since the last time, if any.
+ */
+void sys_gui_run_calls(void);
+
+/**
+ * @brief Microsecond timestamp for short measurements, use differences of two calls (it wraps).
+ *        Built on the DWT cycle counter: calls of the GUI task only, at most ~40 s apart.
+ */
+uint32_t sys_timestamp_us(void);
+
 #endif /* __SYSTEM_MANAGER_H__ */
@@ -0,0 +1,612 @@
+/**
+ *****************************************************************************************
+ *
+ * @file watch_bench.c
+ *
+ * @brief Headless frame-time benchmark of the smart watch UI.
+ *
+ * Replays a scripted navigation through layout_router() on top of the real LVGL
+ * port (lv_port_disp.c / lv_port_indev.c / lv_port_gximg.c) and reports, for every
+ * rendered frame, the render time, the number of pixels LVGL redrew and the area
+ * flushed to the (simulated) panel.
+ *
+ * Script syntax, one command per line, '#' starts a comment:
+ *      mark  <label>                   start a new report section
+ *      wait  <ms>                      run the GUI loop for <ms> of virtual time
+ *      frames <n>                      invalidate the screen and render <n> full frames
+ *      swipe <left|right|up|down> [ms] drag across the panel (default 200ms)
+ *      tap   <x> <y>                   press and release at (x, y)
+ *      push  <route>                   lv_fast_tileview_push() a TILEVIEW_MAP_ID_* route
+ *      pop                             lv_fast_tileview_pop()
+ *      shot  <name>                    save the panel to <shots dir>/<name>.ppm
+ *
+ *****************************************************************************************
+ */
+
+/*
+ * INCLUDE FILES
+ *****************************************************************************************
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "lvgl.h"
+#include "lv_port_disp.h"
+#include "lv_port_indev.h"
+#include "lv_layout_router.h"
+#include "task.h"
+#include "host_os.h"
+#include "host_tp.h"
+#include "system_manager.h"
+#include "bsp_tp.h"
+#include "host_disp.h"
+#include "render_profiler.h"
+
+/*
+ * DEFINES
+ *****************************************************************************************
+ */
+#define BENCH_XIP_RES_ADDR          (0x00800000u)       /* BINARY_RESOURCES, see lv_img_dsc_list.h */
+#define BENCH_MAX_LINE_LEN          (256)
+#define BENCH_MAX_SECTIONS          (64)
+#define BENCH_SWIPE_DEFAULT_MS      (200)
+#define BENCH_TAP_HOLD_MS           (60)
+#define BENCH_FRAME_WAIT_MAX_MS     (1000)
+#define BENCH_SWIPE_MARGIN          (60)
+
+extern void lv_layout_startup(void);
+
+/*
+ * TYPEDEFS
+ *****************************************************************************************
+ */
+typedef struct
+{
+    uint32_t tick;              /* virtual time the frame was rendered at */
+    uint32_t section;
+    uint32_t render_us;         /* render_start_cb -> monitor_cb, includes the flushes */
+    uint32_t handler_us;        /* whole lv_task_handler() call that produced the frame */
+    uint32_t px;                /* pixels redrawn by LVGL */
+    uint32_t bands;
+    uint32_t skipped;           /* unchanged bands not sent */
+    uint32_t flush_px;          /* pixels sent to the panel */
+} bench_frame_t;
+
+typedef struct
+{
+    bool     active;
+    uint32_t start_tick;
+    uint32_t duration;
+    int16_t  x0, y0, x1, y1;
+} bench_gesture_t;
+
+typedef struct
+{
+    const char *name;
+    int         map_id;
+} bench_route_t;
+
+/*
+ * LOCAL VARIABLE DEFINITIONS
+ *****************************************************************************************
+ */
+static const bench_route_t s_routes[] = {
+    {"main",            TILEVIEW_MAP_ID_MAIN_SCREEN},
+    {"settings",        TILEVIEW_MAP_ID_SETTINGS},
+    {"app_list",        TILEVIEW_MAP_ID_APP_LIST},
+    {"hr_chart",        TILEVIEW_MAP_ID_HR_CHART},
+    {"ota",             TILEVIEW_MAP_ID_OTA},
+    {"switch_wf",       TILEVIEW_MAP_ID_SWITCH_WF},
+    {"bt_pair_dev",     TILEVIEW_MAP_ID_BT_PAIR_DEV},
+    {"bt_paired_dev",   TILEVIEW_MAP_ID_BT_PAIRED_DEV},
+    {"bt_remove_dev",   TILEVIEW_MAP_ID_BT_REMOVE_DEV},
+    {"bt_manage",       TILEVIEW_MAP_ID_BT_MANAGE},
+    {"bt_device",       TILEVIEW_MAP_ID_BT_DEVICE},
+    {"bt_dial",         TILEVIEW_MAP_ID_BT_DIAL},
+    {"bt_calling",      TILEVIEW_MAP_ID_BT_CALLING},
+    {"bt_music",        TILEVIEW_MAP_ID_BT_MUSIC},
+    {"bt_discovery",    TILEVIEW_MAP_ID_BT_DISCOVERY},
+    {"bt_disconnect",   TILEVIEW_MAP_ID_BT_DISCONNECT},
+    {"bt_no_entry",     TILEVIEW_MAP_ID_BT_NO_ENTRY},
+    {"bt_local_audio",  TILEVIEW_MAP_ID_BT_LOCAL_AUDIO},
+    {"bt_factory_reset",TILEVIEW_MAP_ID_BT_FACTORY_RESET},
+};
+
+static const char      *s_sections[BENCH_MAX_SECTIONS] = {"startup"};
+static uint32_t         s_section_cnt = 1;
+
+static bench_frame_t   *s_frames = NULL;
+static uint32_t         s_frame_cnt = 0;
+static uint32_t         s_frame_cap = 0;
+
+static bench_gesture_t  s_gesture;
+static uint32_t         s_next_indev_tick = 0;
+static uint64_t         s_render_start_ns = 0;
+static host_disp_stats_t s_last_disp_stats;
+
+static void (*s_orig_render_start_cb)(struct _lv_disp_drv_t * disp_drv) = NULL;
+
+static const char      *s_shots_dir = NULL;
+static bool             s_verbose = true;
+static FILE            *s_trace_fp = NULL;
+
+/*
+ * LOCAL FUNCTION DEFINITIONS
+ *****************************************************************************************
+ */
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static bool bench_map_resources(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        printf("ERROR: open %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    struct stat st;
+    fstat(fd, &st);
+
+    void *addr = mmap((void *)(uintptr_t)BENCH_XIP_RES_ADDR, st.st_size, PROT_READ,
+                      MAP_PRIVATE | MAP_FIXED_NOREPLACE, fd, 0);
+    close(fd);
+    if (addr != (void *)(uintptr_t)BENCH_XIP_RES_ADDR)
+    {
+        printf("ERROR: can not map %s at 0x%08x\n", path, BENCH_XIP_RES_ADDR);
+        return false;
+    }
+    return true;
+}
+
+static void bench_render_start_cb(struct _lv_disp_drv_t * disp_drv)
+{
+    s_render_start_ns = bench_now_ns();
+    if (s_orig_render_start_cb)
+    {
+        s_orig_render_start_cb(disp_drv);
+    }
+}
+
+static void bench_monitor_cb(struct _lv_disp_drv_t * disp_drv, uint32_t time, uint32_t px)
+{
+    host_disp_stats_t stats;
+    host_disp_stats_get(&stats);
+
+    if (s_frame_cnt == s_frame_cap)
+    {
+        s_frame_cap = s_frame_cap ? s_frame_cap * 2 : 256;
+        s_frames = realloc(s_frames, s_frame_cap * sizeof(bench_frame_t));
+    }
+
+    bench_frame_t *f = &s_frames[s_frame_cnt++];
+    f->tick       = xTaskGetTickCount();
+    f->section    = s_section_cnt - 1;
+    f->render_us  = (uint32_t)((bench_now_ns() - s_render_start_ns) / 1000);
+    f->handler_us = 0;
+    f->px         = px;
+    f->bands      = stats.bands - s_last_disp_stats.bands;
+    f->skipped    = stats.skipped - s_last_disp_stats.skipped;
+    f->flush_px   = (uint32_t)(stats.flush_px - s_last_disp_stats.flush_px);
+    s_last_disp_stats = stats;
+}
+
+static void bench_update_touch(void)
+{
+    uint32_t now = xTaskGetTickCount();
+
+    if (!s_gesture.active)
+    {
+        host_tp_set(false, 0, 0);
+        return;
+    }
+
+    uint32_t elapsed = now - s_gesture.start_tick;
+    if (elapsed > s_gesture.duration)
+    {
+        s_gesture.active = false;
+        host_tp_set(false, 0, 0);
+        return;
+    }
+
+    int16_t x = s_gesture.x0 + (int32_t)(s_gesture.x1 - s_gesture.x0) * (int32_t)elapsed / (int32_t)s_gesture.duration;
+    int16_t y = s_gesture.y0 + (int32_t)(s_gesture.y1 - s_gesture.y0) * (int32_t)elapsed / (int32_t)s_gesture.duration;
+    host_tp_set(true, x, y);
+}
+
+/* One iteration of gui_schedule_task() interleaved with the TP reports, one per LV_INDEV_DEF_READ_PERIOD */
+static void bench_step(uint32_t end_tick)
+{
+    uint32_t now = xTaskGetTickCount();
+
+    if ((int32_t)(now - s_next_indev_tick) >= 0)
+    {
+        bench_update_touch();
+        s_next_indev_tick = now + LV_INDEV_DEF_READ_PERIOD;
+    }
+    lv_port_indev_wakeup();
+    sys_gui_run_calls();
+
+    uint32_t frames_before = s_frame_cnt;
+    uint64_t t0 = bench_now_ns();
+    uint32_t delay = lv_task_handler();
+    uint32_t handler_us = (uint32_t)((bench_now_ns() - t0) / 1000);
+    for (uint32_t i = frames_before; i < s_frame_cnt; i++)
+    {
+        s_frames[i].handler_us = handler_us;
+    }
+
+    now = xTaskGetTickCount();
+    if ((int32_t)(end_tick - now) <= 0)
+    {
+        return;
+    }
+    uint32_t advance = LV_MIN(delay, s_next_indev_tick - now);
+    advance = LV_MIN(advance, end_tick - now);
+    host_os_tick_advance(LV_MAX(advance, 1));
+}
+
+static void bench_run_for(uint32_t ms)
+{
+    uint32_t end_tick = xTaskGetTickCount() + ms;
+    while ((int32_t)(end_tick - xTaskGetTickCount()) > 0)
+    {
+        bench_step(end_tick);
+    }
+}
+
+static void bench_full_frames(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t target = s_frame_cnt + 1;
+        lv_obj_invalidate(lv_scr_act());
+        for (uint32_t waited = 0; s_frame_cnt < target && waited < BENCH_FRAME_WAIT_MAX_MS; waited++)
+        {
+            bench_step(xTaskGetTickCount() + 1);
+        }
+    }
+}
+
+static void bench_gesture(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t duration)
+{
+    s_gesture.active     = true;
+    s_gesture.start_tick = xTaskGetTickCount();
+    s_gesture.duration   = duration;
+    s_gesture.x0 = x0;
+    s_gesture.y0 = y0;
+    s_gesture.x1 = x1;
+    s_gesture.y1 = y1;
+    /* Run until the release has been sampled by the indev timer */
+    bench_run_for(duration + 2 * LV_INDEV_DEF_READ_PERIOD);
+}
+
+static lv_obj_t * bench_tileview(void)
+{
+    return lv_obj_get_child(lv_scr_act(), 0);
+}
+
+static int bench_route_lookup(const char *name)
+{
+    for (uint32_t i = 0; i < sizeof(s_routes) / sizeof(s_routes[0]); i++)
+    {
+        if (strcmp(s_routes[i].name, name) == 0)
+        {
+            return s_routes[i].map_id;
+        }
+    }
+    return -1;
+}
+
+static bool bench_exec(char *line, uint32_t line_no)
+{
+    char *cmd = strtok(line, " \t\r\n");
+    char *arg1 = strtok(NULL, " \t\r\n");
+    char *arg2 = strtok(NULL, " \t\r\n");
+
+    if (cmd == NULL || cmd[0] == '#')
+    {
+        return true;
+    }
+
+    if (strcmp(cmd, "mark") == 0 && arg1)
+    {
+        if (s_section_cnt < BENCH_MAX_SECTIONS)
+        {
+            s_sections[s_section_cnt++] = strdup(arg1);
+        }
+    }
+    else if (strcmp(cmd, "wait") == 0 && arg1)
+    {
+        bench_run_for(strtoul(arg1, NULL, 0));
+    }
+    else if (strcmp(cmd, "frames") == 0 && arg1)
+    {
+        bench_full_frames(strtoul(arg1, NULL, 0));
+    }
+    else if (strcmp(cmd, "swipe") == 0 && arg1)
+    {
+        const int16_t lo = BENCH_SWIPE_MARGIN;
+        const int16_t hi = DISP_HOR_RES - BENCH_SWIPE_MARGIN;
+        const int16_t mid = DISP_HOR_RES / 2;
+        uint32_t duration = arg2 ? strtoul(arg2, NULL, 0) : BENCH_SWIPE_DEFAULT_MS;
+
+        if (strcmp(arg1, "left") == 0)          bench_gesture(hi, mid, lo, mid, duration);
+        else if (strcmp(arg1, "right") == 0)    bench_gesture(lo, mid, hi, mid, duration);
+        else if (strcmp(arg1, "up") == 0)       bench_gesture(mid, hi, mid, lo, duration);
+        else if (strcmp(arg1, "down") == 0)     bench_gesture(mid, lo, mid, hi, duration);
+        else goto bad_cmd;
+    }
+    else if (strcmp(cmd, "tap") == 0 && arg1 && arg2)
+    {
+        int16_t x = (int16_t)strtol(arg1, NULL, 0);
+        int16_t y = (int16_t)strtol(arg2, NULL, 0);
+        bench_gesture(x, y, x, y, BENCH_TAP_HOLD_MS);
+    }
+    else if (strcmp(cmd, "push") == 0 && arg1)
+    {
+        int map_id = bench_route_lookup(arg1);
+        if (map_id < 0)
+        {
+            goto bad_cmd;
+        }
+        lv_fast_tileview_push(bench_tileview(), map_id, 0, 0);
+    }
+    else if (strcmp(cmd, "pop") == 0)
+    {
+        lv_fast_tileview_pop(bench_tileview());
+    }
+    else if (strcmp(cmd, "shot") == 0 && arg1)
+    {
+        if (s_shots_dir)
+        {
+            char path[BENCH_MAX_LINE_LEN * 2];
+            snprintf(path, sizeof(path), "%s/%s.ppm", s_shots_dir, arg1);
+            if (!host_disp_dump_ppm(path))
+            {
+                printf("ERROR: can not write %s\n", path);
+                return false;
+            }
+        }
+    }
+    else
+    {
+        goto bad_cmd;
+    }
+    return true;
+
+bad_cmd:
+    printf("ERROR: script line %u: bad command \"%s\"\n", line_no, cmd);
+    return false;
+}
+
+static bool bench_run_script(const char *path)
+{
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+    {
+        printf("ERROR: open %s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    char line[BENCH_MAX_LINE_LEN];
+    uint32_t line_no = 0;
+    bool ret = true;
+    while (ret && fgets(line, sizeof(line), fp))
+    {
+        line_no++;
+        ret = bench_exec(line, line_no);
+    }
+    fclose(fp);
+    return ret;
+}
+
+static int bench_cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_report(FILE *csv)
+{
+    if (csv)
+    {
+        fprintf(csv, "frame,section,tick_ms,render_us,handler_us,px,bands,skipped,flush_px\n");
+        for (uint32_t i = 0; i < s_frame_cnt; i++)
+        {
+            bench_frame_t *f = &s_frames[i];
+            fprintf(csv, "%u,%s,%u,%u,%u,%u,%u,%u,%u\n", i, s_sections[f->section], f->tick,
+                    f->render_us, f->handler_us, f->px, f->bands, f->skipped, f->flush_px);
+        }
+    }
+
+    if (s_verbose)
+    {
+        printf("\n%6s %-16s %8s %10s %10s %8s %6s %7s %9s\n",
+               "frame", "section", "tick_ms", "render_us", "handler_us", "px", "bands", "skipped", "flush_px");
+        for (uint32_t i = 0; i < s_frame_cnt; i++)
+        {
+            bench_frame_t *f = &s_frames[i];
+            printf("%6u %-16s %8u %10u %10u %8u %6u %7u %9u\n", i, s_sections[f->section], f->tick,
+                   f->render_us, f->handler_us, f->px, f->bands, f->skipped, f->flush_px);
+        }
+    }
+
+    printf("\n%-16s %6s %10s %10s %10s %10s %10s %10s\n",
+           "section", "frames", "avg_us", "p50_us", "p95_us", "max_us", "avg_px", "avg_flush");
+
+    uint32_t *samples = malloc((s_frame_cnt + 1) * sizeof(uint32_t));
+    for (uint32_t s = 0; s <= s_section_cnt; s++)
+    {
+        /* The last round summarises the whole run */
+        bool total = (s == s_section_cnt);
+        uint32_t n = 0;
+        uint64_t sum_us = 0, sum_px = 0, sum_flush = 0;
+
+        for (uint32_t i = 0; i < s_frame_cnt; i++)
+        {
+            if (!total && s_frames[i].section != s)
+            {
+                continue;
+            }
+            samples[n++] = s_frames[i].render_us;
+            sum_us += s_frames[i].render_us;
+            sum_px += s_frames[i].px;
+            sum_flush += s_frames[i].flush_px;
+        }
+        if (n == 0)
+        {
+            continue;
+        }
+        qsort(samples, n, sizeof(uint32_t), bench_cmp_u32);
+        printf("%-16s %6u %10llu %10u %10u %10u %10llu %10llu\n", total ? "TOTAL" : s_sections[s], n,
+               (unsigned long long)(sum_us / n), samples[n / 2], samples[(n * 95) / 100], samples[n - 1],
+               (unsigned long long)(sum_px / n), (unsigned long long)(sum_flush / n));
+    }
+    free(samples);
+}
+
+static void bench_usage(const char *prog)
+{
+    printf("Usage: %s --resources <binary_resources.bin> --script <file> [--csv <file>] [--shots <dir>] [--trace <file>] [--tile-stats] [--indev-stats] [--quiet]\n", prog);
+}
+
+static int bench_trace_printf(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int len = vfprintf(s_trace_fp, fmt, args);
+    va_end(args);
+    return len;
+}
+
+/* Chrome trace of the script to <path> and the per class summary to stdout, needs a PROFILE=1 build */
+static bool bench_write_trace(const char *path)
+{
+#if RENDER_PROFILER_ENABLE
+    s_trace_fp = fopen(path, "w");
+    if (!s_trace_fp)
+    {
+        printf("ERROR: open %s: %s\n", path, strerror(errno));
+        return false;
+    }
+    render_profiler_dump(bench_trace_printf, RENDER_PROFILER_DUMP_TRACE);
+    fclose(s_trace_fp);
+    s_trace_fp = NULL;
+
+    printf("\n");
+    render_profiler_dump(NULL, RENDER_PROFILER_DUMP_SUMMARY);
+    return true;
+#else
+    printf("ERROR: --trace needs the render profiler, rebuild with 'make clean && make PROFILE=1'\n");
+    return false;
+#endif // RENDER_PROFILER_ENABLE
+}
+
+/*
+ * GLOBAL FUNCTION DEFINITIONS
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+    const char *res_path = NULL;
+    const char *script_path = NULL;
+    const char *csv_path = NULL;
+    const char *trace_path = NULL;
+    bool tile_stats = false;
+    bool indev_stats = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--resources") == 0 && i + 1 < argc)    res_path = argv[++i];
+        else if (strcmp(argv[i], "--script") == 0 && i + 1 < argc)  script_path = argv[++i];
+        else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc)     csv_path = argv[++i];
+        else if (strcmp(argv[i], "--shots") == 0 && i + 1 < argc)   s_shots_dir = argv[++i];
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)   trace_path = argv[++i];
+        else if (strcmp(argv[i], "--tile-stats") == 0)              tile_stats = true;
+        else if (strcmp(argv[i], "--indev-stats") == 0)             indev_stats = true;
+        else if (strcmp(argv[i], "--quiet") == 0)                   s_verbose = false;
+        else
+        {
+            bench_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (!res_path || !script_path)
+    {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    if (!bench_map_resources(res_path))
+    {
+        return 1;
+    }
+
+    lv_init();
+    lv_port_disp_init();
+    lv_port_indev_init();
+    tp_set_report_cb(touchpad_indev_push);
+
+    lv_disp_drv_t *drv = lv_disp_get_default()->driver;
+    s_orig_render_start_cb = drv->render_start_cb;
+    drv->render_start_cb = bench_render_start_cb;
+    drv->monitor_cb = bench_monitor_cb;
+
+    lv_layout_startup();
+    render_profiler_clear();
+
+    if (!bench_run_script(script_path))
+    {
+        return 1;
+    }
+
+    FILE *csv = NULL;
+    if (csv_path)
+    {
+        csv = fopen(csv_path, "w");
+        if (!csv)
+        {
+            printf("ERROR: open %s: %s\n", csv_path, strerror(errno));
+            return 1;
+        }
+    }
+    bench_report(csv);
+    if (csv)
+    {
+        fclose(csv);
+    }
+    if (tile_stats)
+    {
+        printf("\n");
+        lv_fast_tileview_dump_stats(NULL);
+        printf("\n");
+        lv_layout_router_dump_stats(NULL);
+    }
+    if (indev_stats)
+    {
+        printf("\n");
+        lv_port_indev_dump_stats(NULL);
+    }
+    if (trace_path && !bench_write_trace(trace_path))
+    {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+/*
+ * Classic Bluetooth stand-in for the host build. bt_api_impl.c is compiled as
+ * is; every command it queues is dropped here and no indication ever arrives,
+ * so the screens render their "not connected" state.
+ */
+#include "bt_api.h"
+#include "app_bt.h"
+
+bool bt_api_send_command_queue(bt_api_opcode_t opcode, uint16_t length, uint8_t *data)
+{
+    (void)opcode; (void)length; (void)data;
+    return true;
+}
+
+void bt_api_on_msg_arrived(const bt_api_msg_t *msg)
+{
+    (void)msg;
+}
+
+void bt_api_msg_handler(void)
+{
+}
+
+int8_t bt_api_register_indication_callback(bt_api_ind_callback_t callback, bt_api_ind_type_t ind_type)
+{
+    (void)callback; (void)ind_type;
+    return 0;
+}
+
+void bt_api_deregister_indication_callback(bt_api_ind_callback_t callback)
+{
+    (void)callback;
+}
+
+int8_t bt_api_register_response_callback(bt_api_resp_callback_t callback, bt_api_opcode_t resp_type)
+{
+    (void)callback; (void)resp_type;
+    return 0;
+}
+
+void bt_api_deregister_response_callback(bt_api_resp_callback_t callback)
+{
+    (void)callback;
+}
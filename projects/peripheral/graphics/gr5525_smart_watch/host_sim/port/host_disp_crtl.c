@@ -0,0 +1,226 @@
+/*
+ * Memory panel stand-in for display_crtl_drv.c.
+ *
+ * Emulates the AMO139 write window: disp_crtl_set_clip_area() programs the
+ * show area, every flushed band is streamed into it row by row exactly like
+ * the QSPI RAMWR/RAMWRC sequence does on the board.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "lvgl.h"
+#include "display_crtl_drv.h"
+#include "host_disp.h"
+#include "render_profiler.h"
+
+/*
+ * Local variables
+ *****************************************************************************************
+ */
+static uint16_t             s_panel[DISP_VER_RES][DISP_HOR_RES];
+static lv_area_t            s_window = {0, 0, DISP_HOR_RES - 1, DISP_VER_RES - 1};
+static uint32_t             s_cursor = 0;
+static host_disp_stats_t    s_stats;
+static bool                 s_debug_info_enable = true;
+static disp_crtl_pipe_stats_t s_pipe_last;
+static bool                 s_pipe_last_valid = false;
+static uint16_t             s_pipe_bands = 0;
+static uint16_t             s_pipe_skipped = 0;
+
+#if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+static lv_area_t            s_clip_window;
+static lv_coord_t           s_show_next_row = -1;
+#endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+
+volatile bool g_need_te_sync = false;
+
+/*
+ * Local functions
+ *****************************************************************************************
+ */
+static void panel_set_window(const lv_area_t *area)
+{
+    s_window = *area;
+    s_cursor = 0;
+    s_stats.windows++;
+}
+
+static void panel_write(const uint16_t *p_data, uint32_t pixels)
+{
+    uint32_t w = lv_area_get_width(&s_window);
+    uint32_t total = w * lv_area_get_height(&s_window);
+
+    while (pixels-- && s_cursor < total)
+    {
+        int32_t x = s_window.x1 + s_cursor % w;
+        int32_t y = s_window.y1 + s_cursor / w;
+        if (x >= 0 && x < DISP_HOR_RES && y >= 0 && y < DISP_VER_RES)
+        {
+            s_panel[y][x] = *p_data;
+        }
+        p_data++;
+        s_cursor++;
+    }
+}
+
+/*
+ * Global functions
+ *****************************************************************************************
+ */
+void disp_crtl_init(void)
+{
+    memset(s_panel, 0, sizeof(s_panel));
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+void disp_crtl_flush(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp);
+    uint32_t pixels = lv_area_get_size(area);
+
+    if (disp_drv->draw_buf->flushing_last)
+    {
+        s_stats.frames++;
+    }
+
+#if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+    /* Same window rule as display_crtl_drv.c, a band continuing a wrong window shows up in the screenshots */
+    if (!(area->y1 == s_show_next_row && area->x1 == s_window.x1 && area->x2 == s_window.x2 && area->y2 <= s_window.y2))
+    {
+        lv_area_t window = *area;
+        if (area->x1 == s_clip_window.x1 && area->x2 == s_clip_window.x2)
+        {
+            window.y2 = s_clip_window.y2;
+        }
+        panel_set_window(&window);
+    }
+    s_show_next_row = area->y2 + 1;
+    g_need_te_sync = false;
+#else
+    panel_set_window(area);
+#endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+
+    /* The synchronous panel copy takes the place of the bus wait in the profile */
+    render_profiler_zone_begin(rp_wait);
+    panel_write((const uint16_t *)draw_buf->buf_act, pixels);
+    render_profiler_zone_end(RP_ZONE_FLUSH_WAIT, NULL, rp_wait);
+
+    s_stats.bands++;
+    s_stats.flush_px += pixels;
+
+    /* The memory panel is written synchronously: no bus time, nothing to overlap */
+    s_pipe_bands++;
+    if (disp_drv->draw_buf->flushing_last)
+    {
+        memset(&s_pipe_last, 0, sizeof(s_pipe_last));
+        s_pipe_last.bands = s_pipe_bands;
+        s_pipe_last.skipped = s_pipe_skipped;
+        s_pipe_last_valid = true;
+        s_pipe_bands = 0;
+        s_pipe_skipped = 0;
+    }
+
+#if DISP_FLUSH_PIPELINED
+    lv_disp_flush_ready(disp_drv);
+#endif // DISP_FLUSH_PIPELINED
+}
+
+void disp_crtl_set_show(void)
+{
+}
+
+void disp_crtl_skip(lv_disp_drv_t * disp_drv, const lv_area_t * area)
+{
+    if (disp_drv->draw_buf->flushing_last)
+    {
+        s_stats.frames++;
+    }
+
+#if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+    s_show_next_row = -1;
+#endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+
+    s_stats.skipped++;
+    s_pipe_skipped++;
+    if (disp_drv->draw_buf->flushing_last)
+    {
+        memset(&s_pipe_last, 0, sizeof(s_pipe_last));
+        s_pipe_last.bands = s_pipe_bands;
+        s_pipe_last.skipped = s_pipe_skipped;
+        s_pipe_last_valid = true;
+        s_pipe_bands = 0;
+        s_pipe_skipped = 0;
+    }
+}
+
+void disp_crtl_wait(void)
+{
+}
+
+bool disp_crtl_pipe_stats_get(disp_crtl_pipe_stats_t *p_stats)
+{
+    if (!s_pipe_last_valid)
+    {
+        return false;
+    }
+    *p_stats = s_pipe_last;
+    return true;
+}
+
+#if LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+void disp_crtl_set_clip_area(const lv_area_t *clip_area)
+{
+    s_clip_window   = *clip_area;
+    s_show_next_row = -1;
+}
+#endif // LV_GDX_PATCH_SET_CLIP_AREA_ONCE
+
+void lv_port_debug_info_enable(bool enable)
+{
+    s_debug_info_enable = enable;
+}
+
+bool lv_port_debug_info_get(void)
+{
+    return s_debug_info_enable;
+}
+
+void host_disp_stats_get(host_disp_stats_t *p_stats)
+{
+    *p_stats = s_stats;
+}
+
+void host_disp_stats_reset(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+}
+
+const uint16_t *host_disp_framebuffer(void)
+{
+    return &s_panel[0][0];
+}
+
+bool host_disp_dump_ppm(const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp)
+    {
+        return false;
+    }
+
+    fprintf(fp, "P6\n%d %d\n255\n", DISP_HOR_RES, DISP_VER_RES);
+    for (uint32_t y = 0; y < DISP_VER_RES; y++)
+    {
+        for (uint32_t x = 0; x < DISP_HOR_RES; x++)
+        {
+            uint16_t c = s_panel[y][x];
+            uint8_t rgb[3];
+            rgb[0] = ((c >> 11) & 0x1F) * 255 / 31;
+            rgb[1] = ((c >> 5) & 0x3F) * 255 / 63;
+            rgb[2] = (c & 0x1F) * 255 / 31;
+            fwrite(rgb, 1, sizeof(rgb), fp);
+        }
+    }
+    return fclose(fp) == 0;
+}
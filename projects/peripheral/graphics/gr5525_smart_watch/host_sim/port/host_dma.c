@@ -0,0 +1,60 @@
+/*
+ * CPU implementation of lv_port_dma.h for the host build. The framebuffers and
+ * the LVGL heap sit below 4GB (the bench is linked non-PIE), so the 32-bit
+ * addresses used by the DMA API stay valid.
+ */
+#include <string.h>
+#include "lv_port_dma.h"
+
+void lv_dma_init(void)
+{
+}
+
+void * lv_dma_memcpy(void * dst, void * src, uint32_t byte_len)
+{
+    return memcpy(dst, src, byte_len);
+}
+
+void lv_dma_fill_color(uint32_t dst_addr, uint32_t row_pixel, uint32_t stride_pixel, uint32_t col_pixel, uint32_t color)
+{
+    uint16_t * dst = (uint16_t *)(uintptr_t)dst_addr;
+
+    for (uint32_t y = 0; y < col_pixel; y++)
+    {
+        for (uint32_t x = 0; x < row_pixel; x++)
+        {
+            dst[x] = (uint16_t)color;
+        }
+        dst += stride_pixel;
+    }
+}
+
+void lv_dma_memset(uint32_t dst_addr, uint32_t row_pixel, uint32_t stride_pixel, uint32_t col_pixel)
+{
+    uint16_t * dst = (uint16_t *)(uintptr_t)dst_addr;
+
+    for (uint32_t y = 0; y < col_pixel; y++)
+    {
+        memset(dst, 0, row_pixel * 2);
+        dst += stride_pixel;
+    }
+}
+
+bool lv_dma_fill_rect_rgb565_image(_dma_fill_image_config_t * cfg)
+{
+    const uint8_t * src = (const uint8_t *)(uintptr_t)cfg->src_img_address;
+    uint8_t * dst = (uint8_t *)(uintptr_t)cfg->dst_buff_address;
+    uint32_t src_stride = cfg->src_img_w * cfg->pixel_depth;
+    uint32_t dst_stride = cfg->dst_buff_width * cfg->pixel_depth;
+    uint32_t line_bytes = cfg->src_img_x_delta * cfg->pixel_depth;
+
+    src += cfg->src_img_y * src_stride + cfg->src_img_x * cfg->pixel_depth;
+    dst += cfg->dst_buff_y * dst_stride + cfg->dst_buff_x * cfg->pixel_depth;
+    for (uint32_t y = 0; y < cfg->src_img_y_delta; y++)
+    {
+        memcpy(dst, src, line_bytes);
+        src += src_stride;
+        dst += dst_stride;
+    }
+    return true;
+}
@@ -0,0 +1,234 @@
+/*
+ * FreeRTOS / SDK stand-ins for the host build.
+ *
+ * The GUI runs single threaded on the host: the benchmark runner owns the
+ * virtual tick (host_os_tick_advance()), semaphores are plain counters and
+ * vTaskDelay() just moves the virtual clock forward.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "app_rtc.h"
+#include "gr55xx_sys_sdk.h"
+#include "host_os.h"
+#include "flash_driver.h"
+
+/*
+ * Defines
+ *****************************************************************************************
+ */
+#define HOST_HEAP_SIZE_REPORTED         (64 * 1024)
+#define HOST_PSRAM_SIZE                 (1024 * 1024)   /* stand-in for the XIP mapped QSPI PSRAM */
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t max;
+} host_sem_t;
+
+/*
+ * Local variables
+ *****************************************************************************************
+ */
+static volatile TickType_t s_tick_ms = 0;
+
+/*
+ * Global functions
+ *****************************************************************************************
+ */
+void host_os_tick_advance(uint32_t ms)
+{
+    s_tick_ms += ms;
+}
+
+void *pvPortMalloc(size_t size)
+{
+    return malloc(size);
+}
+
+void vPortFree(void *ptr)
+{
+    free(ptr);
+}
+
+size_t xPortGetFreeHeapSize(void)
+{
+    return HOST_HEAP_SIZE_REPORTED;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return s_tick_ms;
+}
+
+TickType_t xTaskGetTickCountFromISR(void)
+{
+    return s_tick_ms;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    s_tick_ms += ticks;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *handle)
+{
+    /* No scheduler on the host, the benchmark runner drives the GUI loop itself */
+    (void)fn; (void)stack; (void)arg; (void)prio;
+    printf("[host] task \"%s\" not started\n", name);
+    if (handle)
+    {
+        *handle = NULL;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t handle)
+{
+    (void)handle;
+}
+
+void vTaskSuspendAll(void)
+{
+}
+
+BaseType_t xTaskResumeAll(void)
+{
+    return pdFALSE;
+}
+
+/* The benchmark runner polls instead of sleeping, notifications only have to link */
+BaseType_t xTaskNotifyGive(TaskHandle_t handle)
+{
+    (void)handle;
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *woken)
+{
+    (void)handle;
+    (void)woken;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    (void)clear_on_exit;
+    (void)ticks;
+    return 0;
+}
+
+static SemaphoreHandle_t host_sem_create(uint32_t initial, uint32_t max)
+{
+    host_sem_t *sem = malloc(sizeof(host_sem_t));
+    sem->count = initial;
+    sem->max = max;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return host_sem_create(0, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return host_sem_create(1, 1);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t ticks)
+{
+    host_sem_t *sem = (host_sem_t *)handle;
+    if (sem->count)
+    {
+        sem->count--;
+        return pdTRUE;
+    }
+    /* Nobody else can give it on the host, waiting would only burn the timeout */
+    if (ticks != portMAX_DELAY)
+    {
+        s_tick_ms += ticks;
+    }
+    return pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t handle)
+{
+    host_sem_t *sem = (host_sem_t *)handle;
+    if (sem->count < sem->max)
+    {
+        sem->count++;
+        return pdTRUE;
+    }
+    return pdFALSE;
+}
+
+BaseType_t xSemaphoreTakeFromISR(SemaphoreHandle_t handle, BaseType_t *woken)
+{
+    if (woken)
+    {
+        *woken = pdFALSE;
+    }
+    return xSemaphoreTake(handle, 0);
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t handle, BaseType_t *woken)
+{
+    if (woken)
+    {
+        *woken = pdFALSE;
+    }
+    return xSemaphoreGive(handle);
+}
+
+uint16_t app_rtc_get_time(app_rtc_time_t *p_time)
+{
+    /* Fixed wall clock so that every run renders the same pixels */
+    uint32_t sec = s_tick_ms / 1000;
+
+    memset(p_time, 0, sizeof(app_rtc_time_t));
+    p_time->year = 23;
+    p_time->mon  = 6;
+    p_time->date = 1;
+    p_time->week = 4;
+    p_time->hour = 10;
+    p_time->min  = 8 + (sec / 60) % 60;
+    p_time->sec  = sec % 60;
+    p_time->ms   = s_tick_ms % 1000;
+    return 0;
+}
+
+void sys_sdk_verison_get(sdk_version_t *p_version)
+{
+    p_version->major = 1;
+    p_version->minor = 0;
+    p_version->build = 0;
+    p_version->commit_id = 0;
+}
+
+void ota_start_task(void)
+{
+}
+
+void ota_abort_task(void)
+{
+}
+
+float ble_ota_progress_get(void)
+{
+    return 0.0f;
+}
+
+void *gx_psram_init(uint32_t *p_size)
+{
+    static void *s_psram = NULL;
+    if (!s_psram)
+    {
+        s_psram = malloc(HOST_PSRAM_SIZE);
+    }
+    *p_size = s_psram ? HOST_PSRAM_SIZE : 0;
+    return s_psram;
+}
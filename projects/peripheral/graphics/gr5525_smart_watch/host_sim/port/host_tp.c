@@ -0,0 +1,62 @@
+/*
+ * Touch panel stand-in: the benchmark runner sets the finger position through
+ * host_tp_set(). Like the TP INT line, every call while touched (and the one
+ * lifting the finger) hands a report to the tp_set_report_cb() callback, and
+ * tp_get_data() still gives the position for polling.
+ */
+#include <stddef.h>
+#include "bsp_tp.h"
+#include "host_tp.h"
+
+static volatile bool    s_pressed = false;
+static volatile int16_t s_x = 0;
+static volatile int16_t s_y = 0;
+static tp_report_cb_t   s_report_cb = NULL;
+
+void host_tp_set(bool pressed, int16_t x, int16_t y)
+{
+    bool was_pressed = s_pressed;
+
+    s_pressed = pressed;
+    s_x = x;
+    s_y = y;
+    if (s_report_cb && (pressed || was_pressed))
+    {
+        s_report_cb(pressed, x, y);
+    }
+}
+
+void tp_set_report_cb(tp_report_cb_t report_cb)
+{
+    s_report_cb = report_cb;
+}
+
+bool tp_read_report_async(void)
+{
+    if (s_report_cb)
+    {
+        s_report_cb(s_pressed, s_x, s_y);
+    }
+    return true;
+}
+
+void tp_init(void)
+{
+    s_pressed = false;
+}
+
+void tp_set_sleep_mode(bool sleep_enable)
+{
+    (void)sleep_enable;
+}
+
+bool tp_get_data(int16_t *p_x, int16_t *p_y)
+{
+    if (!s_pressed)
+    {
+        return false;
+    }
+    *p_x = s_x;
+    *p_y = s_y;
+    return true;
+}
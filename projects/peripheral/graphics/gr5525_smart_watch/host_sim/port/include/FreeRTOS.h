@@ -0,0 +1,41 @@
+#ifndef __HOST_FREERTOS_H__
+#define __HOST_FREERTOS_H__
+
+/*
+ * Minimal FreeRTOS surface for the host build. The GUI runs single threaded on
+ * the host, so semaphores are plain counters and the tick is driven by the
+ * benchmark runner (see host_os.c).
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint32_t    TickType_t;
+typedef long        BaseType_t;
+typedef unsigned long UBaseType_t;
+
+typedef void *      TaskHandle_t;
+typedef void *      SemaphoreHandle_t;
+typedef void *      TimerHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdFALSE                     ((BaseType_t)0)
+#define pdTRUE                      ((BaseType_t)1)
+#define pdPASS                      pdTRUE
+#define pdFAIL                      pdFALSE
+#define portMAX_DELAY               ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS          ((TickType_t)1)
+#define pdMS_TO_TICKS(ms)           ((TickType_t)(ms))
+#define configMAX_PRIORITIES        (8)
+
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+#define portYIELD_FROM_ISR(x)       ((void)(x))
+
+void *pvPortMalloc(size_t size);
+void  vPortFree(void *ptr);
+size_t xPortGetFreeHeapSize(void);
+
+#endif /* __HOST_FREERTOS_H__ */
@@ -0,0 +1,10 @@
+#ifndef __HOST_APP_DMA_H__
+#define __HOST_APP_DMA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Only the types referenced by lv_port_dma.h; the host implementation is CPU based (host_dma.c). */
+typedef int dma_id_t;
+
+#endif /* __HOST_APP_DMA_H__ */
@@ -0,0 +1,10 @@
+#ifndef __HOST_APP_DRV_CONFIG_H__
+#define __HOST_APP_DRV_CONFIG_H__
+
+#include "gr55xx.h"
+
+#define APP_DRIVER_GR5525X          2
+#define APP_DRIVER_GR5526X          3
+#define APP_DRIVER_CHIP_TYPE        APP_DRIVER_GR5525X
+
+#endif /* __HOST_APP_DRV_CONFIG_H__ */
@@ -0,0 +1,10 @@
+#ifndef __HOST_APP_IO_H__
+#define __HOST_APP_IO_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define APP_IO_PIN_3                (1u << 3)
+#define APP_IO_PIN_4                (1u << 4)
+
+#endif /* __HOST_APP_IO_H__ */
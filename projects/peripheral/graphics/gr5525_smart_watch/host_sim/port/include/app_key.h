@@ -0,0 +1,4 @@
+#ifndef __HOST_APP_KEY_H__
+#define __HOST_APP_KEY_H__
+
+#endif /* __HOST_APP_KEY_H__ */
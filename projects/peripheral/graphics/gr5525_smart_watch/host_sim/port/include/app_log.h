@@ -0,0 +1,12 @@
+#ifndef __HOST_APP_LOG_H__
+#define __HOST_APP_LOG_H__
+
+#include <stdio.h>
+
+#define APP_LOG_ERROR(...)          do { printf(__VA_ARGS__); printf("\n"); } while (0)
+#define APP_LOG_WARNING(...)        do { printf(__VA_ARGS__); printf("\n"); } while (0)
+#define APP_LOG_INFO(...)
+#define APP_LOG_DEBUG(...)
+#define APP_LOG_RAW_INFO(...)
+
+#endif /* __HOST_APP_LOG_H__ */
@@ -0,0 +1,25 @@
+#ifndef __HOST_CMSIS_COMPILER_H__
+#define __HOST_CMSIS_COMPILER_H__
+
+#include <stdint.h>
+
+#ifndef __PACKED
+#define __PACKED                    __attribute__((packed, aligned(1)))
+#endif
+#ifndef __PACKED_STRUCT
+#define __PACKED_STRUCT             struct __attribute__((packed, aligned(1)))
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE        __attribute__((always_inline)) static inline
+#endif
+#ifndef __DMB
+#define __DMB()                     __sync_synchronize()
+#endif
+#ifndef __DSB
+#define __DSB()                     __sync_synchronize()
+#endif
+
+/* Thread mode only on the host: no exception is ever active. */
+static inline uint32_t __get_IPSR(void) { return 0; }
+
+#endif /* __HOST_CMSIS_COMPILER_H__ */
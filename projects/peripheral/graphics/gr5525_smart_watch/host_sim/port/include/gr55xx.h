@@ -0,0 +1,6 @@
+#ifndef __HOST_GR55XX_H__
+#define __HOST_GR55XX_H__
+
+#include "cmsis_compiler.h"
+
+#endif /* __HOST_GR55XX_H__ */
@@ -0,0 +1,16 @@
+#ifndef __HOST_GR55XX_SYS_SDK_H__
+#define __HOST_GR55XX_SYS_SDK_H__
+
+#include <stdint.h>
+
+typedef struct
+{
+    uint8_t  major;
+    uint8_t  minor;
+    uint16_t build;
+    uint32_t commit_id;
+} sdk_version_t;
+
+void sys_sdk_verison_get(sdk_version_t *p_version);
+
+#endif /* __HOST_GR55XX_SYS_SDK_H__ */
@@ -0,0 +1,10 @@
+#ifndef __HOST_GRX_HAL_H__
+#define __HOST_GRX_HAL_H__
+
+#include "gr55xx.h"
+
+/* Nothing to mask on the host, but keep the device scope rules: DISABLE opens a brace that ENABLE closes */
+#define GLOBAL_EXCEPTION_DISABLE()  do { uint32_t __l_irq_rest = 0
+#define GLOBAL_EXCEPTION_ENABLE()   (void)__l_irq_rest; } while (0)
+
+#endif /* __HOST_GRX_HAL_H__ */
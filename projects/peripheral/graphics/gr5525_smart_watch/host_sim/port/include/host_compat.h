@@ -0,0 +1,25 @@
+#ifndef __HOST_COMPAT_H__
+#define __HOST_COMPAT_H__
+
+/*
+ * Force-included into every translation unit of the host build.
+ * Maps the armcc/Keil specific keywords used across the project to GCC.
+ */
+
+#ifndef __align
+#define __align(n)                  __attribute__((aligned(n)))
+#endif
+
+#ifndef __weak
+#define __weak                      __attribute__((weak))
+#endif
+
+#ifndef __INLINE
+#define __INLINE                    inline
+#endif
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE             static inline
+#endif
+
+#endif /* __HOST_COMPAT_H__ */
@@ -0,0 +1,26 @@
+#ifndef __HOST_DISP_H__
+#define __HOST_DISP_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Flush statistics, accumulated since the last host_disp_stats_reset() */
+typedef struct
+{
+    uint32_t frames;            /* frames completed (flushing_last seen) */
+    uint32_t bands;             /* disp_crtl_flush() calls */
+    uint32_t skipped;           /* disp_crtl_skip() calls, bands the panel already showed */
+    uint32_t windows;           /* show area (CASET/RASET) updates */
+    uint64_t flush_px;          /* pixels sent to the panel */
+} host_disp_stats_t;
+
+void            host_disp_stats_get(host_disp_stats_t *p_stats);
+void            host_disp_stats_reset(void);
+
+/* RGB565 content of the simulated panel, DISP_HOR_RES x DISP_VER_RES */
+const uint16_t *host_disp_framebuffer(void);
+
+/* Save the panel content as binary PPM, returns false on I/O error */
+bool            host_disp_dump_ppm(const char *path);
+
+#endif /* __HOST_DISP_H__ */
@@ -0,0 +1,9 @@
+#ifndef __HOST_OS_H__
+#define __HOST_OS_H__
+
+#include <stdint.h>
+
+/* Move the virtual FreeRTOS tick (1 tick == 1 ms) forward */
+void host_os_tick_advance(uint32_t ms);
+
+#endif /* __HOST_OS_H__ */
@@ -0,0 +1,10 @@
+#ifndef __HOST_TP_H__
+#define __HOST_TP_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Drive the simulated finger, sampled by tp_get_data() */
+void host_tp_set(bool pressed, int16_t x, int16_t y);
+
+#endif /* __HOST_TP_H__ */
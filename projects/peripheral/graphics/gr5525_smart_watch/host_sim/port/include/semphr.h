@@ -0,0 +1,13 @@
+#ifndef __HOST_SEMPHR_H__
+#define __HOST_SEMPHR_H__
+
+#include "FreeRTOS.h"
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t        xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t        xSemaphoreGive(SemaphoreHandle_t sem);
+BaseType_t        xSemaphoreTakeFromISR(SemaphoreHandle_t sem, BaseType_t *woken);
+BaseType_t        xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken);
+
+#endif /* __HOST_SEMPHR_H__ */
@@ -0,0 +1,17 @@
+#ifndef __HOST_TASK_H__
+#define __HOST_TASK_H__
+
+#include "FreeRTOS.h"
+
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+void       vTaskDelay(TickType_t ticks);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg, UBaseType_t prio, TaskHandle_t *handle);
+void       vTaskDelete(TaskHandle_t handle);
+void       vTaskSuspendAll(void);
+BaseType_t xTaskResumeAll(void);
+BaseType_t xTaskNotifyGive(TaskHandle_t handle);
+void       vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *woken);
+uint32_t   ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+
+#endif /* __HOST_TASK_H__ */
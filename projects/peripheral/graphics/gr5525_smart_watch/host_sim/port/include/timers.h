@@ -0,0 +1,6 @@
+#ifndef __HOST_TIMERS_H__
+#define __HOST_TIMERS_H__
+
+#include "FreeRTOS.h"
+
+#endif /* __HOST_TIMERS_H__ */
@@ -0,0 +1,276 @@
+/*
+ * app_scheduler lanes, first single threaded:
+ *   - events of a lane run in order, the higher lanes first, even when put while executing,
+ *   - a full lane drops with SDK_ERR_NO_RESOURCES, an event larger than a lane is refused with
+ *     SDK_ERR_INVALID_PARAM, the statistics follow,
+ * then with producer threads standing for interrupts (puts under the scheduler lock) while the
+ * main thread executes in batches. Every event carries its producer, sequence number and a
+ * checksum of its data: none may be lost, duplicated, reordered within its lane or corrupted,
+ * and the statistics must add up with the SDK_ERR_NO_RESOURCES returns.
+ *
+ * Usage: app_scheduler_test [--events N]   (events per producer thread)
+ */
+#define _GNU_SOURCE                     /* pthread_tryjoin_np() */
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "app_scheduler.h"
+#include "test_common.h"
+
+/*
+ * Defines
+ *****************************************************************************************
+ */
+#define QUEUE_SIZE                      32u
+#define LANE_SIZE                       (QUEUE_SIZE * APP_SCHEDULER_EVT_AVG_SIZE)
+#define EVT_HEADER_SIZE                 ((sizeof(app_scheduler_evt_info_t) + 3u) & ~3u)    /* 12 bytes on a 64-bit host */
+#define PRODUCER_CNT                    2u
+#define EVENTS_DEFAULT                  1000000u
+#define MSG_BODY_MAX                    60u
+
+typedef struct
+{
+    uint32_t seq;
+    uint8_t  producer;
+    uint8_t  prio;
+    uint8_t  len;
+    uint8_t  sum;
+    uint8_t  body[MSG_BODY_MAX];
+} test_msg_t;
+
+#define MSG_SIZE(len)                   (offsetof(test_msg_t, body) + (len))
+
+/*
+ * Local variables
+ *****************************************************************************************
+ */
+static uint32_t s_events = EVENTS_DEFAULT;
+
+/* Single threaded checks */
+static uint32_t s_order[64];
+static uint32_t s_order_cnt = 0;
+
+/* Threaded checks, the counters of a lane are changed by the consumer or under the lock */
+static uint32_t s_sent[APP_SCHEDULER_PRIO_CNT];
+static uint32_t s_refused[APP_SCHEDULER_PRIO_CNT];
+static uint32_t s_received[APP_SCHEDULER_PRIO_CNT];
+static uint32_t s_last_seq[PRODUCER_CNT][APP_SCHEDULER_PRIO_CNT];
+
+/*
+ * Local functions
+ *****************************************************************************************
+ */
+static void order_handler(void *p_evt_data, uint16_t evt_data_size)
+{
+    uint32_t tag = p_evt_data ? *(uint32_t *)p_evt_data : 0xFFFFFFFFu;
+
+    if (s_order_cnt < sizeof(s_order) / sizeof(s_order[0]))
+    {
+        s_order[s_order_cnt++] = tag;
+    }
+
+    // a high lane event put by a low lane handler runs before the rest of the low lane
+    if (tag == 0x201)
+    {
+        uint32_t urgent = 0x0FF;
+        app_scheduler_evt_put_prio(APP_SCHEDULER_PRIO_HIGH, &urgent, sizeof(urgent), order_handler);
+    }
+}
+
+static void put_tag(app_scheduler_prio_t prio, uint32_t tag)
+{
+    TEST_CHECK(app_scheduler_evt_put_prio(prio, &tag, sizeof(tag), order_handler) == SDK_SUCCESS,
+               "put of %x refused", tag);
+}
+
+static void single_thread_test(void)
+{
+    static const uint32_t expected[] = {0x000, 0x001, 0x100, 0x101, 0x200, 0x201, 0x0FF, 0x202};
+    app_scheduler_stat_t  stat;
+    static uint8_t        big[LANE_SIZE];
+
+    // order: lanes from high to low, FIFO within a lane
+    put_tag(APP_SCHEDULER_PRIO_LOW, 0x200);
+    put_tag(APP_SCHEDULER_PRIO_NORMAL, 0x100);
+    put_tag(APP_SCHEDULER_PRIO_HIGH, 0x000);
+    put_tag(APP_SCHEDULER_PRIO_LOW, 0x201);
+    put_tag(APP_SCHEDULER_PRIO_NORMAL, 0x101);
+    put_tag(APP_SCHEDULER_PRIO_HIGH, 0x001);
+    put_tag(APP_SCHEDULER_PRIO_LOW, 0x202);
+    TEST_CHECK(app_scheduler_execute_batch(5) == 5, "batch of 5 events");
+    app_scheduler_execute();
+    TEST_CHECK(s_order_cnt == sizeof(expected) / sizeof(expected[0]), "%u events executed", s_order_cnt);
+    for (uint32_t i = 0; i < s_order_cnt && i < sizeof(expected) / sizeof(expected[0]); i++)
+    {
+        TEST_CHECK(s_order[i] == expected[i], "event %u is %x, %x expected", i, s_order[i], expected[i]);
+    }
+
+    // size limit: the event header and the data must fit a lane
+    TEST_CHECK(app_scheduler_evt_put(big, LANE_SIZE - EVT_HEADER_SIZE, order_handler) == SDK_SUCCESS,
+               "largest event refused");
+    TEST_CHECK(app_scheduler_evt_put(big, LANE_SIZE - EVT_HEADER_SIZE + 1, order_handler) == SDK_ERR_INVALID_PARAM,
+               "event larger than a lane accepted");
+    TEST_CHECK(app_scheduler_evt_put(big, 4, order_handler) == SDK_ERR_NO_RESOURCES, "put into a full lane");
+    app_scheduler_stat_get(APP_SCHEDULER_PRIO_NORMAL, &stat);
+    TEST_CHECK(stat.size == LANE_SIZE && stat.used == LANE_SIZE && stat.evt_cnt == 1 && stat.dropped == 1,
+               "full lane stat: size %u used %u evt_cnt %u dropped %u", stat.size, stat.used, stat.evt_cnt, stat.dropped);
+    app_scheduler_execute();
+
+    // a lane holds queue_size events of APP_SCHEDULER_EVT_AVG_SIZE bytes
+    uint32_t put_cnt = 0;
+    while (app_scheduler_evt_put(big, APP_SCHEDULER_EVT_AVG_SIZE - EVT_HEADER_SIZE, NULL) == SDK_SUCCESS)
+    {
+        put_cnt++;
+    }
+    TEST_CHECK(put_cnt == QUEUE_SIZE, "%u average events in a lane", put_cnt);
+    app_scheduler_execute();
+    app_scheduler_stat_get(APP_SCHEDULER_PRIO_NORMAL, &stat);
+    TEST_CHECK(stat.used == 0 && stat.evt_cnt == 0 && stat.evt_cnt_max == QUEUE_SIZE,
+               "empty lane stat: used %u evt_cnt %u evt_cnt_max %u", stat.used, stat.evt_cnt, stat.evt_cnt_max);
+}
+
+static void msg_handler(void *p_evt_data, uint16_t evt_data_size)
+{
+    test_msg_t *p_msg = (test_msg_t *)p_evt_data;
+    uint8_t     sum = 0;
+
+    TEST_CHECK(p_msg && ((uintptr_t)p_msg & 3) == 0, "event data %p not aligned", p_evt_data);
+    if (!p_msg || evt_data_size != MSG_SIZE(p_msg->len) || p_msg->producer >= PRODUCER_CNT ||
+        p_msg->prio >= APP_SCHEDULER_PRIO_CNT)
+    {
+        TEST_CHECK(false, "bad event of %u bytes", evt_data_size);
+        return;
+    }
+    for (uint32_t i = 0; i < p_msg->len; i++)
+    {
+        sum += p_msg->body[i];
+    }
+    TEST_CHECK(sum == p_msg->sum, "event %u of producer %u: bad data", p_msg->seq, p_msg->producer);
+    TEST_CHECK(p_msg->seq > s_last_seq[p_msg->producer][p_msg->prio], "event %u of producer %u after %u",
+               p_msg->seq, p_msg->producer, s_last_seq[p_msg->producer][p_msg->prio]);
+    s_last_seq[p_msg->producer][p_msg->prio] = p_msg->seq;
+    s_received[p_msg->prio]++;
+}
+
+static void *producer_thread(void *p_arg)
+{
+    uint32_t   producer = (uint32_t)(uintptr_t)p_arg;
+    uint32_t   rand_state = producer * 7919u + 1u;
+    uint32_t   seq[APP_SCHEDULER_PRIO_CNT] = {0};
+    test_msg_t msg;
+
+    for (uint32_t k = 0; k < s_events; k++)
+    {
+        uint32_t r = test_rand_r(&rand_state);
+
+        msg.producer = (uint8_t)producer;
+        msg.prio = (uint8_t)(r % APP_SCHEDULER_PRIO_CNT);
+        msg.len = (uint8_t)((r >> 4) % (MSG_BODY_MAX + 1));
+        msg.seq = ++seq[msg.prio];
+        msg.sum = 0;
+        for (uint32_t i = 0; i < msg.len; i++)
+        {
+            msg.body[i] = (uint8_t)(r >> (i % 24));
+            msg.sum += msg.body[i];
+        }
+
+        sdk_err_t ret = app_scheduler_evt_put_prio(msg.prio, &msg, MSG_SIZE(msg.len), msg_handler);
+
+        test_irq_lock();
+        s_sent[msg.prio]++;
+        s_refused[msg.prio] += (ret == SDK_ERR_NO_RESOURCES);
+        test_irq_unlock();
+        TEST_CHECK(ret == SDK_SUCCESS || ret == SDK_ERR_NO_RESOURCES, "put returned %u", ret);
+
+        if ((k & 255) == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static void thread_test(void)
+{
+    pthread_t            threads[PRODUCER_CNT];
+    bool                 joined[PRODUCER_CNT] = {false};
+    uint32_t             alive = PRODUCER_CNT;
+    uint32_t             rand_state = 5;
+    app_scheduler_stat_t stat;
+    uint32_t             dropped_before[APP_SCHEDULER_PRIO_CNT];
+    double               start = test_time_s();
+
+    for (uint32_t prio = 0; prio < APP_SCHEDULER_PRIO_CNT; prio++)
+    {
+        app_scheduler_stat_get((app_scheduler_prio_t)prio, &stat);
+        dropped_before[prio] = stat.dropped;
+    }
+
+    for (uint32_t i = 0; i < PRODUCER_CNT; i++)
+    {
+        pthread_create(&threads[i], NULL, producer_thread, (void *)(uintptr_t)i);
+    }
+
+    while (alive)
+    {
+        if (app_scheduler_execute_batch(1 + test_rand_r(&rand_state) % 8) == 0)
+        {
+            sched_yield();
+        }
+        for (uint32_t i = 0; i < PRODUCER_CNT; i++)
+        {
+            if (!joined[i] && pthread_tryjoin_np(threads[i], NULL) == 0)
+            {
+                joined[i] = true;
+                alive--;
+            }
+        }
+    }
+    app_scheduler_execute();
+
+    double elapsed = test_time_s() - start;
+
+    for (uint32_t prio = 0; prio < APP_SCHEDULER_PRIO_CNT; prio++)
+    {
+        app_scheduler_stat_get((app_scheduler_prio_t)prio, &stat);
+        printf("lane %u: sent %u, refused %u, received %u | used_max %u/%u, evt_cnt_max %u, dropped %u\n",
+               prio, s_sent[prio], s_refused[prio], s_received[prio], stat.used_max, stat.size,
+               stat.evt_cnt_max, stat.dropped - dropped_before[prio]);
+        TEST_CHECK(s_sent[prio] == s_refused[prio] + s_received[prio], "lane %u: events lost", prio);
+        TEST_CHECK(stat.used == 0 && stat.evt_cnt == 0, "lane %u not empty", prio);
+        TEST_CHECK(stat.dropped - dropped_before[prio] == s_refused[prio], "lane %u: %u dropped, %u refused", prio,
+                   stat.dropped - dropped_before[prio], s_refused[prio]);
+    }
+    printf("%u events in %.2f s\n", PRODUCER_CNT * s_events, elapsed);
+}
+
+/*
+ * Global functions
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--events") && i + 1 < argc)
+        {
+            s_events = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--events N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    TEST_CHECK(app_scheduler_init(0) == SDK_ERR_INVALID_PARAM, "queue_size 0 accepted");
+    TEST_CHECK(app_scheduler_init(QUEUE_SIZE) == SDK_SUCCESS, "init failed");
+
+    single_thread_test();
+    thread_test();
+
+    return test_report("app_scheduler");
+}
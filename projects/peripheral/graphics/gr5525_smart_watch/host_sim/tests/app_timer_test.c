@@ -0,0 +1,358 @@
+/*
+ * app_timer on a modelled sleep timer, built once with the sorted list and once with the timing
+ * wheel (APP_TIMER_WHEEL_ENABLE). Random starts and stops, from the main loop and from the timer
+ * callbacks, are checked against a reference model:
+ *   - a timer fires only when it is running, at the deadline it was given by its last start,
+ *   - timers fire in deadline order,
+ *   - no running timer is left behind once a later deadline has fired.
+ * With --trace, every start and expiry is written out. The start time of a timer is rounded
+ * differently when it is started from a callback of an expiry that fired several timers: the list
+ * fires them one sleep timer interrupt after the other, the wheel in one go. With --defer, the
+ * callbacks leave their starts and stops to the main loop, and the list and the wheel builds must
+ * give the same trace (make test-app_timer compares them).
+ *
+ * Usage: app_timer_<list|wheel>_test [--ops N] [--timers N] [--long] [--defer] [--trace <file>]
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "app_timer.h"
+#include "grx_hal.h"
+#include "test_common.h"
+
+/*
+ * Defines
+ *****************************************************************************************
+ */
+#define SLP_TIMER_FREQ_HZ               32768u
+#define TIMER_CNT_MAX                   4096u
+#define OPS_DEFAULT                     200000u
+#define TIMERS_DEFAULT                  2000u
+#define DEFERRED_CNT_MAX                65536u
+
+typedef struct
+{
+    bool     armed;
+    uint64_t deadline_us;
+} ref_timer_t;
+
+/*
+ * Local variables
+ *****************************************************************************************
+ */
+/* Sleep timer model, in sleep timer ticks */
+static uint64_t s_now_tick = 0;
+static uint64_t s_expire_tick = 0;
+static bool     s_slp_running = false;
+
+static app_timer_t s_timers[TIMER_CNT_MAX];
+static ref_timer_t s_ref[TIMER_CNT_MAX];
+static uint32_t    s_timer_cnt = TIMERS_DEFAULT;
+static uint64_t    s_last_deadline_us = 0;
+static bool        s_draining = false;
+static bool        s_defer = false;
+static uint32_t    s_deferred[DEFERRED_CNT_MAX];
+static uint32_t    s_deferred_cnt = 0;
+static FILE       *s_p_trace = NULL;
+
+static uint64_t s_fired_cnt = 0;
+static uint64_t s_start_cnt = 0;
+static uint64_t s_stop_cnt = 0;
+
+/*
+ * Sleep timer stand-ins
+ *****************************************************************************************
+ */
+uint32_t hal_sleep_timer_get_clock_freq(void)
+{
+    return SLP_TIMER_FREQ_HZ;
+}
+
+void hal_sleep_timer_config_and_start(uint8_t mode, uint32_t value)
+{
+    (void)mode;
+    s_expire_tick = s_now_tick + value;
+    s_slp_running = true;
+}
+
+uint32_t hal_sleep_timer_status_get(void)
+{
+    return s_slp_running;
+}
+
+uint32_t hal_sleep_timer_get_current_value(void)
+{
+    return s_slp_running ? (uint32_t)(s_expire_tick - s_now_tick) : 0xFFFFFFFFu;
+}
+
+void hal_sleep_timer_stop(void)
+{
+    s_slp_running = false;
+}
+
+void hal_pwr_sleep_timer_irq_handler(void)
+{
+    s_slp_running = false;
+    hal_pwr_sleep_timer_elapsed_callback();
+}
+
+void delay_us(uint32_t us)
+{
+    (void)us;
+}
+
+void delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/*
+ * Local functions
+ *****************************************************************************************
+ */
+/* Mostly short timers, some up to the longest delay app_timer accepts (36 hours) */
+static uint32_t delay_ms_rand(void)
+{
+    uint32_t r = test_rand() % 100;
+
+    if (r < 60)
+    {
+        return 1 + test_rand() % 200;
+    }
+    if (r < 90)
+    {
+        return 1 + test_rand() % 5000;
+    }
+    if (r < 99)
+    {
+        return 1 + test_rand() % 600000;
+    }
+    return 1 + test_rand() % (36u * 3600u * 1000u);
+}
+
+static void timer_start(uint32_t id)
+{
+    if (app_timer_start_api(&s_timers[id], delay_ms_rand(), (void *)(uintptr_t)id) == SDK_SUCCESS)
+    {
+        s_start_cnt++;
+        s_ref[id].armed = true;
+        // app_timer time (us), only moved on when the sleep timer is read
+        s_ref[id].deadline_us = s_timers[id].next_shot_time;
+        if (s_p_trace)
+        {
+            fprintf(s_p_trace, "S %llu %u %llu\n", (unsigned long long)s_now_tick, id, (unsigned long long)s_ref[id].deadline_us);
+        }
+    }
+}
+
+static void timer_stop(uint32_t id)
+{
+    app_timer_stop_api(&s_timers[id]);
+    s_stop_cnt++;
+    s_ref[id].armed = false;
+}
+
+static void missed_check(void)
+{
+    for (uint32_t id = 0; id < s_timer_cnt; id++)
+    {
+        if (s_ref[id].armed && s_ref[id].deadline_us < s_last_deadline_us)
+        {
+            TEST_CHECK(false, "timer %u of %llu us not fired, a timer of %llu us did", id,
+                       (unsigned long long)s_ref[id].deadline_us, (unsigned long long)s_last_deadline_us);
+            s_ref[id].armed = false;
+        }
+    }
+}
+
+/* What a callback does: start itself again, or stop or start another timer */
+static void callback_action(uint32_t id)
+{
+    uint32_t r = test_rand() % 10;
+
+    if (r < 3)
+    {
+        timer_start(id);
+    }
+    else if (r < 4)
+    {
+        timer_stop(test_rand() % s_timer_cnt);
+    }
+    else if (r < 5)
+    {
+        timer_start(test_rand() % s_timer_cnt);
+    }
+}
+
+static void timer_callback(void *p_ctx)
+{
+    uint32_t     id = (uint32_t)(uintptr_t)p_ctx;
+    app_timer_t *p_timer = &s_timers[id];
+    bool         repeat = (p_timer->timer_node_mode == ATIMER_REPEAT);
+    // a repeated timer is already restarted when its callback runs
+    uint64_t     deadline_us = repeat ? p_timer->next_shot_time - p_timer->original_delay : p_timer->next_shot_time;
+
+    s_fired_cnt++;
+    TEST_CHECK(s_ref[id].armed, "timer %u fired while stopped", id);
+    TEST_CHECK(deadline_us == s_ref[id].deadline_us, "timer %u fired for %llu us, started for %llu us", id,
+               (unsigned long long)deadline_us, (unsigned long long)s_ref[id].deadline_us);
+    TEST_CHECK(deadline_us >= s_last_deadline_us, "timer %u fired for %llu us after a timer of %llu us", id,
+               (unsigned long long)deadline_us, (unsigned long long)s_last_deadline_us);
+    s_last_deadline_us = deadline_us;
+
+    if (repeat)
+    {
+        s_ref[id].deadline_us = p_timer->next_shot_time;
+    }
+    else
+    {
+        s_ref[id].armed = false;
+    }
+
+    if (s_p_trace)
+    {
+        fprintf(s_p_trace, "F %llu %u %llu\n", (unsigned long long)s_now_tick, id, (unsigned long long)deadline_us);
+    }
+
+    if (s_draining)
+    {
+        return;
+    }
+
+    if (s_defer)
+    {
+        TEST_CHECK(s_deferred_cnt < DEFERRED_CNT_MAX, "too many callbacks between two main loop steps");
+        if (s_deferred_cnt < DEFERRED_CNT_MAX)
+        {
+            s_deferred[s_deferred_cnt++] = id;
+        }
+        return;
+    }
+    callback_action(id);
+}
+
+/* Run the starts and stops left by the callbacks */
+static void deferred_run(void)
+{
+    for (uint32_t i = 0; i < s_deferred_cnt; i++)
+    {
+        callback_action(s_deferred[i]);
+    }
+    s_deferred_cnt = 0;
+}
+
+/* Let the time run up to target_tick, firing the sleep timer each time it expires on the way */
+static void time_run(uint64_t target_tick)
+{
+    while (s_slp_running && s_expire_tick <= target_tick)
+    {
+        s_now_tick = s_expire_tick;
+        hal_pwr_sleep_timer_irq_handler();
+    }
+    s_now_tick = target_tick;
+    deferred_run();
+}
+
+/*
+ * Global functions
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t ops = OPS_DEFAULT;
+    bool     long_run = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--ops") && i + 1 < argc)
+        {
+            ops = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(argv[i], "--timers") && i + 1 < argc)
+        {
+            s_timer_cnt = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(argv[i], "--long"))
+        {
+            long_run = true;
+        }
+        else if (!strcmp(argv[i], "--defer"))
+        {
+            s_defer = true;
+        }
+        else if (!strcmp(argv[i], "--trace") && i + 1 < argc)
+        {
+            s_p_trace = fopen(argv[++i], "w");
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--ops N] [--timers N] [--long] [--defer] [--trace <file>]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (s_timer_cnt == 0 || s_timer_cnt > TIMER_CNT_MAX)
+    {
+        s_timer_cnt = TIMERS_DEFAULT;
+    }
+
+    test_rand_seed(12345);
+    for (uint32_t id = 0; id < s_timer_cnt; id++)
+    {
+        app_timer_create(&s_timers[id], (id % 3) ? ATIMER_ONE_SHOT : ATIMER_REPEAT, timer_callback);
+    }
+
+    double cpu_start = test_cpu_time_s();
+
+    for (uint32_t op = 0; op < ops; op++)
+    {
+        time_run(s_now_tick + test_rand() % 200);
+
+        uint32_t id = test_rand() % s_timer_cnt;
+        if (test_rand() % 3)
+        {
+            timer_start(id);
+        }
+        else
+        {
+            timer_stop(id);
+        }
+
+        if ((op & 1023) == 0)
+        {
+            missed_check();
+        }
+    }
+
+    // a last minute, or 40 hours of the one-shot timers only
+    uint64_t end_tick = s_now_tick + SLP_TIMER_FREQ_HZ * 60ull;
+    if (long_run)
+    {
+        for (uint32_t id = 0; id < s_timer_cnt; id++)
+        {
+            if (s_timers[id].timer_node_mode == ATIMER_REPEAT)
+            {
+                timer_stop(id);
+            }
+        }
+        s_draining = true;
+        end_tick = s_now_tick + SLP_TIMER_FREQ_HZ * 3600ull * 40;
+    }
+    while (s_now_tick < end_tick)
+    {
+        time_run((end_tick - s_now_tick > 200) ? s_now_tick + 200 : end_tick);
+    }
+    missed_check();
+
+    double cpu_time = test_cpu_time_s() - cpu_start;
+
+    if (s_p_trace)
+    {
+        fclose(s_p_trace);
+    }
+
+    printf("%s: %u timers, %llu starts, %llu stops, %llu fired, %.3f s CPU\n",
+           APP_TIMER_WHEEL_ENABLE ? "wheel" : "list", s_timer_cnt, (unsigned long long)s_start_cnt,
+           (unsigned long long)s_stop_cnt, (unsigned long long)s_fired_cnt, cpu_time);
+
+    return test_report(APP_TIMER_WHEEL_ENABLE ? "app_timer_wheel" : "app_timer_list");
+}
@@ -0,0 +1,563 @@
+/*
+ * bt_ctl_uart frame parser, fed through its RX ring by a modelled UART. The BT controller stream
+ * is cut in random UART chunks: a few bytes (frame heads and lengths split across chunks) or up to
+ * a whole receive region (many frames in one chunk). The application parses the ring at random
+ * times, and whenever the UART has nothing armed. Four streams:
+ *   - clean frames: every frame is dispatched, in order, and nothing is skipped,
+ *   - BT log between the frames (no byte that can start a frame head): the same frames, and
+ *     exactly the log bytes are skipped,
+ *   - log and one frame in ten corrupted: no corrupted frame is dispatched, the intact ones are,
+ *   - random garbage (fake heads included) and corrupted frames: the intact frames come out in
+ *     order, but a fake frame that passes its checksum may hide a few of them.
+ * Then receives the driver refuses to start: counted, and started again by the next parse even
+ * with an empty ring. Last the parse throughput on a clean stream received a region at a time.
+ *
+ * Usage: bt_ctl_uart_test [--frames N] [--mbytes N]   (frames per stream, MB for the throughput)
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "bt_ctl_uart.h"
+#include "bt_ctl_ind_parse.h"
+#include "bt_ctl_debug_interface.h"
+#include "test_common.h"
+
+/*
+ * Defines
+ *****************************************************************************************
+ */
+#define FRAMES_DEFAULT                  20000u
+#define MBYTES_DEFAULT                  16u
+#define FRAME_SIZE_MAX                  (BT_CTL_DATA_LEN_MIN + BT_MAX_RX_LEN)
+#define LOG_LEN_MAX                     40u
+#define STREAM_SIZE                     (1024u * 1024u)
+#define BAD_FRAMES_PERMILLE_MAX         10u
+#define MATCH_WINDOW                    64u
+
+typedef enum
+{
+    STREAM_CLEAN,
+    STREAM_LOG,
+    STREAM_CORRUPTED,
+    STREAM_GARBAGE,
+    STREAM_CNT,
+} test_stream_t;
+
+/* Defined by bt_ctl_uart.c, without a prototype in the headers */
+uint8_t app_bt_calc_checksum(uint8_t *p_buf, uint16_t len);
+
+/*
+ * Local variables
+ *****************************************************************************************
+ */
+static const char *s_stream_names[STREAM_CNT] = {
+    "clean",
+    "log between frames",
+    "corrupted frames",
+    "garbage",
+};
+
+/* UART model */
+static app_uart_evt_handler_t s_uart_evt_handler = NULL;
+static uint8_t               *s_p_rx_buf = NULL;
+static uint16_t               s_rx_size = 0;
+static uint64_t               s_lost = 0;
+static uint32_t               s_rx_refuse_cnt = 0;   /* next receive starts refused by the driver */
+
+/* Frames dispatched by bt_ctl_uart.c */
+static uint32_t *s_p_dispatched = NULL;
+static uint32_t  s_dispatched_max = 0;
+static uint32_t  s_dispatched_cnt = 0;
+static uint32_t  s_bad_data_cnt = 0;
+
+/*
+ * Stand-ins of the UART, the IO and the rest of the BT control library
+ *****************************************************************************************
+ */
+uint16_t bt_test_mode_al_cnt;
+uint16_t bt_test_mode_l_cnt;
+uint16_t bt_test_mode_s_cnt;
+uint16_t bt_test_mode_w_cnt;
+
+bool                     bt_sniff_state;
+volatile BT_OTA_STATUS_T bt_ota_state = BT_OTA_IDLE;
+
+uint16_t app_uart_init(app_uart_params_t *p_params, app_uart_evt_handler_t evt_handler, app_uart_tx_buf_t *tx_buffer)
+{
+    s_uart_evt_handler = evt_handler;
+    s_p_rx_buf = NULL;
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_deinit(app_uart_id_t id)
+{
+    s_p_rx_buf = NULL;
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_receive_async(app_uart_id_t id, uint8_t *p_data, uint16_t size)
+{
+    if (s_p_rx_buf)
+    {
+        return APP_DRV_ERR_BUSY;
+    }
+    if (s_rx_refuse_cnt)
+    {
+        s_rx_refuse_cnt--;
+        return APP_DRV_ERR_HAL;
+    }
+
+    s_p_rx_buf = p_data;
+    s_rx_size = size;
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_transmit_async(app_uart_id_t id, uint8_t *p_data, uint16_t size)
+{
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_transmit_sync(app_uart_id_t id, uint8_t *p_data, uint16_t size, uint32_t timeout)
+{
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_abort(app_uart_id_t id)
+{
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_io_init(app_io_type_t type, app_io_init_t *p_init)
+{
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_io_write_pin(app_io_type_t type, uint32_t pin, app_io_pin_state_t pin_state)
+{
+    return APP_DRV_SUCCESS;
+}
+
+void delay_ms(uint32_t ms)
+{
+}
+
+int32_t app_bt_ota_procedure(void)
+{
+    return 0;
+}
+
+void app_bt_ota_reponse_handle(uint8_t *buf, uint16_t len)
+{
+}
+
+void app_ota_tim_init(void)
+{
+}
+
+void app_bt_register_ble_adv_ptr(void (*ptr)(void))
+{
+}
+
+void app_bt_reset_hw(void)
+{
+}
+
+void app_bt_wakeup_bt(void)
+{
+}
+
+void ble_bt_set_sync_io(void)
+{
+}
+
+bool ble_bt_set_sync_io_is_up(void)
+{
+    return false;
+}
+
+void bt_ble_sync_gpiote_init(void)
+{
+}
+
+bool bt_debug_mode_is_active(void)
+{
+    return false;
+}
+
+void app_bt_debug_reponse_handle(uint8_t *buf, uint16_t len)
+{
+}
+
+void bt_debug_set_bt_transmit_func(bt_uart_transmit_sync_t transmit_func)
+{
+}
+
+void bt_debug_set_buffer(uint8_t *tx_buf, uint16_t tx_bufsize, uint8_t *rx_buf, uint16_t rx_bufsize)
+{
+}
+
+void bt_debug_task(void)
+{
+}
+
+/*
+ * Local functions
+ *****************************************************************************************
+ */
+static uint32_t frame_hash(uint16_t cmd, uint8_t opcode, uint16_t length, const uint8_t *p_data)
+{
+    uint32_t hash = 2166136261u ^ cmd;
+
+    hash = (hash ^ opcode) * 16777619u;
+    hash = (hash ^ length) * 16777619u;
+    for (uint16_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ p_data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void frame_record(bt_rx_info *p_rx_info)
+{
+    if ((p_rx_info->length > 0) != (p_rx_info->data != NULL))
+    {
+        s_bad_data_cnt++;
+        return;
+    }
+    if (s_dispatched_cnt < s_dispatched_max)
+    {
+        s_p_dispatched[s_dispatched_cnt] = frame_hash(p_rx_info->cmd, p_rx_info->opcode, p_rx_info->length, p_rx_info->data);
+    }
+    s_dispatched_cnt++;
+}
+
+/* A random frame of either type, the hash of what its handler must get */
+static uint32_t frame_make(uint8_t *p_frame, uint32_t *p_hash)
+{
+    bool     ind = test_rand() & 1;
+    uint16_t cmd = ind ? BT_CTL_IND_HEAD : BT_CTL_CMD_ACK_HEAD;
+    uint8_t  opcode = (uint8_t)(test_rand() % (ind ? IND_MESSAGE_MAX : OPCODE_BT_MAX));
+    uint16_t length = (test_rand() % 4) ? (uint16_t)(test_rand() % (BT_MAX_RX_LEN + 1)) : (uint16_t)(test_rand() % 4);
+
+    p_frame[0] = (uint8_t)cmd;
+    p_frame[1] = (uint8_t)(cmd >> 8);
+    p_frame[BT_CTL_HEAD_LEN] = opcode;
+    p_frame[BT_CTL_DATA_INDEX - BT_CTL_DATA_LEN] = (uint8_t)length;
+    p_frame[BT_CTL_DATA_INDEX - BT_CTL_DATA_LEN + 1] = (uint8_t)(length >> 8);
+    for (uint16_t i = 0; i < length; i++)
+    {
+        p_frame[BT_CTL_DATA_INDEX + i] = (uint8_t)test_rand();
+    }
+    p_frame[BT_CTL_DATA_INDEX + length] = app_bt_calc_checksum(p_frame, BT_CTL_DATA_INDEX + length);
+
+    *p_hash = frame_hash(cmd, opcode, length, &p_frame[BT_CTL_DATA_INDEX]);
+    return BT_CTL_DATA_LEN_MIN + length;
+}
+
+/* The UART receives a chunk in the armed regions, each region is reported when full or at the end of the chunk */
+static void uart_chunk_receive(const uint8_t *p_data, uint32_t length)
+{
+    while (length)
+    {
+        if (s_p_rx_buf == NULL)
+        {
+            // the ring is full, the application reads it and the receive starts again
+            handle_uart_ring_buffer_data();
+        }
+        if (s_p_rx_buf == NULL)
+        {
+            s_lost += length;
+            return;
+        }
+
+        uint32_t size = (length < s_rx_size) ? length : s_rx_size;
+        uint8_t *p_region = s_p_rx_buf;
+
+        memcpy(p_region, p_data, size);
+        p_data += size;
+        length -= size;
+
+        app_uart_evt_t evt = {.type = APP_UART_EVT_RX_DATA};
+        evt.data.size = (uint16_t)size;
+        s_p_rx_buf = NULL;
+        s_uart_evt_handler(&evt);
+    }
+}
+
+/* Cut the stream in chunks: a few bytes, or up to a whole receive region */
+static void uart_receive(const uint8_t *p_data, uint32_t length)
+{
+    while (length)
+    {
+        uint32_t chunk = (test_rand() & 1) ? 1 + test_rand() % 8 : 1 + test_rand() % WATCH_DEMO_UART_BUFF_RX_LEN;
+
+        chunk = (chunk < length) ? chunk : length;
+        uart_chunk_receive(p_data, chunk);
+        p_data += chunk;
+        length -= chunk;
+
+        if (test_rand() % 3 == 0)
+        {
+            handle_uart_ring_buffer_data();
+        }
+    }
+}
+
+static uint32_t log_make(uint8_t *p_log, bool fake_heads)
+{
+    uint32_t length = 1 + test_rand() % LOG_LEN_MAX;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        p_log[i] = (uint8_t)test_rand();
+        // a frame head starts with 0xBB (BT_CTL_CMD_ACK_HEAD) or 0xDC (BT_CTL_IND_HEAD)
+        if (!fake_heads && (p_log[i] == (uint8_t)BT_CTL_CMD_ACK_HEAD || p_log[i] == (uint8_t)BT_CTL_IND_HEAD))
+        {
+            p_log[i] = ' ';
+        }
+    }
+    return length;
+}
+
+static void stream_run(test_stream_t stream, uint32_t frames)
+{
+    uint32_t             *p_expected = malloc(frames * sizeof(uint32_t));
+    uint32_t              expected_cnt = 0;
+    uint32_t              corrupted_cnt = 0;
+    uint64_t              log_bytes = 0;
+    uint64_t              lost_start = s_lost;
+    ble_bt_uart_rx_stat_t stat_start;
+    ble_bt_uart_rx_stat_t stat;
+
+    // from the first byte of a frame, with an empty ring
+    ble_bt_interface_init();
+    ble_bt_uart_rx_stat_get(&stat_start);
+    s_dispatched_cnt = 0;
+
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        uint8_t  frame[FRAME_SIZE_MAX];
+        uint8_t  log[LOG_LEN_MAX];
+        uint32_t hash;
+        uint32_t length = frame_make(frame, &hash);
+
+        if (stream >= STREAM_CORRUPTED && (test_rand() % 10) == 0)
+        {
+            frame[test_rand() % length] ^= (uint8_t)(1 + test_rand() % 255);
+            corrupted_cnt++;
+        }
+        else
+        {
+            p_expected[expected_cnt++] = hash;
+        }
+
+        if (stream != STREAM_CLEAN && (test_rand() % 4) == 0)
+        {
+            uint32_t log_length = log_make(log, stream == STREAM_GARBAGE);
+
+            uart_receive(log, log_length);
+            log_bytes += log_length;
+        }
+        uart_receive(frame, length);
+    }
+    handle_uart_ring_buffer_data();
+    handle_uart_ring_buffer_data();
+
+    // the intact frames, in order, among the dispatched ones: the frames hidden by a fake one are skipped
+    uint32_t matched = 0;
+    uint32_t next = 0;
+    uint32_t dispatched = (s_dispatched_cnt < s_dispatched_max) ? s_dispatched_cnt : s_dispatched_max;
+
+    for (uint32_t i = 0; i < dispatched; i++)
+    {
+        for (uint32_t j = next; j < expected_cnt && j < next + MATCH_WINDOW; j++)
+        {
+            if (s_p_dispatched[i] == p_expected[j])
+            {
+                matched++;
+                next = j + 1;
+                break;
+            }
+        }
+    }
+
+    ble_bt_uart_rx_stat_get(&stat);
+    uint32_t frame_errs = stat.frame_err_cnt - stat_start.frame_err_cnt;
+    uint32_t skipped = stat.skipped_bytes - stat_start.skipped_bytes;
+    const char *p_name = s_stream_names[stream];
+
+    TEST_CHECK(s_bad_data_cnt == 0, "%s: %u frames dispatched with data not matching their length", p_name, s_bad_data_cnt);
+    TEST_CHECK(s_lost == lost_start, "%s: %llu bytes lost by the UART", p_name, (unsigned long long)(s_lost - lost_start));
+    TEST_CHECK(stat.frame_cnt - stat_start.frame_cnt == s_dispatched_cnt, "%s: frame_cnt %u, %u frames dispatched",
+               p_name, stat.frame_cnt - stat_start.frame_cnt, s_dispatched_cnt);
+    if (stream <= STREAM_LOG)
+    {
+        TEST_CHECK(matched == expected_cnt && s_dispatched_cnt == expected_cnt, "%s: %u frames sent, %u dispatched, %u in order",
+                   p_name, expected_cnt, s_dispatched_cnt, matched);
+        TEST_CHECK(frame_errs == 0 && skipped == log_bytes, "%s: %u frame errors, %u bytes skipped for %llu bytes of log",
+                   p_name, frame_errs, skipped, (unsigned long long)log_bytes);
+    }
+    else
+    {
+        TEST_CHECK((expected_cnt - matched) * 1000u <= expected_cnt * BAD_FRAMES_PERMILLE_MAX,
+                   "%s: %u of %u intact frames not dispatched in order", p_name, expected_cnt - matched, expected_cnt);
+        TEST_CHECK((s_dispatched_cnt - matched) * 1000u <= expected_cnt * BAD_FRAMES_PERMILLE_MAX,
+                   "%s: %u frames dispatched that were not sent", p_name, s_dispatched_cnt - matched);
+        TEST_CHECK(frame_errs >= corrupted_cnt / 2, "%s: %u frame errors for %u corrupted frames", p_name, frame_errs,
+                   corrupted_cnt);
+    }
+
+    printf("%-20s %6u frames, %6u dispatched, %6u missed, %8u bytes skipped, %6u frame errors\n", p_name, expected_cnt,
+           s_dispatched_cnt, expected_cnt - matched, skipped, frame_errs);
+    free(p_expected);
+}
+
+/* The driver refuses the restart after a region, then the restart of the parse that empties the ring */
+static void refused_start_run(void)
+{
+    uint8_t               frame[FRAME_SIZE_MAX];
+    uint32_t              hash;
+    uint32_t              length = frame_make(frame, &hash);
+    uint64_t              lost_start = s_lost;
+    ble_bt_uart_rx_stat_t stat_start;
+    ble_bt_uart_rx_stat_t stat;
+
+    ble_bt_interface_init();
+    ble_bt_uart_rx_stat_get(&stat_start);
+    s_dispatched_cnt = 0;
+
+    s_rx_refuse_cnt = 2;
+    uart_chunk_receive(frame, length);
+    TEST_CHECK(s_p_rx_buf == NULL, "refused start: receive armed by a refused start");
+
+    handle_uart_ring_buffer_data();
+    TEST_CHECK(s_dispatched_cnt == 1 && s_p_dispatched[0] == hash, "refused start: %u frames dispatched", s_dispatched_cnt);
+    TEST_CHECK(s_p_rx_buf == NULL, "refused start: receive armed by a refused start");
+
+    // nothing to read, the receive is still started again
+    handle_uart_ring_buffer_data();
+    TEST_CHECK(s_p_rx_buf != NULL, "refused start: receive not started again with an empty ring");
+
+    uart_chunk_receive(frame, length);
+    handle_uart_ring_buffer_data();
+    ble_bt_uart_rx_stat_get(&stat);
+    TEST_CHECK(s_dispatched_cnt == 2, "refused start: %u frames dispatched after the restart", s_dispatched_cnt);
+    TEST_CHECK(stat.error_cnt - stat_start.error_cnt == 2, "refused start: error_cnt %u for 2 refused starts",
+               stat.error_cnt - stat_start.error_cnt);
+    TEST_CHECK(s_lost == lost_start, "refused start: %llu bytes lost by the UART", (unsigned long long)(s_lost - lost_start));
+    printf("%-20s %6u frames, %6u refused starts\n", "refused start", s_dispatched_cnt, stat.error_cnt - stat_start.error_cnt);
+}
+
+static void throughput_run(uint32_t mbytes)
+{
+    uint8_t  *p_stream = malloc(STREAM_SIZE);
+    uint32_t  length = 0;
+    uint32_t  frames = 0;
+    uint32_t  hash;
+    uint64_t  total = (uint64_t)mbytes * 1024u * 1024u;
+    uint64_t  received = 0;
+    uint64_t  expected_frames = 0;
+
+    while (length + FRAME_SIZE_MAX <= STREAM_SIZE)
+    {
+        length += frame_make(p_stream + length, &hash);
+        frames++;
+    }
+    ble_bt_interface_init();
+    s_dispatched_cnt = 0;
+
+    double start = test_cpu_time_s();
+
+    while (received < total)
+    {
+        // a region at a time, parsed at once
+        for (uint32_t offset = 0; offset < length;)
+        {
+            uint32_t size = length - offset;
+
+            if (s_p_rx_buf == NULL)
+            {
+                handle_uart_ring_buffer_data();
+            }
+            size = (size < s_rx_size) ? size : s_rx_size;
+            uart_chunk_receive(p_stream + offset, size);
+            handle_uart_ring_buffer_data();
+            offset += size;
+        }
+        received += length;
+        expected_frames += frames;
+    }
+
+    double elapsed = test_cpu_time_s() - start;
+
+    TEST_CHECK(s_dispatched_cnt == expected_frames, "throughput: %llu frames sent, %u dispatched",
+               (unsigned long long)expected_frames, s_dispatched_cnt);
+    printf("%-20s %8.1f MB/s, %.2f M frames/s\n", "throughput", received / elapsed / 1e6, s_dispatched_cnt / elapsed / 1e6);
+    free(p_stream);
+}
+
+/*
+ * Global functions
+ *****************************************************************************************
+ */
+void app_bt_ack_handle(bt_rx_info *g_bt_rx_info_p)
+{
+    frame_record(g_bt_rx_info_p);
+}
+
+void app_bt_ind_handle(bt_rx_info *g_bt_rx_info_p)
+{
+    frame_record(g_bt_rx_info_p);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t frames = FRAMES_DEFAULT;
+    uint32_t mbytes = MBYTES_DEFAULT;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+        {
+            frames = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(argv[i], "--mbytes") && i + 1 < argc)
+        {
+            mbytes = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--mbytes N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // the parser reads the BT debug mode flag at its fixed RAM address
+    if (mmap((void *)BT_DEBUG_MODE_CTL_ADDR, 4096, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) == MAP_FAILED)
+    {
+        fprintf(stderr, "cannot map the BT debug mode flag at 0x%08X\n", BT_DEBUG_MODE_CTL_ADDR);
+        return 2;
+    }
+
+    test_rand_seed(4321);
+    s_dispatched_max = frames * 2;
+    s_p_dispatched = malloc(s_dispatched_max * sizeof(uint32_t));
+
+    ble_bt_interface_init();
+    TEST_CHECK(s_uart_evt_handler && s_p_rx_buf, "ble_bt_interface_init() did not start the receive");
+    if (test_error_cnt())
+    {
+        return test_report("bt_ctl_uart");
+    }
+
+    for (uint32_t stream = 0; stream < STREAM_CNT; stream++)
+    {
+        stream_run((test_stream_t)stream, frames);
+    }
+    refused_start_run();
+    throughput_run(mbytes);
+
+    free(s_p_dispatched);
+    return test_report("bt_ctl_uart");
+}
@@ -0,0 +1,425 @@
+/*
+ * bt_ifce receive path on a modelled UART and BT controller. The controller raises the indication
+ * IO for each burst, then sends it once bt_ifce has pulsed the sync IO (the receive is armed). The
+ * UART writes into the region bt_ifce armed, reports it when full or after the RX timeout that ends
+ * a burst, and loses the bytes that come while nothing is armed. The application reads the RX ring
+ * and calls bt_ifce_rx_resume(), as bt_api_msg_handler() does. Three phases:
+ *   - a reader that keeps up: nothing may be lost,
+ *   - a slow reader, also running while bursts come in: the ring fills up, bytes are lost in the
+ *     middle of bursts (overrun_cnt) and the rest of the burst must be taken again once read,
+ *   - a UART driver refusing some receive starts (error_cnt),
+ * each followed by a reader that keeps up again. Checked throughout: the ring holds exactly the
+ * bytes the UART took, in order, and the receive never stays stopped (every burst gets its sync
+ * pulse once the ring has been read).
+ *
+ * Usage: bt_ifce_test [--bursts N]   (bursts per phase)
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "app_io.h"
+#include "app_uart.h"
+#include "bt_ctl_debug_interface.h"
+#include "bt_ifce.h"
+#include "test_common.h"
+
+/*
+ * Defines
+ *****************************************************************************************
+ */
+#define BURSTS_DEFAULT                  20000u
+#define BURST_LEN_MAX                   BT_IFCE_UART_RX_MAX_LEN
+#define BURST_QUEUE_SIZE                16u
+#define REF_SIZE                        8192u       /* more than the RX ring holds */
+#define STALL_STEPS_MAX                 64u
+
+typedef enum
+{
+    PHASE_KEEP_UP,
+    PHASE_SLOW_READER,
+    PHASE_DRIVER_ERRORS,
+    PHASE_CNT,
+} test_phase_t;
+
+/*
+ * Local variables
+ *****************************************************************************************
+ */
+static const char *s_phase_names[PHASE_CNT] = {
+    "reader keeps up",
+    "slow reader",
+    "driver errors",
+};
+
+/* UART model */
+static app_uart_evt_handler_t s_uart_evt_handler = NULL;
+static uint8_t               *s_p_rx_buf = NULL;
+static uint16_t               s_rx_size = 0;
+static uint16_t               s_rx_cnt = 0;
+static uint32_t               s_rx_fail_permille = 0;
+static uint32_t               s_rx_fail_cnt = 0;
+
+/* Controller model */
+static app_io_callback_t s_ind_evt_cb = NULL;
+static bool              s_sync_low = false;
+static uint32_t          s_sync_pulses = 0;
+static uint16_t          s_bursts[BURST_QUEUE_SIZE];
+static uint32_t          s_burst_head = 0;
+static uint32_t          s_burst_cnt = 0;
+static uint32_t          s_tx_idx = 0;
+static uint64_t          s_lost = 0;
+static uint64_t          s_resumed = 0;
+
+/* Application model: how much it reads at once, and whether it also runs in the middle of bursts */
+static uint32_t s_read_max = UINT32_MAX;
+static bool     s_read_in_burst = false;
+
+/* Bytes taken by the UART and not read yet */
+static uint8_t  s_ref[REF_SIZE];
+static uint64_t s_ref_wr = 0;
+static uint64_t s_ref_rd = 0;
+
+/*
+ * UART and IO stand-ins
+ *****************************************************************************************
+ */
+uint16_t app_uart_init(app_uart_params_t *p_params, app_uart_evt_handler_t evt_handler, app_uart_tx_buf_t *tx_buffer)
+{
+    s_uart_evt_handler = evt_handler;
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_deinit(app_uart_id_t id)
+{
+    s_p_rx_buf = NULL;
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_transmit_async(app_uart_id_t id, uint8_t *p_data, uint16_t size)
+{
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_transmit_sync(app_uart_id_t id, uint8_t *p_data, uint16_t size, uint32_t timeout)
+{
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_receive_async(app_uart_id_t id, uint8_t *p_data, uint16_t size)
+{
+    if (s_p_rx_buf)
+    {
+        return APP_DRV_ERR_BUSY;
+    }
+    if (s_rx_fail_permille && (test_rand() % 1000) < s_rx_fail_permille)
+    {
+        s_rx_fail_cnt++;
+        return APP_DRV_ERR_BUSY;
+    }
+
+    s_p_rx_buf = p_data;
+    s_rx_size = size;
+    s_rx_cnt = 0;
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_uart_abort(app_uart_id_t id)
+{
+    s_p_rx_buf = NULL;
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_io_init(app_io_type_t type, app_io_init_t *p_init)
+{
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_io_write_pin(app_io_type_t type, uint32_t pin, app_io_pin_state_t pin_state)
+{
+    if (type == BT_IFCE_SYNC_IO_TYPE && pin == BT_IFCE_SYNC_IO_PIN)
+    {
+        if (pin_state == APP_IO_PIN_RESET)
+        {
+            s_sync_low = true;
+        }
+        else if (s_sync_low)
+        {
+            s_sync_low = false;
+            s_sync_pulses++;
+        }
+    }
+    return APP_DRV_SUCCESS;
+}
+
+uint16_t app_io_event_register_cb(app_io_type_t type, app_io_init_t *p_init, app_io_callback_t io_evt_cb, void *arg)
+{
+    if (type == BT_IFCE_IND_IO_TYPE && p_init->pin == BT_IFCE_IND_IO_PIN)
+    {
+        s_ind_evt_cb = io_evt_cb;
+    }
+    return APP_DRV_SUCCESS;
+}
+
+void delay_ms(uint32_t ms)
+{
+}
+
+bool bt_debug_mode_is_active(void)
+{
+    return false;
+}
+
+void app_bt_debug_reponse_handle(uint8_t *buf, uint16_t len)
+{
+}
+
+/*
+ * Local functions
+ *****************************************************************************************
+ */
+static uint8_t stream_byte(uint32_t idx)
+{
+    return (uint8_t)(idx ^ (idx >> 8) ^ (idx >> 16));
+}
+
+static void uart_rx_data_report(uint16_t size)
+{
+    app_uart_evt_t evt = {.type = APP_UART_EVT_RX_DATA};
+
+    evt.data.size = size;
+    s_p_rx_buf = NULL;
+    s_uart_evt_handler(&evt);
+}
+
+/* One byte on the wire: into the armed region, or lost */
+static bool uart_wire_byte(uint8_t byte)
+{
+    if (s_p_rx_buf == NULL)
+    {
+        s_lost++;
+        return false;
+    }
+
+    s_p_rx_buf[s_rx_cnt++] = byte;
+    s_ref[s_ref_wr++ % REF_SIZE] = byte;
+    if (s_rx_cnt == s_rx_size)
+    {
+        uart_rx_data_report(s_rx_cnt);
+    }
+    return true;
+}
+
+/* End of a burst: the RX timeout reports a region that got bytes, an empty one stays armed */
+static void uart_wire_idle(void)
+{
+    if (s_p_rx_buf && s_rx_cnt)
+    {
+        uart_rx_data_report(s_rx_cnt);
+    }
+}
+
+static void app_read(void);
+
+static void ctl_burst_queue(uint16_t length)
+{
+    s_bursts[(s_burst_head + s_burst_cnt) % BURST_QUEUE_SIZE] = length;
+    s_burst_cnt++;
+    s_ind_evt_cb(NULL);
+}
+
+/* The controller sends a burst for each sync pulse, the pulses that come with no burst waiting are lost */
+static void ctl_run(void)
+{
+    while (s_sync_pulses)
+    {
+        s_sync_pulses--;
+        if (s_burst_cnt == 0)
+        {
+            continue;
+        }
+
+        uint16_t length = s_bursts[s_burst_head];
+        s_burst_head = (s_burst_head + 1) % BURST_QUEUE_SIZE;
+        s_burst_cnt--;
+
+        // with no indication pending, only the receive of this burst can be restarted
+        bool alone = (s_burst_cnt == 0);
+        bool cut = false;
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            bool taken = uart_wire_byte(stream_byte(s_tx_idx++));
+
+            // bytes taken again after some were lost: bt_ifce_rx_resume() restarted the receive in time
+            s_resumed += (alone && cut && taken);
+            cut = cut || !taken;
+            if (s_read_in_burst && (test_rand() % 1024) == 0)
+            {
+                app_read();
+            }
+        }
+        uart_wire_idle();
+    }
+}
+
+/* Read some bytes of the RX ring, check them against what the UART took, then resume */
+static void app_read(void)
+{
+    ring_buffer_t *p_ring = bt_ifce_get_rx_ring_buffer();
+    uint8_t        buf[256];
+    uint32_t       bad = 0;
+    uint32_t       max_len = (s_read_max == UINT32_MAX) ? UINT32_MAX : test_rand() % s_read_max;
+    // the bytes in the armed region are not committed yet
+    uint32_t       uncommitted = s_p_rx_buf ? s_rx_cnt : 0;
+
+    while (max_len)
+    {
+        uint32_t len = ring_buffer_read(p_ring, buf, (max_len < sizeof(buf)) ? max_len : sizeof(buf));
+
+        if (len == 0)
+        {
+            break;
+        }
+        for (uint32_t i = 0; i < len; i++)
+        {
+            bad += (s_ref_rd == s_ref_wr) || (buf[i] != s_ref[s_ref_rd++ % REF_SIZE]);
+        }
+        max_len -= len;
+    }
+    TEST_CHECK(bad == 0, "%u bytes read from the RX ring are not the ones the UART took", bad);
+    TEST_CHECK(s_ref_wr - s_ref_rd == ring_buffer_items_count_get(p_ring) + uncommitted,
+               "RX ring holds %u bytes and the receive %u, the UART took %llu", ring_buffer_items_count_get(p_ring),
+               uncommitted, (unsigned long long)(s_ref_wr - s_ref_rd));
+
+    bt_ifce_rx_resume();
+}
+
+static uint16_t burst_len_rand(void)
+{
+    uint32_t r = test_rand() % 4;
+
+    // short messages, long ones, and bursts that fill the largest receive region exactly
+    if (r == 0)
+    {
+        return BURST_LEN_MAX;
+    }
+    if (r == 1)
+    {
+        return (uint16_t)(1 + test_rand() % BURST_LEN_MAX);
+    }
+    return (uint16_t)(1 + test_rand() % 64);
+}
+
+/* Let every queued burst in, reading all the ring: a burst left waiting means the receive stalled */
+static void drain(test_phase_t phase)
+{
+    s_read_max = UINT32_MAX;
+    s_read_in_burst = false;
+    for (uint32_t step = 0; step < STALL_STEPS_MAX && s_burst_cnt; step++)
+    {
+        ctl_run();
+        app_read();
+    }
+    ctl_run();
+    app_read();
+    TEST_CHECK(s_burst_cnt == 0, "%s: %u bursts never let in, the receive stalled", s_phase_names[phase], s_burst_cnt);
+
+    // the controller gives up on them
+    s_burst_cnt = 0;
+}
+
+static void phase_run(test_phase_t phase, uint32_t bursts)
+{
+    bt_ifce_rx_stat_t stat_start;
+    bt_ifce_rx_stat_t stat;
+    uint64_t          lost_start = s_lost;
+    uint64_t          taken_start = s_ref_wr;
+    uint64_t          resumed_start = s_resumed;
+
+    bt_ifce_get_rx_stat(&stat_start);
+    s_rx_fail_permille = (phase == PHASE_DRIVER_ERRORS) ? 50 : 0;
+    s_read_max = (phase == PHASE_SLOW_READER) ? 300 : UINT32_MAX;
+    s_read_in_burst = (phase == PHASE_SLOW_READER);
+
+    for (uint32_t i = 0; i < bursts; i++)
+    {
+        if (s_burst_cnt < BURST_QUEUE_SIZE)
+        {
+            ctl_burst_queue(burst_len_rand());
+        }
+        ctl_run();
+        app_read();
+    }
+    s_rx_fail_permille = 0;
+    drain(phase);
+
+    bt_ifce_get_rx_stat(&stat);
+    uint32_t overruns = stat.overrun_cnt - stat_start.overrun_cnt;
+    uint32_t errors = stat.error_cnt - stat_start.error_cnt;
+    uint64_t lost = s_lost - lost_start;
+
+    TEST_CHECK(stat.rx_bytes - stat_start.rx_bytes == (uint32_t)(s_ref_wr - taken_start), "%s: rx_bytes %u, the UART took %llu",
+               s_phase_names[phase], stat.rx_bytes - stat_start.rx_bytes, (unsigned long long)(s_ref_wr - taken_start));
+    if (phase == PHASE_KEEP_UP)
+    {
+        TEST_CHECK(lost == 0 && overruns == 0 && errors == 0, "%s: %llu bytes lost, %u overruns, %u errors",
+                   s_phase_names[phase], (unsigned long long)lost, overruns, errors);
+    }
+    if (phase == PHASE_SLOW_READER)
+    {
+        TEST_CHECK(overruns > 0, "%s: the RX ring never filled up", s_phase_names[phase]);
+        TEST_CHECK(s_resumed > resumed_start, "%s: no burst cut by the full ring was taken again after a read",
+                   s_phase_names[phase]);
+    }
+    if (phase == PHASE_DRIVER_ERRORS)
+    {
+        TEST_CHECK(errors == s_rx_fail_cnt && errors > 0, "%s: %u errors counted, %u receive starts refused",
+                   s_phase_names[phase], errors, s_rx_fail_cnt);
+        s_rx_fail_cnt = 0;
+    }
+
+    printf("%-16s %10llu bytes taken, %8llu lost, %5u overruns, %5u errors, max burst %u\n", s_phase_names[phase],
+           (unsigned long long)(s_ref_wr - taken_start), (unsigned long long)lost, overruns, errors, stat.max_burst);
+}
+
+/*
+ * Global functions
+ *****************************************************************************************
+ */
+void bt_ifce_data_available(void)
+{
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t bursts = BURSTS_DEFAULT;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--bursts") && i + 1 < argc)
+        {
+            bursts = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--bursts N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    test_rand_seed(2024);
+    TEST_CHECK(bt_ifce_init() == APP_DRV_SUCCESS && s_uart_evt_handler && s_ind_evt_cb, "bt_ifce_init() failed");
+    if (test_error_cnt())
+    {
+        return test_report("bt_ifce");
+    }
+
+    for (uint32_t phase = 0; phase < PHASE_CNT; phase++)
+    {
+        phase_run((test_phase_t)phase, bursts);
+        // after the trouble, nothing may be lost again
+        phase_run(PHASE_KEEP_UP, bursts / 4);
+    }
+
+    return test_report("bt_ifce");
+}
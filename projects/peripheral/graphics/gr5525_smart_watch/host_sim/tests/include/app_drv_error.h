@@ -0,0 +1,10 @@
+#ifndef __TEST_APP_DRV_ERROR_H__
+#define __TEST_APP_DRV_ERROR_H__
+
+/* Same values as drivers/inc/app_drv_error.h */
+#define APP_DRV_SUCCESS             0x0000
+#define APP_DRV_ERR_HAL             0x00E1
+#define APP_DRV_ERR_BUSY            0x00E2
+#define APP_DRV_ERR_INVALID_PARAM   0x00E4
+
+#endif /* __TEST_APP_DRV_ERROR_H__ */
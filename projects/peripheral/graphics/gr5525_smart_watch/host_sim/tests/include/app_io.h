@@ -0,0 +1,104 @@
+#ifndef __TEST_APP_IO_H__
+#define __TEST_APP_IO_H__
+
+/* The part of drivers/inc/app_io.h used by the libraries under test, the test models the pins */
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "app_drv_error.h"
+#include "grx_hal.h"
+
+typedef enum
+{
+    APP_IO_PIN_RESET,
+    APP_IO_PIN_SET,
+} app_io_pin_state_t;
+
+typedef enum
+{
+    APP_IO_TYPE_GPIOA,
+    APP_IO_TYPE_GPIOB,
+    APP_IO_TYPE_GPIOC,
+    APP_IO_TYPE_AON,
+    APP_IO_TYPE_MSIO,
+    APP_IO_TYPE_NORMAL,
+    APP_IO_TYPE_MAX,
+} app_io_type_t;
+
+typedef enum
+{
+    APP_IO_MODE_NONE,
+    APP_IO_MODE_INPUT,
+    APP_IO_MODE_OUTPUT,
+    APP_IO_MODE_MUX,
+    APP_IO_MODE_IT_RISING,
+    APP_IO_MODE_IT_FALLING,
+    APP_IO_MODE_IT_BOTH_EDGE,
+    APP_IO_MODE_IT_HIGH,
+    APP_IO_MODE_IT_LOW,
+    APP_IO_MODE_ANALOG,
+    APP_IO_MODE_MAX,
+} app_io_mode_t;
+
+typedef enum
+{
+    APP_IO_NOPULL,
+    APP_IO_PULLUP,
+    APP_IO_PULLDOWN,
+    APP_IO_PULL_MAX,
+} app_io_pull_t;
+
+typedef enum
+{
+    APP_IO_MUX_0,
+    APP_IO_MUX_1,
+    APP_IO_MUX_2,
+    APP_IO_MUX_3,
+    APP_IO_MUX_4,
+    APP_IO_MUX_5,
+    APP_IO_MUX_6,
+    APP_IO_MUX_7,
+    APP_IO_MUX_8,
+} app_io_mux_t;
+
+#define APP_IO_MUX                  APP_IO_MUX_8
+
+#define APP_IO_PIN_0                (1u << 0)
+#define APP_IO_PIN_1                (1u << 1)
+#define APP_IO_PIN_2                (1u << 2)
+#define APP_IO_PIN_3                (1u << 3)
+#define APP_IO_PIN_4                (1u << 4)
+#define APP_IO_PIN_5                (1u << 5)
+#define APP_IO_PIN_6                (1u << 6)
+#define APP_IO_PIN_7                (1u << 7)
+#define APP_IO_PIN_8                (1u << 8)
+#define APP_IO_PIN_9                (1u << 9)
+#define APP_IO_PIN_10               (1u << 10)
+#define APP_IO_PIN_11               (1u << 11)
+#define APP_IO_PIN_12               (1u << 12)
+#define APP_IO_PIN_13               (1u << 13)
+#define APP_IO_PIN_14               (1u << 14)
+#define APP_IO_PIN_15               (1u << 15)
+
+typedef struct
+{
+    uint32_t      pin;
+    app_io_mode_t mode;
+    app_io_pull_t pull;
+    app_io_mux_t  mux;
+} app_io_init_t;
+
+typedef struct
+{
+    app_io_type_t type;
+    uint32_t      pin;
+    void         *arg;
+} app_io_evt_t;
+
+typedef void (*app_io_callback_t)(app_io_evt_t *p_evt);
+
+uint16_t app_io_init(app_io_type_t type, app_io_init_t *p_init);
+uint16_t app_io_write_pin(app_io_type_t type, uint32_t pin, app_io_pin_state_t pin_state);
+uint16_t app_io_event_register_cb(app_io_type_t type, app_io_init_t *p_init, app_io_callback_t io_evt_cb, void *arg);
+
+#endif /* __TEST_APP_IO_H__ */
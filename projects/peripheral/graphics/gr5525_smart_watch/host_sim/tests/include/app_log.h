@@ -0,0 +1,11 @@
+#ifndef __TEST_APP_LOG_H__
+#define __TEST_APP_LOG_H__
+
+/* The tests check the statistics of the libraries, not their logs */
+#define APP_LOG_ERROR(...)
+#define APP_LOG_WARNING(...)
+#define APP_LOG_INFO(...)
+#define APP_LOG_DEBUG(...)
+#define APP_LOG_RAW_INFO(...)
+
+#endif /* __TEST_APP_LOG_H__ */
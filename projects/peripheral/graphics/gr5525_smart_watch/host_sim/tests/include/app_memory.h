@@ -0,0 +1,9 @@
+#ifndef __TEST_APP_MEMORY_H__
+#define __TEST_APP_MEMORY_H__
+
+#include <stdlib.h>
+
+#define app_malloc(size)            malloc(size)
+#define app_free(ptr)               free(ptr)
+
+#endif /* __TEST_APP_MEMORY_H__ */
@@ -0,0 +1,95 @@
+#ifndef __TEST_APP_UART_H__
+#define __TEST_APP_UART_H__
+
+/* The part of drivers/inc/app_uart.h used by the libraries under test, the test models the UART */
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "app_drv_error.h"
+#include "app_io.h"
+#include "grx_hal.h"
+#include "ring_buffer.h"
+
+#define UART_DATABITS_8                 3u
+#define UART_STOPBITS_1                 0u
+#define UART_PARITY_NONE                0u
+#define UART_HWCONTROL_NONE             0u
+#define UART_RECEIVER_TIMEOUT_ENABLE    1u
+
+typedef enum
+{
+    APP_UART_ID_0,
+    APP_UART_ID_1,
+    APP_UART_ID_2,
+    APP_UART_ID_MAX,
+} app_uart_id_t;
+
+typedef enum
+{
+    APP_UART_EVT_ERROR,
+    APP_UART_EVT_TX_CPLT,
+    APP_UART_EVT_RX_DATA,
+    APP_UART_EVT_ABORT_TX,
+    APP_UART_EVT_ABORT_RX,
+    APP_UART_EVT_ABORT_TXRX,
+} app_uart_evt_type_t;
+
+typedef struct
+{
+    app_uart_evt_type_t type;
+    union
+    {
+        uint32_t error_code;
+        uint16_t size;
+    } data;
+} app_uart_evt_t;
+
+typedef void (*app_uart_evt_handler_t)(app_uart_evt_t *p_evt);
+
+typedef struct
+{
+    app_io_type_t type;
+    app_io_mux_t  mux;
+    uint32_t      pin;
+    app_io_pull_t pull;
+} app_uart_pin_t;
+
+typedef struct
+{
+    app_uart_pin_t tx;
+    app_uart_pin_t rx;
+    app_uart_pin_t cts;
+    app_uart_pin_t rts;
+} app_uart_pin_cfg_t;
+
+typedef struct
+{
+    uint32_t baud_rate;
+    uint32_t data_bits;
+    uint32_t stop_bits;
+    uint32_t parity;
+    uint32_t hw_flow_ctrl;
+    uint32_t rx_timeout_mode;
+} uart_init_t;
+
+typedef struct
+{
+    app_uart_id_t      id;
+    app_uart_pin_cfg_t pin_cfg;
+    uart_init_t        init;
+} app_uart_params_t;
+
+typedef struct
+{
+    uint8_t  *tx_buf;
+    uint32_t  tx_buf_size;
+} app_uart_tx_buf_t;
+
+uint16_t app_uart_init(app_uart_params_t *p_params, app_uart_evt_handler_t evt_handler, app_uart_tx_buf_t *tx_buffer);
+uint16_t app_uart_deinit(app_uart_id_t id);
+uint16_t app_uart_transmit_async(app_uart_id_t id, uint8_t *p_data, uint16_t size);
+uint16_t app_uart_transmit_sync(app_uart_id_t id, uint8_t *p_data, uint16_t size, uint32_t timeout);
+uint16_t app_uart_receive_async(app_uart_id_t id, uint8_t *p_data, uint16_t size);
+uint16_t app_uart_abort(app_uart_id_t id);
+
+#endif /* __TEST_APP_UART_H__ */
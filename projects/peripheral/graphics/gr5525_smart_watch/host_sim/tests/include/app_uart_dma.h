@@ -0,0 +1,11 @@
+#ifndef __TEST_APP_UART_DMA_H__
+#define __TEST_APP_UART_DMA_H__
+
+#include "app_uart.h"
+
+uint16_t app_uart_dma_init(app_uart_params_t *p_params);
+uint16_t app_uart_dma_deinit(app_uart_id_t id);
+uint16_t app_uart_dma_receive_async(app_uart_id_t id, uint8_t *p_data, uint16_t size);
+uint16_t app_uart_dma_transmit_async(app_uart_id_t id, uint8_t *p_data, uint16_t size);
+
+#endif /* __TEST_APP_UART_DMA_H__ */
@@ -0,0 +1,10 @@
+#ifndef __TEST_BOARD_SK_H__
+#define __TEST_BOARD_SK_H__
+
+/* Same values as platform/boards/board_SK.h */
+#include "app_io.h"
+
+#define APP_UART_TX_PULL            APP_IO_NOPULL
+#define APP_UART_RX_PULL            APP_IO_PULLUP
+
+#endif /* __TEST_BOARD_SK_H__ */
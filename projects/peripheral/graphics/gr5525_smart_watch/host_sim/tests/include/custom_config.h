@@ -0,0 +1,6 @@
+#ifndef __TEST_CUSTOM_CONFIG_H__
+#define __TEST_CUSTOM_CONFIG_H__
+
+/* Nothing of the application configuration is used by the libraries under test */
+
+#endif /* __TEST_CUSTOM_CONFIG_H__ */
@@ -0,0 +1,20 @@
+#ifndef __TEST_GR_INCLUDES_H__
+#define __TEST_GR_INCLUDES_H__
+
+/* The SDK umbrella header, reduced to the stand-ins of the host tests */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "grx_hal.h"
+#include "grx_sys.h"
+#include "app_drv_error.h"
+#include "app_io.h"
+#include "app_uart.h"
+
+#ifndef APP_LOG_ENABLE
+#define APP_LOG_ENABLE              0
+#endif
+
+#endif /* __TEST_GR_INCLUDES_H__ */
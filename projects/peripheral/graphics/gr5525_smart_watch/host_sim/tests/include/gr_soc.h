@@ -0,0 +1,7 @@
+#ifndef __TEST_GR_SOC_H__
+#define __TEST_GR_SOC_H__
+
+/* The tests call the interrupt handlers themselves */
+#define soc_register_nvic(irqn, handler)    ((void)(irqn))
+
+#endif /* __TEST_GR_SOC_H__ */
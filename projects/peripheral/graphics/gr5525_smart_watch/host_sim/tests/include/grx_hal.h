@@ -0,0 +1,69 @@
+#ifndef __TEST_GRX_HAL_H__
+#define __TEST_GRX_HAL_H__
+
+/*
+ * Device HAL stand-ins for the host tests. A test that runs an "interrupt" on another thread
+ * gets the interrupt masking of the library under test as a lock shared by all its threads
+ * (test_irq_lock(), test_common.c).
+ */
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "test_common.h"
+
+typedef int IRQn_Type;
+
+#define BLE_IRQn                    1
+#define SLPTIMER_IRQn               2
+
+/* Same scope rules as the device macros: the DISABLE macro opens a brace that the RESTORE one closes */
+#define LOCAL_INT_DISABLE(irqn)     do { (void)(irqn); test_irq_lock()
+#define LOCAL_INT_RESTORE()         test_irq_unlock(); } while (0)
+#define GLOBAL_EXCEPTION_DISABLE()  do { test_irq_lock()
+#define GLOBAL_EXCEPTION_ENABLE()   test_irq_unlock(); } while (0)
+
+#define __WEAK                      __attribute__((weak))
+#define __DMB()                     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/* BASEPRI and NVIC: nothing to mask on the host */
+static inline uint32_t __get_BASEPRI(void) { return 0; }
+static inline void __set_BASEPRI(uint32_t value) { (void)value; }
+static inline uint32_t NVIC_GetPriority(IRQn_Type irqn) { (void)irqn; return 0; }
+static inline uint32_t NVIC_GetPriorityGrouping(void) { return 3; }
+static inline uint32_t NVIC_GetEnableIRQ(IRQn_Type irqn) { (void)irqn; return 1; }
+static inline void NVIC_ClearPendingIRQ(IRQn_Type irqn) { (void)irqn; }
+static inline void NVIC_EnableIRQ(IRQn_Type irqn) { (void)irqn; }
+static inline void NVIC_DisableIRQ(IRQn_Type irqn) { (void)irqn; }
+
+static inline uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0;
+
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        result = (result << 1) | (value & 1u);
+        value >>= 1;
+    }
+    return result;
+}
+
+static inline uint32_t __CLZ(uint32_t value)
+{
+    return value ? (uint32_t)__builtin_clz(value) : 32u;
+}
+
+/* Sleep timer, modelled by the test that uses it */
+#define PWR_SLP_TIMER_MODE_SINGLE   0
+
+uint32_t hal_sleep_timer_get_clock_freq(void);
+void     hal_sleep_timer_config_and_start(uint8_t mode, uint32_t value);
+uint32_t hal_sleep_timer_status_get(void);
+uint32_t hal_sleep_timer_get_current_value(void);
+void     hal_sleep_timer_stop(void);
+void     hal_pwr_sleep_timer_irq_handler(void);
+void     hal_pwr_sleep_timer_elapsed_callback(void);
+
+void     delay_us(uint32_t us);
+void     delay_ms(uint32_t ms);
+
+#endif /* __TEST_GRX_HAL_H__ */
@@ -0,0 +1,17 @@
+#ifndef __TEST_GRX_SYS_H__
+#define __TEST_GRX_SYS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint16_t sdk_err_t;
+
+/* Same values as components/sdk/ble_error.h */
+#define SDK_SUCCESS                 0x0000
+#define SDK_ERR_INVALID_PARAM       0x0001
+#define SDK_ERR_BUSY                0x0006
+#define SDK_ERR_DISALLOWED          0x000f
+#define SDK_ERR_NO_RESOURCES        0x0010
+
+#endif /* __TEST_GRX_SYS_H__ */
@@ -0,0 +1,6 @@
+#ifndef __TEST_HAL_FLASH_H__
+#define __TEST_HAL_FLASH_H__
+
+/* Nothing of the flash HAL is used by the libraries under test */
+
+#endif /* __TEST_HAL_FLASH_H__ */
@@ -0,0 +1,11 @@
+#ifndef __TEST_UTILITY_H__
+#define __TEST_UTILITY_H__
+
+#ifndef MIN
+#define MIN(n, m)                   (((n) < (m)) ? (n) : (m))
+#endif
+#ifndef MAX
+#define MAX(n, m)                   (((n) < (m)) ? (m) : (n))
+#endif
+
+#endif /* __TEST_UTILITY_H__ */
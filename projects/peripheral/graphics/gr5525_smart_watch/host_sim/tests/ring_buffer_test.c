@@ -0,0 +1,197 @@
+/*
+ * ring_buffer throughput and integrity, one producer thread and one consumer thread through a
+ * 1 KB ring, with each pair of APIs:
+ *   - ring_buffer_write()/ring_buffer_read(), under the lock (GLOBAL_EXCEPTION_DISABLE(), a mutex
+ *     here, so the host figures overstate what the lock costs on the device),
+ *   - ring_buffer_spsc_write()/ring_buffer_spsc_read(), lock-free,
+ *   - ring_buffer_write_reserve()/commit() and ring_buffer_read_peek()/consume(), lock-free and
+ *     in place.
+ * The producer writes a byte counter in chunks of varying size, the consumer checks every byte:
+ * nothing may be lost, duplicated or reordered across the wrap of the ring.
+ *
+ * Usage: ring_buffer_test [--mbytes N]   (MB moved with each pair of APIs)
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ring_buffer.h"
+#include "test_common.h"
+
+/*
+ * Defines
+ *****************************************************************************************
+ */
+#define RING_SIZE                       1024u
+#define CHUNK_MAX                       97u
+#define READ_MAX                        128u
+#define MBYTES_DEFAULT                  16u
+
+typedef enum
+{
+    MODE_LOCKED,
+    MODE_SPSC,
+    MODE_IN_PLACE,
+    MODE_CNT,
+} test_mode_t;
+
+/*
+ * Local variables
+ *****************************************************************************************
+ */
+static const char *s_mode_names[MODE_CNT] = {
+    "locked write/read",
+    "spsc write/read",
+    "reserve/commit + peek/consume",
+};
+
+static ring_buffer_t s_ring;
+static uint8_t       s_ring_data[RING_SIZE];
+static test_mode_t   s_mode;
+static uint32_t      s_total;
+
+/*
+ * Local functions
+ *****************************************************************************************
+ */
+static void *producer_thread(void *p_arg)
+{
+    uint8_t  chunk[CHUNK_MAX];
+    uint8_t  seq = 0;
+    uint32_t sent = 0;
+
+    while (sent < s_total)
+    {
+        uint32_t want = 1 + (sent * 7) % CHUNK_MAX;
+        uint32_t done;
+
+        if (want > s_total - sent)
+        {
+            want = s_total - sent;
+        }
+
+        if (s_mode == MODE_IN_PLACE)
+        {
+            uint8_t *p_wr = NULL;
+
+            done = ring_buffer_write_reserve(&s_ring, &p_wr, want);
+            for (uint32_t i = 0; i < done; i++)
+            {
+                p_wr[i] = (uint8_t)(seq + i);
+            }
+            ring_buffer_write_commit(&s_ring, done);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < want; i++)
+            {
+                chunk[i] = (uint8_t)(seq + i);
+            }
+            done = (s_mode == MODE_LOCKED) ? ring_buffer_write(&s_ring, chunk, want) :
+                                             ring_buffer_spsc_write(&s_ring, chunk, want);
+        }
+
+        if (done == 0)
+        {
+            sched_yield();
+        }
+        seq += (uint8_t)done;
+        sent += done;
+    }
+
+    return NULL;
+}
+
+static uint32_t bytes_check(const uint8_t *p_data, uint32_t length, uint8_t *p_expected)
+{
+    uint32_t bad = 0;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        bad += (p_data[i] != (*p_expected)++);
+    }
+    return bad;
+}
+
+static void mode_run(test_mode_t mode)
+{
+    pthread_t thread;
+    uint8_t   buf[READ_MAX];
+    uint8_t   expected = 0;
+    uint32_t  received = 0;
+    uint32_t  bad = 0;
+
+    s_mode = mode;
+    ring_buffer_init(&s_ring, s_ring_data, sizeof(s_ring_data));
+
+    double start = test_time_s();
+    pthread_create(&thread, NULL, producer_thread, NULL);
+
+    while (received < s_total)
+    {
+        uint32_t done;
+
+        if (mode == MODE_IN_PLACE)
+        {
+            ring_buffer_span_t spans[2];
+
+            done = ring_buffer_read_peek(&s_ring, spans);
+            bad += bytes_check(spans[0].p_data, spans[0].length, &expected);
+            bad += bytes_check(spans[1].p_data, spans[1].length, &expected);
+            TEST_CHECK(spans[0].length + spans[1].length == done, "peek of %u bytes in spans of %u + %u", done,
+                       spans[0].length, spans[1].length);
+            ring_buffer_read_consume(&s_ring, done);
+        }
+        else
+        {
+            done = (mode == MODE_LOCKED) ? ring_buffer_read(&s_ring, buf, sizeof(buf)) :
+                                           ring_buffer_spsc_read(&s_ring, buf, sizeof(buf));
+            bad += bytes_check(buf, done, &expected);
+        }
+
+        if (done == 0)
+        {
+            sched_yield();
+        }
+        received += done;
+    }
+
+    pthread_join(thread, NULL);
+    double elapsed = test_time_s() - start;
+
+    TEST_CHECK(bad == 0, "%s: %u bytes out of sequence", s_mode_names[mode], bad);
+    TEST_CHECK(ring_buffer_items_count_get(&s_ring) == 0, "%s: ring not empty", s_mode_names[mode]);
+    printf("%-32s %8.1f MB/s\n", s_mode_names[mode], s_total / elapsed / 1e6);
+}
+
+/*
+ * Global functions
+ *****************************************************************************************
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t mbytes = MBYTES_DEFAULT;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "--mbytes") && i + 1 < argc)
+        {
+            mbytes = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--mbytes N]\n", argv[0]);
+            return 2;
+        }
+    }
+    s_total = mbytes * 1024u * 1024u;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    for (uint32_t mode = 0; mode < MODE_CNT; mode++)
+    {
+        mode_run((test_mode_t)mode);
+    }
+
+    return test_report("ring_buffer");
+}
@@ -0,0 +1,89 @@
+/*
+ * Helpers shared by the host tests of the SDK libraries (see the Makefile, make test).
+ */
+#define _GNU_SOURCE                     /* PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP */
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "test_common.h"
+
+/*
+ * Local variables
+ *****************************************************************************************
+ */
+static uint32_t s_error_cnt = 0;
+static uint32_t s_rand_state = 12345;
+static pthread_mutex_t s_irq_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+/*
+ * Global functions
+ *****************************************************************************************
+ */
+void test_fail(const char *p_file, int line)
+{
+    if (__atomic_add_fetch(&s_error_cnt, 1, __ATOMIC_RELAXED) <= TEST_ERROR_PRINT_MAX)
+    {
+        fprintf(stderr, "%s:%d: ", p_file, line);
+    }
+}
+
+uint32_t test_error_cnt(void)
+{
+    return __atomic_load_n(&s_error_cnt, __ATOMIC_RELAXED);
+}
+
+void test_rand_seed(uint32_t seed)
+{
+    const char *p_env = getenv("TEST_SEED");
+
+    s_rand_state = p_env ? (uint32_t)strtoul(p_env, NULL, 0) : seed;
+}
+
+uint32_t test_rand(void)
+{
+    return test_rand_r(&s_rand_state);
+}
+
+uint32_t test_rand_r(uint32_t *p_state)
+{
+    *p_state = *p_state * 1103515245u + 12345u;
+    return *p_state >> 8;
+}
+
+double test_time_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+double test_cpu_time_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void test_irq_lock(void)
+{
+    pthread_mutex_lock(&s_irq_lock);
+}
+
+void test_irq_unlock(void)
+{
+    pthread_mutex_unlock(&s_irq_lock);
+}
+
+int test_report(const char *p_name)
+{
+    if (s_error_cnt)
+    {
+        printf("%s: FAIL (%u errors)\n", p_name, s_error_cnt);
+        return 1;
+    }
+    printf("%s: PASS\n", p_name);
+    return 0;
+}
@@ -0,0 +1,43 @@
+#ifndef __TEST_COMMON_H__
+#define __TEST_COMMON_H__
+
+#include <stdint.h>
+#include <stdio.h>
+
+/* Count a failed check, the first ones are printed with their location */
+#define TEST_CHECK(cond, ...)                                                   \
+    do                                                                          \
+    {                                                                           \
+        if (!(cond))                                                            \
+        {                                                                       \
+            test_fail(__FILE__, __LINE__);                                      \
+            if (test_error_cnt() <= TEST_ERROR_PRINT_MAX)                       \
+            {                                                                   \
+                fprintf(stderr, __VA_ARGS__);                                   \
+                fprintf(stderr, "\n");                                          \
+            }                                                                   \
+        }                                                                       \
+    } while (0)
+
+#define TEST_ERROR_PRINT_MAX            10
+
+void     test_fail(const char *p_file, int line);
+uint32_t test_error_cnt(void);
+
+/* Deterministic pseudo random numbers, the seed can be set with the environment variable TEST_SEED */
+void     test_rand_seed(uint32_t seed);
+uint32_t test_rand(void);
+uint32_t test_rand_r(uint32_t *p_state);
+
+/* Monotonic wall clock and CPU time of the calling thread, in seconds */
+double   test_time_s(void);
+double   test_cpu_time_s(void);
+
+/* Interrupt masking stand-in: a recursive lock shared by all the threads of the test */
+void     test_irq_lock(void);
+void     test_irq_unlock(void);
+
+/* Print the verdict of the test and return its exit code */
+int      test_report(const char *p_name);
+
+#endif /* __TEST_COMMON_H__ */
@@ -0,0 +1,1162 @@
+/**
+ *****************************************************************************************
+ *
+ * @file gximg_tool.c
+ *
+ * @brief Offline encoder for the GX-IMG format drawn by lv_port_gximg.c.
+ *
+ * Converts a PNG (8-bit gray/RGB/palette, with or without alpha) or a raw RGBA8888
+ * file into an lv_gximg_dsc_t, or into the 16 pre-rotated frames of an
+ * lv_gximg_bundle_dsc_t (group[k] is the source rotated 6*k degrees counter
+ * clockwise around the pivot, as expected by lv_port_gximg_draw_bundle()).
+ *
+ * Every encoded image is rendered back through lv_port_gximg_draw() in 40-line bands,
+ * top-down (band cursor) and bottom-up (line lookup), over two backgrounds, and
+ * compared pixel by pixel with the source quantised to RGB565 and blended with
+ * lv_color_mix(). The report lists the flash used against LV_IMG_CF_TRUE_COLOR_ALPHA.
+ *
+ * Outputs, for "-o out":
+ *      out.bin         image data, to be appended to binary_resources.bin
+ *      out_dsc.c       descriptors in the lv_img_dsc_list.c layout
+ *      out_dsc.h       OFFSET_* defines and LV_GXIMG_DECLARE() lines
+ *
+ * Segment layout (see gximg_segment_t / gximg_line_info_t in lv_port_gximg.c):
+ *      u16 start_x:12 | padding:2 | keep_inline:1 | has_alpha:1, u16 width,
+ *      width * RGB565, [width * A8], padding to 4 bytes
+ *      line table: one u32 (offset:22 | y:10) per line after start_y, offsets are
+ *      relative to the first segment
+ *
+ *****************************************************************************************
+ */
+
+/*
+ * INCLUDE FILES
+ *****************************************************************************************
+ */
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "lvgl.h"
+#include "lv_port_gximg.h"
+
+/*
+ * DEFINES
+ *****************************************************************************************
+ */
+#define TOOL_BUNDLE_NB              (16u)
+#define TOOL_BUNDLE_STEP_DEG        (6u)
+#define TOOL_VERIFY_BAND_LINES      (40u)       /* VER_BUFF_LINE of lv_port_disp.c */
+#define TOOL_AUTO_TABLE_LINES       (40u)       /* auto mode: line table above one band */
+#define TOOL_MAX_START_X            (0x0FFFu)
+#define TOOL_MAX_LINE_Y             (0x03FFu)
+#define TOOL_MAX_LINE_OFFSET        (0x003FFFFFu)
+#define TOOL_DEFAULT_SPLIT_GAP      (4u)
+#define TOOL_DEFAULT_SPLIT_OPAQUE   (16u)
+
+#define SEG_HEADER_SIZE             (4u)
+#define SEG_FLAG_KEEP_INLINE        (1u << 14)
+#define SEG_FLAG_HAS_ALPHA          (1u << 15)
+#define SEG_PADDING_POS             (12u)
+#define LINE_INFO_Y_POS             (22u)
+
+/*
+ * ENUMERATIONS
+ *****************************************************************************************
+ */
+typedef enum
+{
+    TOOL_TABLE_AUTO = 0,
+    TOOL_TABLE_ALWAYS,
+    TOOL_TABLE_NEVER,
+} tool_table_mode_t;
+
+/*
+ * STRUCT DEFINE
+ *****************************************************************************************
+ */
+typedef struct
+{
+    uint16_t w;
+    uint16_t h;
+    uint8_t *rgba;
+} tool_image_t;
+
+typedef struct
+{
+    uint8_t *buf;
+    uint32_t size;
+    uint32_t cap;
+} tool_blob_t;
+
+typedef struct
+{
+    const char *input;
+    const char *out;
+    const char *name;
+    uint16_t raw_w;
+    uint16_t raw_h;
+    bool bundle;
+    bool has_pivot;
+    int32_t pivot_x;
+    int32_t pivot_y;
+    tool_table_mode_t table_mode;
+    uint32_t split_gap;
+    uint32_t split_opaque;
+    uint32_t offset;
+    bool verify;
+    const char *dump;
+} tool_opts_t;
+
+typedef struct
+{
+    lv_gximg_dsc_t dsc;
+    uint32_t blob_offset;
+    uint32_t segments;
+    uint32_t mismatches;
+    char name[96];
+} tool_entry_t;
+
+/*
+ * LOCAL VARIABLE DEFINITIONS
+ *****************************************************************************************
+ */
+static tool_opts_t s_opts = {
+    .table_mode = TOOL_TABLE_AUTO,
+    .split_gap = TOOL_DEFAULT_SPLIT_GAP,
+    .split_opaque = TOOL_DEFAULT_SPLIT_OPAQUE,
+    .verify = true,
+};
+
+/*
+ * LOCAL FUNCTION DEFINITIONS
+ *****************************************************************************************
+ */
+static void tool_die(const char *msg, const char *arg)
+{
+    fprintf(stderr, "gximg_tool: %s%s%s\n", msg, arg ? ": " : "", arg ? arg : "");
+    exit(2);
+}
+
+static void *tool_alloc(size_t size)
+{
+    void *p = calloc(1, size ? size : 1);
+    if (!p)
+    {
+        tool_die("out of memory", NULL);
+    }
+    return p;
+}
+
+static uint8_t *tool_read_file(const char *path, size_t *p_size)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+    {
+        tool_die("cannot open", path);
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t *data = tool_alloc(size);
+    if (fread(data, 1, size, fp) != (size_t)size)
+    {
+        tool_die("cannot read", path);
+    }
+    fclose(fp);
+    *p_size = size;
+    return data;
+}
+
+static void tool_write_file(const char *path, const void *data, size_t size)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp || fwrite(data, 1, size, fp) != size)
+    {
+        tool_die("cannot write", path);
+    }
+    fclose(fp);
+}
+
+/*
+ * Image loading
+ *****************************************************************************************
+ */
+static uint32_t tool_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint8_t tool_paeth(uint8_t a, uint8_t b, uint8_t c)
+{
+    int p = (int)a + b - c;
+    int pa = abs(p - a);
+    int pb = abs(p - b);
+    int pc = abs(p - c);
+    if (pa <= pb && pa <= pc)
+    {
+        return a;
+    }
+    return (pb <= pc) ? b : c;
+}
+
+static void tool_load_png(const char *path, tool_image_t *img)
+{
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    size_t size;
+    uint8_t *file = tool_read_file(path, &size);
+    if (size < 8 || memcmp(file, signature, 8))
+    {
+        tool_die("not a PNG file", path);
+    }
+
+    uint32_t w = 0, h = 0;
+    uint8_t depth = 0, color_type = 0, interlace = 0;
+    uint8_t palette[256][4];
+    uint32_t palette_nb = 0;
+    tool_blob_t idat = {0};
+
+    memset(palette, 0xFF, sizeof(palette));
+
+    size_t pos = 8;
+    while (pos + 12 <= size)
+    {
+        uint32_t len = tool_be32(file + pos);
+        const uint8_t *type = file + pos + 4;
+        const uint8_t *body = file + pos + 8;
+        if (pos + 12 + len > size)
+        {
+            tool_die("truncated PNG chunk", path);
+        }
+
+        if (!memcmp(type, "IHDR", 4))
+        {
+            w = tool_be32(body);
+            h = tool_be32(body + 4);
+            depth = body[8];
+            color_type = body[9];
+            interlace = body[12];
+        }
+        else if (!memcmp(type, "PLTE", 4))
+        {
+            palette_nb = len / 3;
+            for (uint32_t i = 0; i < palette_nb && i < 256; i++)
+            {
+                palette[i][0] = body[i * 3 + 0];
+                palette[i][1] = body[i * 3 + 1];
+                palette[i][2] = body[i * 3 + 2];
+            }
+        }
+        else if (!memcmp(type, "tRNS", 4) && color_type == 3)
+        {
+            for (uint32_t i = 0; i < len && i < 256; i++)
+            {
+                palette[i][3] = body[i];
+            }
+        }
+        else if (!memcmp(type, "IDAT", 4))
+        {
+            if (idat.size + len > idat.cap)
+            {
+                idat.cap = (idat.size + len) * 2;
+                idat.buf = realloc(idat.buf, idat.cap);
+                if (!idat.buf)
+                {
+                    tool_die("out of memory", NULL);
+                }
+            }
+            memcpy(idat.buf + idat.size, body, len);
+            idat.size += len;
+        }
+        else if (!memcmp(type, "IEND", 4))
+        {
+            break;
+        }
+        pos += 12 + len;
+    }
+
+    uint8_t channels;
+    switch (color_type)
+    {
+        case 0: channels = 1; break;
+        case 2: channels = 3; break;
+        case 3: channels = 1; break;
+        case 4: channels = 2; break;
+        case 6: channels = 4; break;
+        default: channels = 0; break;
+    }
+    if (!w || !h || w > 0xFFFF || h > 0xFFFF || depth != 8 || !channels || interlace)
+    {
+        tool_die("unsupported PNG (8-bit, non-interlaced gray/RGB/palette only)", path);
+    }
+    if (color_type == 3 && !palette_nb)
+    {
+        tool_die("palette PNG without PLTE", path);
+    }
+
+    uint32_t stride = w * channels;
+    uLongf raw_size = (uLongf)(stride + 1) * h;
+    uint8_t *raw = tool_alloc(raw_size);
+    if (uncompress(raw, &raw_size, idat.buf, idat.size) != Z_OK || raw_size != (uLongf)(stride + 1) * h)
+    {
+        tool_die("corrupted PNG data", path);
+    }
+
+    // Undo the per-row filters in place
+    for (uint32_t y = 0; y < h; y++)
+    {
+        uint8_t *row = raw + y * (stride + 1) + 1;
+        const uint8_t *prev = y ? row - (stride + 1) : NULL;
+        uint8_t filter = row[-1];
+        for (uint32_t i = 0; i < stride; i++)
+        {
+            uint8_t a = (i >= channels) ? row[i - channels] : 0;
+            uint8_t b = prev ? prev[i] : 0;
+            uint8_t c = (prev && i >= channels) ? prev[i - channels] : 0;
+            switch (filter)
+            {
+                case 0: break;
+                case 1: row[i] += a; break;
+                case 2: row[i] += b; break;
+                case 3: row[i] += (uint8_t)(((uint32_t)a + b) >> 1); break;
+                case 4: row[i] += tool_paeth(a, b, c); break;
+                default: tool_die("bad PNG filter", path);
+            }
+        }
+    }
+
+    img->w = w;
+    img->h = h;
+    img->rgba = tool_alloc((size_t)w * h * 4);
+    for (uint32_t y = 0; y < h; y++)
+    {
+        const uint8_t *row = raw + y * (stride + 1) + 1;
+        for (uint32_t x = 0; x < w; x++)
+        {
+            const uint8_t *s = row + x * channels;
+            uint8_t *d = img->rgba + ((size_t)y * w + x) * 4;
+            switch (color_type)
+            {
+                case 0: d[0] = d[1] = d[2] = s[0]; d[3] = 0xFF; break;
+                case 2: d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; d[3] = 0xFF; break;
+                case 3: memcpy(d, palette[s[0]], 4); break;
+                case 4: d[0] = d[1] = d[2] = s[0]; d[3] = s[1]; break;
+                case 6: memcpy(d, s, 4); break;
+            }
+        }
+    }
+
+    free(raw);
+    free(idat.buf);
+    free(file);
+}
+
+static void tool_load_raw(const char *path, uint16_t w, uint16_t h, tool_image_t *img)
+{
+    size_t size;
+    uint8_t *file = tool_read_file(path, &size);
+    if (size != (size_t)w * h * 4)
+    {
+        tool_die("raw RGBA8888 size does not match --raw WxH", path);
+    }
+    img->w = w;
+    img->h = h;
+    img->rgba = file;
+}
+
+/*
+ * Rotation (bundle frames)
+ *****************************************************************************************
+ */
+static void tool_sample_bilinear(const tool_image_t *src, float u, float v, uint8_t out[4])
+{
+    int x0 = (int)floorf(u);
+    int y0 = (int)floorf(v);
+    float fx = u - x0;
+    float fy = v - y0;
+    float acc[4] = {0};
+
+    for (int j = 0; j < 2; j++)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            int x = x0 + i;
+            int y = y0 + j;
+            float wgt = (i ? fx : 1.0f - fx) * (j ? fy : 1.0f - fy);
+            if (wgt <= 0.0f || x < 0 || y < 0 || x >= src->w || y >= src->h)
+            {
+                continue;
+            }
+            const uint8_t *p = src->rgba + ((size_t)y * src->w + x) * 4;
+            float a = p[3] * wgt;
+            acc[0] += p[0] * a;
+            acc[1] += p[1] * a;
+            acc[2] += p[2] * a;
+            acc[3] += a;
+        }
+    }
+
+    if (acc[3] < 0.5f)
+    {
+        memset(out, 0, 4);
+        return;
+    }
+    out[0] = (uint8_t)lroundf(acc[0] / acc[3]);
+    out[1] = (uint8_t)lroundf(acc[1] / acc[3]);
+    out[2] = (uint8_t)lroundf(acc[2] / acc[3]);
+    out[3] = (uint8_t)LV_MIN(lroundf(acc[3]), 255);
+}
+
+/* Rotate counter clockwise around the centre of pixel (pivot_x, pivot_y), trim the
+ * transparent border and return where the pivot pixel ends up. */
+static void tool_rotate(const tool_image_t *src, int32_t pivot_x, int32_t pivot_y, uint32_t deg,
+                        tool_image_t *dst, int32_t *p_center_x, int32_t *p_center_y)
+{
+    double rad = deg * M_PI / 180.0;
+    float c = (float)cos(rad);
+    float s = (float)sin(rad);
+    // Keep the right angles exact so 0 and 90 degrees are plain pixel copies
+    if (deg % 90 == 0)
+    {
+        c = (float)lround(cos(rad));
+        s = (float)lround(sin(rad));
+    }
+
+    float px = pivot_x + 0.5f;
+    float py = pivot_y + 0.5f;
+    float corner_x[4] = {-px, src->w - px, -px, src->w - px};
+    float corner_y[4] = {-py, -py, src->h - py, src->h - py};
+    float min_x = 0, max_x = 0, min_y = 0, max_y = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        // Screen y points down: CCW maps (1, 0) to (0, -1)
+        float rx = corner_x[i] * c + corner_y[i] * s;
+        float ry = -corner_x[i] * s + corner_y[i] * c;
+        min_x = LV_MIN(min_x, rx);
+        max_x = LV_MAX(max_x, rx);
+        min_y = LV_MIN(min_y, ry);
+        max_y = LV_MAX(max_y, ry);
+    }
+
+    int32_t cx = -(int32_t)floorf(min_x) + 1;
+    int32_t cy = -(int32_t)floorf(min_y) + 1;
+    int32_t w = cx + (int32_t)ceilf(max_x) + 2;
+    int32_t h = cy + (int32_t)ceilf(max_y) + 2;
+    uint8_t *rgba = tool_alloc((size_t)w * h * 4);
+
+    int32_t bx1 = w, by1 = h, bx2 = -1, by2 = -1;
+    for (int32_t y = 0; y < h; y++)
+    {
+        for (int32_t x = 0; x < w; x++)
+        {
+            float dx = (float)(x - cx);
+            float dy = (float)(y - cy);
+            float sx = px + dx * c - dy * s;
+            float sy = py + dx * s + dy * c;
+            uint8_t *p = rgba + ((size_t)y * w + x) * 4;
+            tool_sample_bilinear(src, sx - 0.5f, sy - 0.5f, p);
+            if (p[3])
+            {
+                bx1 = LV_MIN(bx1, x);
+                bx2 = LV_MAX(bx2, x);
+                by1 = LV_MIN(by1, y);
+                by2 = LV_MAX(by2, y);
+            }
+        }
+    }
+    if (bx2 < 0)
+    {
+        tool_die("image is fully transparent", s_opts.input);
+    }
+
+    dst->w = bx2 - bx1 + 1;
+    dst->h = by2 - by1 + 1;
+    dst->rgba = tool_alloc((size_t)dst->w * dst->h * 4);
+    for (int32_t y = 0; y < dst->h; y++)
+    {
+        memcpy(dst->rgba + (size_t)y * dst->w * 4, rgba + ((size_t)(y + by1) * w + bx1) * 4, (size_t)dst->w * 4);
+    }
+    free(rgba);
+
+    *p_center_x = cx - bx1;
+    *p_center_y = cy - by1;
+}
+
+/*
+ * Encoder
+ *****************************************************************************************
+ */
+static void tool_blob_put(tool_blob_t *blob, const void *data, uint32_t size)
+{
+    if (blob->size + size > blob->cap)
+    {
+        blob->cap = LV_MAX(blob->cap * 2, blob->size + size + 1024);
+        blob->buf = realloc(blob->buf, blob->cap);
+        if (!blob->buf)
+        {
+            tool_die("out of memory", NULL);
+        }
+    }
+    memcpy(blob->buf + blob->size, data, size);
+    blob->size += size;
+}
+
+static void tool_blob_put_u16(tool_blob_t *blob, uint16_t v)
+{
+    uint8_t b[2] = {(uint8_t)v, (uint8_t)(v >> 8)};
+    tool_blob_put(blob, b, 2);
+}
+
+static void tool_blob_put_u32(tool_blob_t *blob, uint32_t v)
+{
+    uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+    tool_blob_put(blob, b, 4);
+}
+
+static inline const uint8_t *tool_px(const tool_image_t *img, uint32_t x, uint32_t y)
+{
+    return img->rgba + ((size_t)y * img->w + x) * 4;
+}
+
+static void tool_put_segment(tool_blob_t *seg, const tool_image_t *img, uint32_t y, uint32_t x1, uint32_t x2, bool keep_inline)
+{
+    uint32_t width = (x2 >= x1) ? x2 - x1 + 1 : 0;
+    bool has_alpha = false;
+    for (uint32_t x = x1; x < x1 + width; x++)
+    {
+        has_alpha |= (tool_px(img, x, y)[3] != 0xFF);
+    }
+
+    uint32_t bytes = width * (has_alpha ? 3 : 2);
+    uint32_t padding = (4 - (bytes & 3)) & 3;
+    uint16_t flags = (uint16_t)((width ? x1 : 0) | (padding << SEG_PADDING_POS));
+    flags |= keep_inline ? SEG_FLAG_KEEP_INLINE : 0;
+    flags |= has_alpha ? SEG_FLAG_HAS_ALPHA : 0;
+
+    tool_blob_put_u16(seg, flags);
+    tool_blob_put_u16(seg, (uint16_t)width);
+    for (uint32_t x = x1; x < x1 + width; x++)
+    {
+        const uint8_t *p = tool_px(img, x, y);
+        tool_blob_put_u16(seg, lv_color_make(p[0], p[1], p[2]).full);
+    }
+    if (has_alpha)
+    {
+        for (uint32_t x = x1; x < x1 + width; x++)
+        {
+            tool_blob_put(seg, &tool_px(img, x, y)[3], 1);
+        }
+    }
+    static const uint8_t zeros[3] = {0};
+    tool_blob_put(seg, zeros, padding);
+}
+
+/* Emit one visible run, splitting out the opaque stretches long enough to pay for
+ * an extra segment header so they are stored without the alpha plane. */
+static uint32_t tool_put_run(tool_blob_t *seg, const tool_image_t *img, uint32_t y, uint32_t x1, uint32_t x2, bool *p_keep_inline)
+{
+    uint32_t segments = 0;
+    uint32_t start = x1;
+    uint32_t x = x1;
+
+    while (x <= x2)
+    {
+        if (s_opts.split_opaque && tool_px(img, x, y)[3] == 0xFF)
+        {
+            uint32_t e = x;
+            while (e + 1 <= x2 && tool_px(img, e + 1, y)[3] == 0xFF)
+            {
+                e++;
+            }
+            if (e - x + 1 >= s_opts.split_opaque)
+            {
+                if (x > start)
+                {
+                    tool_put_segment(seg, img, y, start, x - 1, *p_keep_inline);
+                    *p_keep_inline = true;
+                    segments++;
+                }
+                tool_put_segment(seg, img, y, x, e, *p_keep_inline);
+                *p_keep_inline = true;
+                segments++;
+                start = e + 1;
+            }
+            x = e + 1;
+        }
+        else
+        {
+            x++;
+        }
+    }
+    if (start <= x2)
+    {
+        tool_put_segment(seg, img, y, start, x2, *p_keep_inline);
+        *p_keep_inline = true;
+        segments++;
+    }
+    return segments;
+}
+
+static void tool_encode(const tool_image_t *img, tool_blob_t *blob, tool_entry_t *entry)
+{
+    int32_t start_y = -1, total_lines = 0;
+    for (uint32_t y = 0; y < img->h; y++)
+    {
+        for (uint32_t x = 0; x < img->w; x++)
+        {
+            if (tool_px(img, x, y)[3])
+            {
+                start_y = (start_y < 0) ? (int32_t)y : start_y;
+                total_lines = y + 1;
+                break;
+            }
+        }
+    }
+    if (start_y < 0)
+    {
+        tool_die("image is fully transparent", s_opts.input);
+    }
+    if (img->w - 1 > TOOL_MAX_START_X || total_lines - 1 > TOOL_MAX_LINE_Y)
+    {
+        tool_die("image too large for GX-IMG (4096 columns, 1024 lines)", s_opts.input);
+    }
+
+    uint32_t lines = total_lines - start_y;
+    bool line_table = (s_opts.table_mode == TOOL_TABLE_ALWAYS) ||
+                      (s_opts.table_mode == TOOL_TABLE_AUTO && lines > TOOL_AUTO_TABLE_LINES);
+    uint32_t *line_offset = tool_alloc(lines * sizeof(uint32_t));
+    tool_blob_t seg = {0};
+
+    entry->segments = 0;
+    for (uint32_t y = start_y; y < (uint32_t)total_lines; y++)
+    {
+        // The first segment of start_y is inline, every other line starts with a new-line segment
+        bool keep_inline = (y == (uint32_t)start_y);
+        uint32_t line_segments = 0;
+        line_offset[y - start_y] = seg.size;
+
+        uint32_t x = 0;
+        while (x < img->w)
+        {
+            if (!tool_px(img, x, y)[3])
+            {
+                x++;
+                continue;
+            }
+
+            // Extend the run over transparent gaps shorter than split_gap (0: never split)
+            uint32_t x1 = x, x2 = x;
+            uint32_t gap = 0;
+            for (x = x + 1; x < img->w; x++)
+            {
+                if (tool_px(img, x, y)[3])
+                {
+                    x2 = x;
+                    gap = 0;
+                }
+                else if (s_opts.split_gap && ++gap >= s_opts.split_gap)
+                {
+                    break;
+                }
+            }
+            line_segments += tool_put_run(&seg, img, y, x1, x2, &keep_inline);
+        }
+
+        if (!line_segments)
+        {
+            // Empty line inside the image: y only advances on segments, emit an empty one
+            tool_put_segment(&seg, img, y, 1, 0, keep_inline);
+            line_segments = 1;
+        }
+        entry->segments += line_segments;
+    }
+
+    if (line_table && seg.size > TOOL_MAX_LINE_OFFSET)
+    {
+        tool_die("segment data too large for the line table", s_opts.input);
+    }
+
+    entry->blob_offset = blob->size;
+    if (line_table)
+    {
+        for (uint32_t y = start_y + 1; y < (uint32_t)total_lines; y++)
+        {
+            tool_blob_put_u32(blob, line_offset[y - start_y] | (y << LINE_INFO_Y_POS));
+        }
+    }
+    tool_blob_put(blob, seg.buf, seg.size);
+
+    lv_gximg_dsc_t *dsc = &entry->dsc;
+    memset(dsc, 0, sizeof(*dsc));
+    dsc->header.always_zero = 0;
+    dsc->header.cf = LV_IMG_CF_GDX_GXIMG;
+    dsc->header.w = img->w;
+    dsc->header.h = img->h;
+    dsc->start_y = start_y;
+    dsc->total_lines = total_lines;
+    dsc->line_table = line_table;
+    dsc->data_size = blob->size - entry->blob_offset;
+
+    free(seg.buf);
+    free(line_offset);
+}
+
+/*
+ * Round-trip verification
+ *****************************************************************************************
+ */
+static uint16_t tool_bg_pixel(uint32_t bg, uint32_t x, uint32_t y)
+{
+    if (!bg)
+    {
+        return 0x0000;
+    }
+    // Busy pattern so every channel gets blended against non-trivial values
+    uint32_t v = (x * 7 + y * 13) ^ (x * y);
+    return (uint16_t)(((v & 0x1F) << 11) | (((v >> 2) & 0x3F) << 5) | ((v >> 3) & 0x1F));
+}
+
+static void tool_draw_bands(const lv_gximg_dsc_t *dsc, uint16_t *fb, bool bottom_up)
+{
+    lv_draw_img_dsc_t draw_dsc;
+    lv_draw_img_dsc_init(&draw_dsc);
+
+    lv_area_t coords = {0, 0, dsc->header.w - 1, dsc->header.h - 1};
+    uint32_t bands = (dsc->header.h + TOOL_VERIFY_BAND_LINES - 1) / TOOL_VERIFY_BAND_LINES;
+
+    for (uint32_t n = 0; n < bands; n++)
+    {
+        uint32_t band = bottom_up ? bands - 1 - n : n;
+        lv_area_t buf_area = {
+            .x1 = 0,
+            .y1 = band * TOOL_VERIFY_BAND_LINES,
+            .x2 = dsc->header.w - 1,
+            .y2 = LV_MIN((band + 1) * TOOL_VERIFY_BAND_LINES, dsc->header.h) - 1,
+        };
+        lv_draw_ctx_t draw_ctx;
+        memset(&draw_ctx, 0, sizeof(draw_ctx));
+        draw_ctx.buf = fb + (size_t)buf_area.y1 * dsc->header.w;
+        draw_ctx.buf_area = &buf_area;
+        draw_ctx.clip_area = &buf_area;
+        lv_port_gximg_draw(&draw_ctx, &draw_dsc, &coords, dsc, false, false);
+    }
+}
+
+static void tool_dump_ppm(const char *path, const uint16_t *fb, uint32_t w, uint32_t h)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp)
+    {
+        tool_die("cannot write", path);
+    }
+    fprintf(fp, "P6\n%u %u\n255\n", w, h);
+    for (uint32_t i = 0; i < w * h; i++)
+    {
+        lv_color_t c = {.full = fb[i]};
+        uint8_t rgb[3] = {
+            (uint8_t)(c.ch.red * 255 / 31),
+            (uint8_t)(c.ch.green * 255 / 63),
+            (uint8_t)(c.ch.blue * 255 / 31),
+        };
+        fwrite(rgb, 1, 3, fp);
+    }
+    fclose(fp);
+}
+
+static uint32_t tool_verify(const tool_image_t *img, tool_entry_t *entry, const char *dump_path)
+{
+    const lv_gximg_dsc_t *dsc = &entry->dsc;
+    uint32_t npx = (uint32_t)img->w * img->h;
+    uint16_t *fb = tool_alloc(npx * sizeof(uint16_t));
+    uint32_t mismatches = 0;
+
+    for (uint32_t pass = 0; pass < 4; pass++)
+    {
+        uint32_t bg = pass & 1;
+        bool bottom_up = (pass >> 1) & 1;
+
+        for (uint32_t y = 0; y < img->h; y++)
+        {
+            for (uint32_t x = 0; x < img->w; x++)
+            {
+                fb[y * img->w + x] = tool_bg_pixel(bg, x, y);
+            }
+        }
+
+        tool_draw_bands(dsc, fb, bottom_up);
+
+        for (uint32_t y = 0; y < img->h; y++)
+        {
+            for (uint32_t x = 0; x < img->w; x++)
+            {
+                const uint8_t *p = tool_px(img, x, y);
+                lv_color_t back = {.full = tool_bg_pixel(bg, x, y)};
+                lv_color_t expect = lv_color_mix(lv_color_make(p[0], p[1], p[2]), back, p[3]);
+                uint16_t got = fb[y * img->w + x];
+                if (got != expect.full)
+                {
+                    if (!mismatches)
+                    {
+                        fprintf(stderr, "%s: first mismatch at (%u,%u) pass %u: got 0x%04x expected 0x%04x\n",
+                                entry->name, x, y, pass, got, expect.full);
+                    }
+                    mismatches++;
+                }
+            }
+        }
+
+        if (dump_path && pass == 0)
+        {
+            tool_dump_ppm(dump_path, fb, img->w, img->h);
+        }
+    }
+
+    free(fb);
+    return mismatches;
+}
+
+/*
+ * Outputs
+ *****************************************************************************************
+ */
+static void tool_upper(char *dst, const char *src, size_t size)
+{
+    size_t i = 0;
+    for (; src[i] && i + 1 < size; i++)
+    {
+        dst[i] = isalnum((unsigned char)src[i]) ? (char)toupper((unsigned char)src[i]) : '_';
+    }
+    dst[i] = '\0';
+}
+
+static void tool_write_dsc(const tool_entry_t *entries, uint32_t count, const char *bundle_name)
+{
+    char path[512];
+    char upper[96];
+
+    snprintf(path, sizeof(path), "%s_dsc.h", s_opts.out);
+    FILE *fh = fopen(path, "w");
+    snprintf(path, sizeof(path), "%s_dsc.c", s_opts.out);
+    FILE *fc = fopen(path, "w");
+    if (!fh || !fc)
+    {
+        tool_die("cannot write", path);
+    }
+
+    fprintf(fh, "/* Generated by gximg_tool from %s, merge into lv_img_dsc_list.h */\n", s_opts.input);
+    fprintf(fc, "/* Generated by gximg_tool from %s, merge into lv_img_dsc_list.c */\n", s_opts.input);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        tool_upper(upper, entries[i].name, sizeof(upper));
+        fprintf(fh, "#define OFFSET_GXIMG_%-32s 0x%x\n", upper, s_opts.offset + entries[i].blob_offset);
+    }
+    fprintf(fh, "\n");
+    for (uint32_t i = 0; i < count; i++)
+    {
+        fprintf(fh, "LV_GXIMG_DECLARE(wd_gximg_%s);\n", entries[i].name);
+    }
+    if (bundle_name)
+    {
+        fprintf(fh, "LV_GXIMG_BUNDLE_DECLARE(wd_gximg_%s_bundle);\n", bundle_name);
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const lv_gximg_dsc_t *dsc = &entries[i].dsc;
+        tool_upper(upper, entries[i].name, sizeof(upper));
+        fprintf(fc, "\nconst lv_gximg_dsc_t wd_gximg_%s = {\n", entries[i].name);
+        fprintf(fc, "    .header.always_zero = 0,\n");
+        fprintf(fc, "    .header.w = %u,\n", dsc->header.w);
+        fprintf(fc, "    .header.h = %u,\n", dsc->header.h);
+        fprintf(fc, "    .header.cf = LV_IMG_CF_GDX_GXIMG,\n");
+        fprintf(fc, "    .center_x = %u,\n", dsc->center_x);
+        fprintf(fc, "    .center_y = %u,\n", dsc->center_y);
+        fprintf(fc, "    .start_y = %u,\n", dsc->start_y);
+        fprintf(fc, "    .total_lines = %u,\n", dsc->total_lines);
+        fprintf(fc, "    .data_size = %u,\n", dsc->data_size);
+        fprintf(fc, "    .line_table = %u,\n", dsc->line_table);
+        fprintf(fc, "    .data = BINARY_RESOURCES + OFFSET_GXIMG_%s\n", upper);
+        fprintf(fc, "};\n");
+    }
+    if (bundle_name)
+    {
+        fprintf(fc, "\nconst lv_gximg_bundle_dsc_t wd_gximg_%s_bundle = {\n", bundle_name);
+        fprintf(fc, "    .header.always_zero = 0,\n");
+        fprintf(fc, "    .header.cf = LV_IMG_CF_GDX_GXIMG_BUNDLE,\n");
+        fprintf(fc, "    .group = {\n");
+        for (uint32_t i = 0; i < count; i++)
+        {
+            fprintf(fc, "        &wd_gximg_%s,\n", entries[i].name);
+        }
+        fprintf(fc, "    },\n};\n");
+    }
+
+    fclose(fh);
+    fclose(fc);
+}
+
+static void tool_report(const tool_entry_t *entries, uint32_t count, const tool_image_t *src)
+{
+    uint64_t total_gximg = 0, total_tca = 0;
+
+    printf("%-36s %9s %6s %5s %5s %10s %10s %8s %7s\n",
+           "image", "size", "lines", "segs", "table", "gximg(B)", "tc_alpha", "saved", "verify");
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const lv_gximg_dsc_t *dsc = &entries[i].dsc;
+        uint32_t tca = (uint32_t)dsc->header.w * dsc->header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        char size[16];
+        snprintf(size, sizeof(size), "%ux%u", dsc->header.w, dsc->header.h);
+        printf("%-36s %9s %6u %5u %5s %10u %10u %7.1f%% %7s\n",
+               entries[i].name, size, dsc->total_lines - dsc->start_y, entries[i].segments,
+               dsc->line_table ? "yes" : "no", dsc->data_size, tca,
+               100.0 * ((double)tca - dsc->data_size) / tca,
+               !s_opts.verify ? "skipped" : entries[i].mismatches ? "FAIL" : "ok");
+        total_gximg += dsc->data_size;
+        total_tca += tca;
+    }
+
+    if (count > 1)
+    {
+        // A bundle replaces one TRUE_COLOR_ALPHA source rotated at run time
+        uint32_t single = (uint32_t)src->w * src->h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        printf("total: %llu B GX-IMG, %llu B as %u TRUE_COLOR_ALPHA frames (%.1f%% saved), "
+               "%u B as one rotated TRUE_COLOR_ALPHA source (%+lld B)\n",
+               (unsigned long long)total_gximg, (unsigned long long)total_tca, count,
+               100.0 * ((double)total_tca - total_gximg) / total_tca,
+               single, (long long)single - (long long)total_gximg);
+    }
+    else
+    {
+        printf("total: %llu B GX-IMG vs %llu B TRUE_COLOR_ALPHA, %lld B saved\n",
+               (unsigned long long)total_gximg, (unsigned long long)total_tca,
+               (long long)total_tca - (long long)total_gximg);
+    }
+}
+
+static void tool_usage(void)
+{
+    fprintf(stderr,
+            "usage: gximg_tool [options] <input.png | input.rgba>\n"
+            "  -o <prefix>               output prefix (default: input name without extension)\n"
+            "  -n <name>                 descriptor stem, wd_gximg_<name> (default: prefix basename)\n"
+            "  --raw <W>x<H>             input is raw RGBA8888\n"
+            "  --bundle                  emit the 16 frames of a rotation bundle (0..90 deg, 6 deg step)\n"
+            "  --pivot <X>,<Y>           rotation pivot / center_x,center_y (default: image centre)\n"
+            "  --line-table <auto|always|never>\n"
+            "                            auto emits a table above %u lines (default: auto)\n"
+            "  --split-gap <N>           split a line at N transparent pixels, 0 = one run per line (default: %u)\n"
+            "  --split-opaque <N>        store opaque stretches of N+ pixels without alpha, 0 = off (default: %u)\n"
+            "  --offset <addr>           offset of out.bin inside binary_resources.bin (default: 0)\n"
+            "  --dump <prefix>           write the decoded images to <prefix>[_NN].ppm\n"
+            "  --no-verify               skip the round trip through lv_port_gximg_draw()\n",
+            TOOL_AUTO_TABLE_LINES, TOOL_DEFAULT_SPLIT_GAP, TOOL_DEFAULT_SPLIT_OPAQUE);
+    exit(2);
+}
+
+static void tool_parse_args(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (!strcmp(arg, "--bundle"))
+        {
+            s_opts.bundle = true;
+        }
+        else if (!strcmp(arg, "--no-verify"))
+        {
+            s_opts.verify = false;
+        }
+        else if (arg[0] == '-' && !val)
+        {
+            tool_usage();
+        }
+        else if (!strcmp(arg, "-o"))
+        {
+            s_opts.out = argv[++i];
+        }
+        else if (!strcmp(arg, "-n"))
+        {
+            s_opts.name = argv[++i];
+        }
+        else if (!strcmp(arg, "--raw"))
+        {
+            unsigned w, h;
+            if (sscanf(argv[++i], "%ux%u", &w, &h) != 2 || !w || !h || w > 0xFFFF || h > 0xFFFF)
+            {
+                tool_usage();
+            }
+            s_opts.raw_w = w;
+            s_opts.raw_h = h;
+        }
+        else if (!strcmp(arg, "--pivot"))
+        {
+            int x, y;
+            if (sscanf(argv[++i], "%d,%d", &x, &y) != 2)
+            {
+                tool_usage();
+            }
+            s_opts.has_pivot = true;
+            s_opts.pivot_x = x;
+            s_opts.pivot_y = y;
+        }
+        else if (!strcmp(arg, "--line-table"))
+        {
+            val = argv[++i];
+            if (!strcmp(val, "auto"))
+            {
+                s_opts.table_mode = TOOL_TABLE_AUTO;
+            }
+            else if (!strcmp(val, "always"))
+            {
+                s_opts.table_mode = TOOL_TABLE_ALWAYS;
+            }
+            else if (!strcmp(val, "never"))
+            {
+                s_opts.table_mode = TOOL_TABLE_NEVER;
+            }
+            else
+            {
+                tool_usage();
+            }
+        }
+        else if (!strcmp(arg, "--split-gap"))
+        {
+            s_opts.split_gap = strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(arg, "--split-opaque"))
+        {
+            s_opts.split_opaque = strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(arg, "--offset"))
+        {
+            s_opts.offset = strtoul(argv[++i], NULL, 0);
+        }
+        else if (!strcmp(arg, "--dump"))
+        {
+            s_opts.dump = argv[++i];
+        }
+        else if (arg[0] == '-' || s_opts.input)
+        {
+            tool_usage();
+        }
+        else
+        {
+            s_opts.input = arg;
+        }
+    }
+
+    if (!s_opts.input)
+    {
+        tool_usage();
+    }
+}
+
+/*
+ * MAIN
+ *****************************************************************************************
+ */
+int main(int argc, char **argv)
+{
+    tool_parse_args(argc, argv);
+
+    // Default output prefix / descriptor stem from the input file name
+    static char prefix[512];
+    static char stem[96];
+    if (!s_opts.out)
+    {
+        snprintf(prefix, sizeof(prefix), "%s", s_opts.input);
+        char *dot = strrchr(prefix, '.');
+        if (dot && dot > strrchr(prefix, '/'))
+        {
+            *dot = '\0';
+        }
+        s_opts.out = prefix;
+    }
+    if (!s_opts.name)
+    {
+        const char *base = strrchr(s_opts.out, '/');
+        base = base ? base + 1 : s_opts.out;
+        size_t i = 0;
+        for (; base[i] && i + 1 < sizeof(stem); i++)
+        {
+            stem[i] = isalnum((unsigned char)base[i]) ? (char)tolower((unsigned char)base[i]) : '_';
+        }
+        stem[i] = '\0';
+        s_opts.name = stem;
+    }
+
+    tool_image_t src;
+    if (s_opts.raw_w)
+    {
+        tool_load_raw(s_opts.input, s_opts.raw_w, s_opts.raw_h, &src);
+    }
+    else
+    {
+        tool_load_png(s_opts.input, &src);
+    }
+    if (!s_opts.has_pivot)
+    {
+        s_opts.pivot_x = src.w / 2;
+        s_opts.pivot_y = src.h / 2;
+    }
+
+    uint32_t count = s_opts.bundle ? TOOL_BUNDLE_NB : 1;
+    tool_entry_t *entries = tool_alloc(count * sizeof(tool_entry_t));
+    tool_image_t *frames = tool_alloc(count * sizeof(tool_image_t));
+    tool_blob_t blob = {0};
+    uint32_t failed = 0;
+
+    for (uint32_t k = 0; k < count; k++)
+    {
+        tool_entry_t *entry = &entries[k];
+        int32_t center_x = s_opts.pivot_x;
+        int32_t center_y = s_opts.pivot_y;
+
+        if (s_opts.bundle)
+        {
+            tool_rotate(&src, s_opts.pivot_x, s_opts.pivot_y, k * TOOL_BUNDLE_STEP_DEG, &frames[k], &center_x, &center_y);
+            snprintf(entry->name, sizeof(entry->name), "%s_%02u", s_opts.name, k * TOOL_BUNDLE_STEP_DEG);
+        }
+        else
+        {
+            frames[k] = src;
+            snprintf(entry->name, sizeof(entry->name), "%s", s_opts.name);
+        }
+
+        tool_encode(&frames[k], &blob, entry);
+        entry->dsc.center_x = (uint16_t)LV_MAX(center_x, 0);
+        entry->dsc.center_y = (uint16_t)LV_MAX(center_y, 0);
+    }
+
+    // Resolve the data pointers only once the blob stops moving
+    for (uint32_t k = 0; k < count && s_opts.verify; k++)
+    {
+        char dump_path[600];
+        if (s_opts.dump)
+        {
+            snprintf(dump_path, sizeof(dump_path), s_opts.bundle ? "%s_%02u.ppm" : "%s.ppm", s_opts.dump, k * TOOL_BUNDLE_STEP_DEG);
+        }
+        entries[k].dsc.data = blob.buf + entries[k].blob_offset;
+        entries[k].mismatches = tool_verify(&frames[k], &entries[k], s_opts.dump ? dump_path : NULL);
+        failed += entries[k].mismatches ? 1 : 0;
+    }
+
+    char path[600];
+    snprintf(path, sizeof(path), "%s.bin", s_opts.out);
+    tool_write_file(path, blob.buf, blob.size);
+    tool_write_dsc(entries, count, s_opts.bundle ? s_opts.name : NULL);
+    tool_report(entries, count, &src);
+
+    if (failed)
+    {
+        fprintf(stderr, "gximg_tool: %u image(s) do not match the source after decoding\n", failed);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Re-pack Src/app_image/binary_resources.bin and regenerate its OFFSET_* table.
+
+Every LV_IMG_CF_TRUE_COLOR image is stored as LV_IMG_CF_GDX_RLE_RGB565 (row offset
+table + per-row RLE, see lv_port_gximg.h) when that saves at least --min-gain
+percent, other formats are copied untouched. Images that are already RLE are
+decoded first, so the script can be run again after adding raw images, and
+--format raw expands everything back to LV_IMG_CF_TRUE_COLOR.
+
+Blobs keep the order of lv_img_dsc_list.h and start on 4-byte boundaries. The
+OFFSET_* values in lv_img_dsc_list.h and the .header.cf / .data_size fields in
+lv_img_dsc_list.c are rewritten in place.
+
+Usage:
+    python3 res_pack.py [--dir ../../Src/app_image] [--format rle|raw] [--min-gain 10] [-v]
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+CF_TRUE_COLOR = 'LV_IMG_CF_TRUE_COLOR'
+CF_RLE = 'LV_IMG_CF_GDX_RLE_RGB565'
+
+RLE_RUN_FLAG = 0x8000
+RLE_COUNT_MASK = 0x7FFF
+RLE_MIN_RUN = 3             # a run packet (4 bytes) beats literals from 3 pixels on
+
+RES_ALIGN = 4
+
+DEFAULT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'Src', 'app_image')
+
+OFFSET_RE = re.compile(r'^(#define\s+OFFSET_(\w+)\s+)(0x[0-9a-fA-F]+)', re.M)
+DSC_RE = re.compile(r'const\s+(lv_img_dsc_t|lv_gximg_dsc_t)\s+(\w+)\s*=\s*\{(.*?)\};', re.S)
+
+
+def rle_encode(pixels, w, h):
+    rows = []
+    for y in range(h):
+        row = pixels[y * w:(y + 1) * w]
+        out = []
+        literal = []
+
+        def flush_literal():
+            while literal:
+                chunk = literal[:RLE_COUNT_MASK]
+                del literal[:RLE_COUNT_MASK]
+                out.append(len(chunk))
+                out.extend(chunk)
+
+        x = 0
+        while x < w:
+            end = x + 1
+            while end < w and row[end] == row[x] and end - x < RLE_COUNT_MASK:
+                end += 1
+            if end - x >= RLE_MIN_RUN:
+                flush_literal()
+                out.append(RLE_RUN_FLAG | (end - x))
+                out.append(row[x])
+            else:
+                literal.extend(row[x:end])
+            x = end
+        flush_literal()
+        rows.append(struct.pack('<%dH' % len(out), *out))
+
+    table = []
+    offset = 4 * h
+    for row in rows:
+        table.append(offset)
+        offset += len(row)
+    return struct.pack('<%dI' % h, *table) + b''.join(rows)
+
+
+def rle_decode(data, w, h):
+    pixels = []
+    for y in range(h):
+        pos = struct.unpack_from('<I', data, 4 * y)[0]
+        x = 0
+        while x < w:
+            packet = struct.unpack_from('<H', data, pos)[0]
+            count = packet & RLE_COUNT_MASK
+            if packet & RLE_RUN_FLAG:
+                pixels.extend(struct.unpack_from('<H', data, pos + 2) * count)
+                pos += 4
+            else:
+                pixels.extend(struct.unpack_from('<%dH' % count, data, pos + 2))
+                pos += 2 + 2 * count
+            x += count
+        if x != w:
+            raise ValueError('RLE row %d decodes to %d pixels instead of %d' % (y, x, w))
+    return pixels
+
+
+def field(body, name):
+    m = re.search(r'\.%s\s*=\s*([^,\n]+)' % re.escape(name), body)
+    return m.group(1).strip() if m else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Re-pack binary_resources.bin')
+    parser.add_argument('--dir', default=DEFAULT_DIR, help='folder holding binary_resources.bin and lv_img_dsc_list.{c,h}')
+    parser.add_argument('--format', choices=('rle', 'raw'), default='rle')
+    parser.add_argument('--min-gain', type=float, default=10.0, help='minimum saving in percent to keep an image compressed')
+    parser.add_argument('-v', '--verbose', action='store_true')
+    args = parser.parse_args()
+
+    bin_path = os.path.join(args.dir, 'binary_resources.bin')
+    h_path = os.path.join(args.dir, 'lv_img_dsc_list.h')
+    c_path = os.path.join(args.dir, 'lv_img_dsc_list.c')
+
+    with open(bin_path, 'rb') as f:
+        res = f.read()
+    with open(h_path, 'r', encoding='utf-8') as f:
+        h_src = f.read()
+    with open(c_path, 'r', encoding='utf-8') as f:
+        c_src = f.read()
+
+    offsets = [(m.group(2), int(m.group(3), 16)) for m in OFFSET_RE.finditer(h_src)]
+    if not offsets:
+        sys.exit('res_pack: no OFFSET_* in %s' % h_path)
+
+    # Descriptors using each offset
+    users = {}
+    for m in DSC_RE.finditer(c_src):
+        body = m.group(3)
+        ref = re.search(r'OFFSET_(\w+)', body)
+        if ref:
+            users.setdefault(ref.group(1), []).append(body)
+
+    out = bytearray()
+    new_offset = {}
+    new_format = {}
+    raw_total = 0
+    for i, (name, offset) in enumerate(offsets):
+        bodies = users.get(name, [])
+        if bodies:
+            size = max(int(field(b, 'data_size')) for b in bodies)
+        else:
+            end = offsets[i + 1][1] if i + 1 < len(offsets) else len(res)
+            size = end - offset
+        blob = res[offset:offset + size]
+
+        cf = field(bodies[0], 'header.cf') if bodies else None
+        if cf in (CF_TRUE_COLOR, CF_RLE):
+            w = int(field(bodies[0], 'header.w'))
+            h = int(field(bodies[0], 'header.h'))
+            if cf == CF_RLE:
+                pixels = rle_decode(blob, w, h)
+            else:
+                pixels = list(struct.unpack('<%dH' % (w * h), blob))
+            raw = struct.pack('<%dH' % (w * h), *pixels)
+            packed = rle_encode(pixels, w, h)
+            if rle_decode(packed, w, h) != pixels:
+                sys.exit('res_pack: RLE round trip failed for %s' % name)
+
+            raw_total += len(raw)
+            if args.format == 'rle' and len(packed) * 100 <= len(raw) * (100 - args.min_gain):
+                blob, cf = packed, CF_RLE
+            else:
+                blob, cf = raw, CF_TRUE_COLOR
+            new_format[name] = (cf, len(blob))
+            if args.verbose:
+                print('%-36s %4dx%-4d %8d -> %8d %s' % (name, w, h, len(raw), len(blob), cf))
+        else:
+            raw_total += len(blob)
+
+        while len(out) % RES_ALIGN:
+            out.append(0)
+        new_offset[name] = len(out)
+        out += blob
+
+    def fix_offset(m):
+        return '%s0x%x' % (m.group(1), new_offset[m.group(2)])
+
+    def fix_dsc(m):
+        body = m.group(3)
+        ref = re.search(r'OFFSET_(\w+)', body)
+        if ref and ref.group(1) in new_format:
+            cf, size = new_format[ref.group(1)]
+            body = re.sub(r'(\.header\.cf\s*=\s*)\w+', r'\g<1>' + cf, body)
+            body = re.sub(r'(\.data_size\s*=\s*)\d+', r'\g<1>%d' % size, body)
+        return m.group(0)[:m.start(3) - m.start(0)] + body + m.group(0)[m.end(3) - m.start(0):]
+
+    with open(bin_path, 'wb') as f:
+        f.write(out)
+    with open(h_path, 'w', encoding='utf-8', newline='') as f:
+        f.write(OFFSET_RE.sub(fix_offset, h_src))
+    with open(c_path, 'w', encoding='utf-8', newline='') as f:
+        f.write(DSC_RE.sub(fix_dsc, c_src))
+
+    compressed = sum(1 for cf, _ in new_format.values() if cf == CF_RLE)
+    print('res_pack: %d resources, %d/%d images RLE, %d -> %d bytes (uncompressed %d)'
+          % (len(offsets), compressed, len(new_format), len(res), len(out), raw_total))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Convert a render profiler dump into Chrome trace JSON and a per-class summary.
+
+The input is a UART log holding the output of
+render_profiler_dump(NULL, RENDER_PROFILER_DUMP_RAW) (see Src/system/render_profiler.h),
+the last '#rprof,1,...' .. '#rprof,end' block is used. Object classes that the firmware
+prints as 'cls@0x...' are named from the Keil .map file (Image Symbol Table) or from
+'nm' output of the host build.
+
+Open the JSON in chrome://tracing or https://ui.perfetto.dev.
+
+Usage:
+    python3 rprof2trace.py uart.log [-o trace.json] [--map ../../Keil_5/Listings/GR5525_SmartWatch.map]
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+HEADER_RE = re.compile(r'#rprof,1,(\d+),(\d+)')
+END_RE = re.compile(r'#rprof,end')
+EVENT_RE = re.compile(r'(\w+),(\d+),(\d+),([^,\s]+),(\d+)\s*$')
+CLASS_ADDR_RE = re.compile(r'^cls@(0x[0-9a-fA-F]+)$')
+
+# Keil:  lv_label_class    0x0023f1a0   Data    56  lv_label.o(.constdata)
+KEIL_SYM_RE = re.compile(r'^\s*(\w+)\s+(0x[0-9a-fA-F]+)\s+(?:Data|Thumb Code|ARM Code)\b')
+# nm:    00000000101927a0 R lv_gx_chart_class
+NM_SYM_RE = re.compile(r'^([0-9a-fA-F]{8,16})\s+[A-Za-z]\s+(\w+)\s*$')
+
+OBJ_ZONES = ('obj', 'obj_post')
+COUNTER_ZONES = ('glyph', 'img')
+TID_RENDER = 1
+TID_COUNTER = 2
+
+
+def load_symbols(path):
+    symbols = {}
+    with open(path, 'r', errors='replace') as f:
+        for line in f:
+            m = KEIL_SYM_RE.match(line)
+            if m:
+                symbols[int(m.group(2), 16)] = m.group(1)
+                continue
+            m = NM_SYM_RE.match(line)
+            if m:
+                symbols[int(m.group(1), 16)] = m.group(2)
+    return symbols
+
+
+def parse_dump(path):
+    block = None
+    with open(path, 'r', errors='replace') as f:
+        for line in f:
+            m = HEADER_RE.search(line)
+            if m:
+                block = {'tpu': int(m.group(1)), 'events': []}
+                continue
+            if block is None:
+                continue
+            if END_RE.search(line):
+                block['complete'] = True
+                continue
+            m = EVENT_RE.search(line)
+            if m and not block.get('complete'):
+                zone, ts, dur, name, arg = m.groups()
+                block['events'].append((zone, int(ts), int(dur), name, int(arg)))
+    return block
+
+
+def class_name(name, symbols):
+    m = CLASS_ADDR_RE.match(name)
+    if m and symbols:
+        sym = symbols.get(int(m.group(1), 16))
+        if sym:
+            return sym[:-len('_class')] if sym.endswith('_class') else sym
+    return name
+
+
+def to_trace(block, symbols):
+    tpu = max(block['tpu'], 1)
+    events = block['events']
+
+    # Events are in end order and the timestamps wrap at 32 bits: follow the signed deltas
+    stamps = []
+    t = 0
+    last = None
+    for zone, ts, dur, name, arg in events:
+        if last is not None:
+            delta = (ts - last) & 0xFFFFFFFF
+            t += delta - (1 << 32) if delta & 0x80000000 else delta
+        last = ts
+        stamps.append(t)
+    origin = min(stamps) if stamps else 0
+
+    trace = [
+        {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': TID_RENDER, 'args': {'name': 'render'}},
+        {'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': TID_COUNTER, 'args': {'name': 'per frame sums'}},
+    ]
+    for (zone, ts, dur, name, arg), t in zip(events, stamps):
+        if zone in OBJ_ZONES:
+            name = class_name(name, symbols)
+        trace.append({
+            'name': name,
+            'cat': zone,
+            'ph': 'X',
+            'pid': 1,
+            'tid': TID_COUNTER if zone in COUNTER_ZONES else TID_RENDER,
+            'ts': round((t - origin) / tpu, 1),
+            'dur': round(dur / tpu, 1),
+            'args': {'n': arg},
+        })
+    return {'displayTimeUnit': 'ms', 'traceEvents': trace}
+
+
+def print_summary(trace):
+    events = [e for e in trace['traceEvents'] if e['ph'] == 'X']
+    frames = max(sum(1 for e in events if e['cat'] == 'frame'), 1)
+
+    zones = {}
+    classes = {}
+    for e in events:
+        total, count = zones.get(e['cat'], (0.0, 0))
+        count += e['args']['n'] if e['cat'] in COUNTER_ZONES else 1
+        zones[e['cat']] = (total + e['dur'], count)
+        if e['cat'] in OBJ_ZONES:
+            total, count = classes.get(e['name'], (0.0, 0))
+            classes[e['name']] = (total + e['dur'], count + (1 if e['cat'] == 'obj' else 0))
+
+    print('%d frames, %d events' % (frames, len(events)))
+    print('%-24s %8s %12s %12s' % ('zone', 'count', 'total_us', 'per_frame_us'))
+    for zone, (total, count) in zones.items():
+        print('%-24s %8d %12.0f %12.1f' % (zone, count, total, total / frames))
+    print('%-24s %8s %12s %12s' % ('class (main+post)', 'count', 'total_us', 'per_frame_us'))
+    for name, (total, count) in sorted(classes.items(), key=lambda kv: -kv[1][0]):
+        print('%-24s %8d %12.0f %12.1f' % (name, count, total, total / frames))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='render profiler dump -> Chrome trace JSON')
+    parser.add_argument('log', help='UART log with a RENDER_PROFILER_DUMP_RAW dump')
+    parser.add_argument('-o', '--output', help='trace file, default <log>.json')
+    parser.add_argument('--map', help='Keil .map file or nm output to name the object classes')
+    args = parser.parse_args()
+
+    block = parse_dump(args.log)
+    if block is None:
+        print('ERROR: no #rprof dump in %s' % args.log)
+        return 1
+    if not block.get('complete'):
+        print('WARNING: dump is truncated, %d events read' % len(block['events']))
+
+    symbols = load_symbols(args.map) if args.map else {}
+    trace = to_trace(block, symbols)
+
+    output = args.output or os.path.splitext(args.log)[0] + '.json'
+    with open(output, 'w') as f:
+        json.dump(trace, f)
+    print('%s: %d events' % (output, len(trace['traceEvents']) - 2))
+    print_summary(trace)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())